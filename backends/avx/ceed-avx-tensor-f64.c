@@ -18,7 +18,9 @@
 #include <ceed/backend.h>
 #include <immintrin.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include "ceed-avx.h"
+#include "../ceed-backend-tuning.h"
 
 // c += a * b
 #ifdef __FMA__
@@ -248,6 +250,27 @@ static int CeedTensorContract_Avx_Blocked_4_8(CeedTensorContract contract,
   return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u,
                                         v, 4, 8);
 }
+static int CeedTensorContract_Avx_Blocked_2_8(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u,
+                                        v, 2, 8);
+}
+static int CeedTensorContract_Avx_Blocked_8_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u,
+                                        v, 8, 4);
+}
+static int CeedTensorContract_Avx_Blocked_4_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u,
+                                        v, 4, 4);
+}
 static int CeedTensorContract_Avx_Remainder_8_8(CeedTensorContract contract,
     CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
     CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
@@ -255,6 +278,13 @@ static int CeedTensorContract_Avx_Remainder_8_8(CeedTensorContract contract,
   return CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, t_mode, add,
                                           u, v, 8, 8);
 }
+static int CeedTensorContract_Avx_Remainder_8_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  return CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, t_mode, add,
+                                          u, v, 8, 4);
+}
 static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract,
     CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
     CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
@@ -262,18 +292,63 @@ static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract,
   return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u,
                                        v, 4, 8);
 }
+static int CeedTensorContract_Avx_Single_2_8(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u,
+                                       v, 2, 8);
+}
+static int CeedTensorContract_Avx_Single_8_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u,
+                                       v, 8, 4);
+}
+static int CeedTensorContract_Avx_Single_4_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u,
+                                       v, 4, 4);
+}
 
 //------------------------------------------------------------------------------
-// Tensor Contract Apply
+// Tensor Contract - Register Tile Candidates
+//   The first entry of each table is the default
 //------------------------------------------------------------------------------
-static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
-                                       CeedInt B, CeedInt C, CeedInt J,
-                                       const double *restrict t,
-                                       CeedTransposeMode t_mode,
-                                       const CeedInt add,
-                                       const double *restrict u,
-                                       double *restrict v) {
-  const CeedInt blk_size = 8;
+typedef int (*CeedTensorContractKernel_Avx)(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const double *restrict t,
+    CeedTransposeMode t_mode, const CeedInt add, const double *restrict u,
+    double *restrict v);
+
+static const struct {
+  CeedInt blk_size;
+  CeedTensorContractKernel_Avx blocked, remainder;
+} blocked_tiles[] = {
+  {8, CeedTensorContract_Avx_Blocked_4_8, CeedTensorContract_Avx_Remainder_8_8},
+  {8, CeedTensorContract_Avx_Blocked_2_8, CeedTensorContract_Avx_Remainder_8_8},
+  {4, CeedTensorContract_Avx_Blocked_8_4, CeedTensorContract_Avx_Remainder_8_4},
+  {4, CeedTensorContract_Avx_Blocked_4_4, CeedTensorContract_Avx_Remainder_8_4},
+};
+static const CeedTensorContractKernel_Avx single_tiles[] = {
+  CeedTensorContract_Avx_Single_4_8,
+  CeedTensorContract_Avx_Single_2_8,
+  CeedTensorContract_Avx_Single_8_4,
+  CeedTensorContract_Avx_Single_4_4,
+};
+#define CEED_AVX_NUM_BLOCKED_TILES (CeedInt)(sizeof(blocked_tiles)/sizeof(blocked_tiles[0]))
+#define CEED_AVX_NUM_SINGLE_TILES (CeedInt)(sizeof(single_tiles)/sizeof(single_tiles[0]))
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply with given register tiles
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractApplyTiles_Avx(CeedTensorContract contract,
+    CeedInt blocked_tile, CeedInt single_tile, CeedInt A, CeedInt B, CeedInt C,
+    CeedInt J, const double *restrict t, CeedTransposeMode t_mode,
+    const CeedInt add, const double *restrict u, double *restrict v) {
+  const CeedInt blk_size = blocked_tiles[blocked_tile].blk_size;
 
   if (!add)
     for (CeedInt q=0; q<A*J*C; q++)
@@ -281,19 +356,135 @@ static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
 
   if (C == 1) {
     // Serial C=1 Case
-    CeedTensorContract_Avx_Single_4_8(contract, A, B, C, J, t, t_mode, true, u,
-                                      v);
+    single_tiles[single_tile](contract, A, B, C, J, t, t_mode, true, u, v);
   } else {
-    // Blocks of 8 columns
+    // Blocks of blk_size columns
     if (C >= blk_size)
-      CeedTensorContract_Avx_Blocked_4_8(contract, A, B, C, J, t, t_mode, true,
-                                         u, v);
+      blocked_tiles[blocked_tile].blocked(contract, A, B, C, J, t, t_mode, true,
+                                          u, v);
     // Remainder of columns
     if (C % blk_size)
-      CeedTensorContract_Avx_Remainder_8_8(contract, A, B, C, J, t, t_mode, true,
-                                           u, v);
+      blocked_tiles[blocked_tile].remainder(contract, A, B, C, J, t, t_mode,
+                                            true, u, v);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
+                                       CeedInt B, CeedInt C, CeedInt J,
+                                       const double *restrict t,
+                                       CeedTransposeMode t_mode,
+                                       const CeedInt add,
+                                       const double *restrict u,
+                                       double *restrict v) {
+  int ierr;
+  CeedTensorContract_Avx *impl;
+  ierr = CeedTensorContractGetData(contract, &impl); CeedChkBackend(ierr);
+
+  return CeedTensorContractApplyTiles_Avx(contract, impl->blocked_tile,
+                                          impl->single_tile, A, B, C, J, t,
+                                          t_mode, add, u, v);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Tune
+//   Times the contractions of a tensor basis interpolation for each candidate
+//   register tile, with C=1 for the single tiles and C=8 for the blocked tiles
+//------------------------------------------------------------------------------
+static int CeedTensorContractTune_Avx(CeedBasis basis,
+                                      CeedTensorContract contract,
+                                      bool is_single, CeedInt *tile) {
+  int ierr;
+  Ceed ceed, ceed_parent;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
+  ierr = CeedGetParent(ceed, &ceed_parent); CeedChkBackend(ierr);
+  bool is_tensor;
+  ierr = CeedBasisIsTensor(basis, &is_tensor); CeedChkBackend(ierr);
+  if (!is_tensor) return CEED_ERROR_SUCCESS;
+
+  // Tuning key
+  const char *resource;
+  ierr = CeedGetResource(ceed_parent, &resource); CeedChkBackend(ierr);
+  CeedInt dim, num_comp, P, Q;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumNodes1D(basis, &P); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q); CeedChkBackend(ierr);
+  char key[256];
+  snprintf(key, sizeof(key), "%s:f64_%s_tile:dim=%d:P=%d:Q=%d:num_comp=%d",
+           resource, is_single ? "single" : "blocked", dim, P, Q, num_comp);
+
+  // Check database
+  const CeedInt num_tiles = is_single ? CEED_AVX_NUM_SINGLE_TILES :
+                            CEED_AVX_NUM_BLOCKED_TILES;
+  CeedInt value;
+  bool found, is_enabled;
+  ierr = CeedBackendTuningLookup(ceed, key, &value, &found); CeedChkBackend(ierr);
+  if (found && value >= 0 && value < num_tiles) {
+    *tile = value;
+    return CEED_ERROR_SUCCESS;
   }
+  ierr = CeedBackendTuningIsEnabled(&is_enabled); CeedChkBackend(ierr);
+  if (!is_enabled) return CEED_ERROR_SUCCESS;
+
+  // Work arrays sized for the largest intermediate
+  const CeedInt C = is_single ? 1 : 8, max_PQ = P > Q ? P : Q;
+  CeedInt size = num_comp*C;
+  for (CeedInt d=0; d<dim; d++) size *= max_PQ;
+  double *t, *u, *v;
+  ierr = CeedMalloc(P*Q, &t); CeedChkBackend(ierr);
+  ierr = CeedMalloc(size, &u); CeedChkBackend(ierr);
+  ierr = CeedMalloc(size, &v); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<P*Q; i++) t[i] = 1.0 / max_PQ;
+  for (CeedInt i=0; i<size; i++) u[i] = 1.0;
 
+  // Enough repetitions for a measurable time
+  CeedInt flops = 0;
+  for (CeedInt d=0; d<dim; d++) {
+    CeedInt A = num_comp;
+    for (CeedInt e=0; e<dim-1; e++) A *= e < d ? Q : P;
+    flops += 4*A*P*Q*C;
+  }
+  const CeedInt num_reps = flops < 1000000 ? 1000000 / flops : 1;
+
+  double best_time = -1.0;
+  for (CeedInt i=0; i<num_tiles; i++) {
+    const CeedInt blocked_tile = is_single ? 0 : i,
+                  single_tile = is_single ? i : 0;
+    double time = -1.0;
+    for (CeedInt trial=0; trial<3; trial++) {
+      double start, end;
+      ierr = CeedBackendTuningGetTime(&start); CeedChkBackend(ierr);
+      for (CeedInt r=0; r<num_reps; r++)
+        for (CeedInt d=0; d<dim; d++) {
+          // Interpolation and its transpose along direction d
+          CeedInt A = num_comp;
+          for (CeedInt e=0; e<dim-1; e++) A *= e < d ? Q : P;
+          ierr = CeedTensorContractApplyTiles_Avx(contract, blocked_tile,
+                                                  single_tile, A, P, C, Q, t,
+                                                  CEED_NOTRANSPOSE, false, u, v);
+          CeedChkBackend(ierr);
+          ierr = CeedTensorContractApplyTiles_Avx(contract, blocked_tile,
+                                                  single_tile, A, Q, C, P, t,
+                                                  CEED_TRANSPOSE, false, u, v);
+          CeedChkBackend(ierr);
+        }
+      ierr = CeedBackendTuningGetTime(&end); CeedChkBackend(ierr);
+      if (time < 0 || end - start < time) time = end - start;
+    }
+    if (best_time < 0 || time < best_time) {
+      best_time = time;
+      *tile = i;
+    }
+  }
+  ierr = CeedFree(&t); CeedChkBackend(ierr);
+  ierr = CeedFree(&u); CeedChkBackend(ierr);
+  ierr = CeedFree(&v); CeedChkBackend(ierr);
+  ierr = CeedBackendTuningStore(ceed, key, *tile); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -301,6 +492,11 @@ static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
 static int CeedTensorContractDestroy_Avx(CeedTensorContract contract) {
+  int ierr;
+  CeedTensorContract_Avx *impl;
+  ierr = CeedTensorContractGetData(contract, &impl); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl); CeedChkBackend(ierr);
+
   return CEED_ERROR_SUCCESS;
 }
 
@@ -313,6 +509,16 @@ int CeedTensorContractCreate_f64_Avx(CeedBasis basis,
   Ceed ceed;
   ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChkBackend(ierr);
 
+  CeedTensorContract_Avx *impl;
+  ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
+  ierr = CeedTensorContractSetData(contract, impl); CeedChkBackend(ierr);
+
+  // Register tiles
+  ierr = CeedTensorContractTune_Avx(basis, contract, false,
+                                    &impl->blocked_tile); CeedChkBackend(ierr);
+  ierr = CeedTensorContractTune_Avx(basis, contract, true, &impl->single_tile);
+  CeedChkBackend(ierr);
+
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Avx); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
@@ -20,6 +20,11 @@
 #include <ceed/ceed.h>
 #include <ceed/backend.h>
 
+typedef struct {
+  CeedInt blocked_tile; /* Register tile index for C > 1 contractions */
+  CeedInt single_tile;  /* Register tile index for C = 1 contractions */
+} CeedTensorContract_Avx;
+
 CEED_INTERN int CeedTensorContractCreate_f32_Avx(CeedBasis basis,
     CeedTensorContract contract);
 CEED_INTERN int CeedTensorContractCreate_f64_Avx(CeedBasis basis,
@@ -53,8 +53,12 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     CeedEvalMode eval_mode;
     ierr = CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode);
     CeedChkBackend(ierr);
+    // Compressed quadrature data is decoded for each block instead
+    bool is_compressed;
+    ierr = CeedOperatorFieldIsQDataCompressed(op_fields[i], &is_compressed);
+    CeedChkBackend(ierr);
 
-    if (eval_mode != CEED_EVAL_WEIGHT) {
+    if (eval_mode != CEED_EVAL_WEIGHT && !is_compressed) {
       ierr = CeedOperatorFieldGetElemRestriction(op_fields[i], &r);
       CeedChkBackend(ierr);
       ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChkBackend(ierr);
@@ -64,14 +68,29 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
       ierr = CeedElemRestrictionGetLVectorSize(r, &l_size); CeedChkBackend(ierr);
       ierr = CeedElemRestrictionGetNumComponents(r, &num_comp); CeedChkBackend(ierr);
 
-      bool strided;
+      bool strided, structured, compressed;
       ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChkBackend(ierr);
-      if (strided) {
+      ierr = CeedElemRestrictionIsStructured(r, &structured); CeedChkBackend(ierr);
+      ierr = CeedElemRestrictionIsCompressed(r, &compressed); CeedChkBackend(ierr);
+      if (structured) {
+        CeedInt dim, num_elem_1d[3], P_1d;
+        bool is_periodic[3];
+        ierr = CeedElemRestrictionGetStructure(r, &dim, &num_elem_1d, &P_1d,
+                                               &is_periodic); CeedChkBackend(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &comp_stride); CeedChkBackend(ierr);
+        ierr = CeedElemRestrictionCreateBlockedStructured(ceed, dim, num_elem_1d,
+               P_1d, is_periodic, blk_size, num_comp, comp_stride, l_size,
+               &blk_restr[i+start_e]); CeedChkBackend(ierr);
+      } else if (strided) {
         CeedInt strides[3];
         ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChkBackend(ierr);
         ierr = CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, elem_size,
                blk_size, num_comp, l_size, strides, &blk_restr[i+start_e]);
         CeedChkBackend(ierr);
+      } else if (compressed) {
+        // Blocked restriction shares the compressed offset table
+        ierr = CeedElemRestrictionCreateBlockedShared(r, blk_size,
+               &blk_restr[i+start_e]); CeedChkBackend(ierr);
       } else {
         const CeedInt *offsets = NULL;
         ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
@@ -226,6 +245,7 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields,
   CeedEvalMode eval_mode;
   CeedVector vec;
   uint64_t state;
+  bool is_compressed;
 
   for (CeedInt i=0; i<num_input_fields; i++) {
     // Get input vector
@@ -240,7 +260,9 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields,
 
     ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
     CeedChkBackend(ierr);
-    if (eval_mode == CEED_EVAL_WEIGHT) { // Skip
+    ierr = CeedOperatorFieldIsQDataCompressed(op_input_fields[i], &is_compressed);
+    CeedChkBackend(ierr);
+    if (eval_mode == CEED_EVAL_WEIGHT || is_compressed) { // Skip
     } else {
       // Restrict
       ierr = CeedVectorGetState(vec, &state); CeedChkBackend(ierr);
@@ -293,10 +315,24 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q,
     CeedChkBackend(ierr);
     // Basis action
     switch(eval_mode) {
-    case CEED_EVAL_NONE:
-      ierr = CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER, &impl->e_data[i][e*Q*size]); CeedChkBackend(ierr);
-      break;
+    case CEED_EVAL_NONE: {
+      bool is_compressed;
+      ierr = CeedOperatorFieldIsQDataCompressed(op_input_fields[i],
+             &is_compressed); CeedChkBackend(ierr);
+      if (is_compressed) {
+        CeedScalar *q_data;
+        ierr = CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &q_data);
+        CeedChkBackend(ierr);
+        ierr = CeedOperatorFieldDecompressQData(op_input_fields[i], e, blk_size,
+                                                q_data); CeedChkBackend(ierr);
+        ierr = CeedVectorRestoreArray(impl->q_vecs_in[i], &q_data);
+        CeedChkBackend(ierr);
+      } else {
+        ierr = CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, &impl->e_data[i][e*Q*size]);
+        CeedChkBackend(ierr);
+      }
+    } break;
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
@@ -413,6 +449,7 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields,
     bool skip_active, CeedOperator_Blocked *impl) {
   CeedInt ierr;
   CeedEvalMode eval_mode;
+  bool is_compressed;
 
   for (CeedInt i=0; i<num_input_fields; i++) {
     // Skip active inputs
@@ -425,7 +462,9 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields,
     }
     ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
     CeedChkBackend(ierr);
-    if (eval_mode == CEED_EVAL_WEIGHT) { // Skip
+    ierr = CeedOperatorFieldIsQDataCompressed(op_input_fields[i], &is_compressed);
+    CeedChkBackend(ierr);
+    if (eval_mode == CEED_EVAL_WEIGHT || is_compressed) { // Skip
     } else {
       ierr = CeedVectorRestoreArrayRead(impl->e_vecs[i],
                                         (const CeedScalar **) &impl->e_data[i]);
@@ -436,11 +475,10 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Operator Apply Core
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
-                                        CeedVector out_vec,
-                                        CeedRequest *request) {
+static int CeedOperatorApplyCore_Blocked(CeedOperator op, CeedVector in_vec,
+    CeedVector out_vec, bool is_overwrite, CeedRequest *request) {
   int ierr;
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
@@ -469,8 +507,13 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
   if (impl->is_identity_restr_op) {
     ierr = CeedElemRestrictionApply(impl->blk_restr[0], CEED_NOTRANSPOSE, in_vec,
                                     impl->e_vecs[0], request); CeedChkBackend(ierr);
-    ierr = CeedElemRestrictionApply(impl->blk_restr[1], CEED_TRANSPOSE,
-                                    impl->e_vecs[0], out_vec, request); CeedChkBackend(ierr);
+    if (is_overwrite) {
+      ierr = CeedElemRestrictionApplyTransposeOverwrite(impl->blk_restr[1],
+             impl->e_vecs[0], out_vec, request); CeedChkBackend(ierr);
+    } else {
+      ierr = CeedElemRestrictionApply(impl->blk_restr[1], CEED_TRANSPOSE,
+                                      impl->e_vecs[0], out_vec, request); CeedChkBackend(ierr);
+    }
     return CEED_ERROR_SUCCESS;
   }
 
@@ -529,11 +572,27 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
     // Active
     if (vec == CEED_VECTOR_ACTIVE)
       vec = out_vec;
+    // Only the first field writing to a vector overwrites it
+    bool is_first = true;
+    for (CeedInt j=0; is_overwrite && j<i; j++) {
+      CeedVector vec_j;
+      ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec_j);
+      CeedChkBackend(ierr);
+      if (vec_j == CEED_VECTOR_ACTIVE)
+        vec_j = out_vec;
+      is_first = is_first && vec_j != vec;
+    }
     // Restrict
-    ierr = CeedElemRestrictionApply(impl->blk_restr[i+impl->num_e_vecs_in],
-                                    CEED_TRANSPOSE, impl->e_vecs[i+impl->num_e_vecs_in],
-                                    vec, request); CeedChkBackend(ierr);
-
+    if (is_overwrite && is_first) {
+      ierr = CeedElemRestrictionApplyTransposeOverwrite(
+               impl->blk_restr[i+impl->num_e_vecs_in],
+               impl->e_vecs[i+impl->num_e_vecs_in], vec, request);
+      CeedChkBackend(ierr);
+    } else {
+      ierr = CeedElemRestrictionApply(impl->blk_restr[i+impl->num_e_vecs_in],
+                                      CEED_TRANSPOSE, impl->e_vecs[i+impl->num_e_vecs_in],
+                                      vec, request); CeedChkBackend(ierr);
+    }
   }
 
   // Restore input arrays
@@ -543,6 +602,171 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApply_Blocked(CeedOperator op, CeedVector in_vec,
+                                     CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyCore_Blocked(op, in_vec, out_vec, true, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Add
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec,
+                                        CeedVector out_vec,
+                                        CeedRequest *request) {
+  return CeedOperatorApplyCore_Blocked(op, in_vec, out_vec, false, request);
+}
+
+//------------------------------------------------------------------------------
+// Tile Q-vector across QFunction linearization probe directions
+//------------------------------------------------------------------------------
+static inline int CeedOperatorTileQVector_Blocked(CeedVector q_vec,
+    CeedVector q_vec_wide, CeedInt size, CeedInt num_pts, CeedInt num_dir) {
+  int ierr;
+  const CeedScalar *q_array;
+  CeedScalar *wide_array;
+  const CeedInt num_wide = num_pts*num_dir;
+
+  ierr = CeedVectorGetArrayRead(q_vec, CEED_MEM_HOST, &q_array);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorGetArray(q_vec_wide, CEED_MEM_HOST, &wide_array);
+  CeedChkBackend(ierr);
+  for (CeedInt c=0; c<size; c++)
+    for (CeedInt d=0; d<num_dir; d++)
+      CeedPragmaSIMD
+      for (CeedInt p=0; p<num_pts; p++)
+        wide_array[c*num_wide + d*num_pts + p] = q_array[c*num_pts + p];
+  ierr = CeedVectorRestoreArrayRead(q_vec, &q_array); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(q_vec_wide, &wide_array); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup QFunction Linearization
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupLinearizeQFunction_Blocked(CeedOperator op,
+    CeedInt num_pts, CeedOperator_Blocked *impl) {
+  int ierr;
+  if (impl->qf_q_vecs_in) return CEED_ERROR_SUCCESS;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedInt num_input_fields, num_output_fields, size;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields);
+  CeedChkBackend(ierr);
+  CeedEvalMode eval_mode;
+  CeedVector vec;
+  CeedScalar *wide_array;
+
+  // Q-vectors hold all probe directions side by side, so the QFunction is
+  //   linearized by a single QFunction call over num_pts*num_active_in points
+  const CeedInt num_active_in = impl->qf_num_active_in,
+                num_wide = num_pts*num_active_in;
+  ierr = CeedCalloc(num_input_fields, &impl->qf_q_vecs_in); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_output_fields, &impl->qf_q_vecs_out);
+  CeedChkBackend(ierr);
+  for (CeedInt i=0, in=0; i<num_input_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+    CeedChkBackend(ierr);
+    ierr = CeedQFunctionFieldGetSize(qf_input_fields[i], &size);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorCreate(ceed, num_wide*size, &impl->qf_q_vecs_in[i]);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      // Unit probe direction for each active input component
+      ierr = CeedVectorSetValue(impl->qf_q_vecs_in[i], 0.0); CeedChkBackend(ierr);
+      ierr = CeedVectorGetArray(impl->qf_q_vecs_in[i], CEED_MEM_HOST,
+                                &wide_array); CeedChkBackend(ierr);
+      for (CeedInt c=0; c<size; c++, in++)
+        for (CeedInt p=0; p<num_pts; p++)
+          wide_array[c*num_wide + in*num_pts + p] = 1.0;
+      ierr = CeedVectorRestoreArray(impl->qf_q_vecs_in[i], &wide_array);
+      CeedChkBackend(ierr);
+    } else if (eval_mode == CEED_EVAL_WEIGHT) {
+      // Quadrature weights are the same for every element
+      ierr = CeedOperatorTileQVector_Blocked(impl->q_vecs_in[i],
+                                         impl->qf_q_vecs_in[i], size, num_pts,
+                                         num_active_in); CeedChkBackend(ierr);
+    }
+  }
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    ierr = CeedQFunctionFieldGetSize(qf_output_fields[i], &size);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorCreate(ceed, num_wide*size, &impl->qf_q_vecs_out[i]);
+    CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Linearize QFunction for current Q-vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearizeQFunction_Blocked(CeedQFunction qf,
+    CeedInt num_pts, CeedQFunctionField *qf_input_fields,
+    CeedOperatorField *op_input_fields, CeedInt num_input_fields,
+    CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+    CeedInt num_output_fields, CeedOperator_Blocked *impl, CeedScalar *assembled) {
+  int ierr;
+  CeedEvalMode eval_mode;
+  CeedVector vec;
+  CeedInt size;
+  const CeedScalar *wide_array;
+  const CeedInt num_active_in = impl->qf_num_active_in,
+                num_active_out = impl->qf_num_active_out,
+                num_wide = num_pts*num_active_in;
+
+  // Passive inputs, repeated for each probe direction
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+    CeedChkBackend(ierr);
+    if (vec != CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_WEIGHT) {
+      ierr = CeedQFunctionFieldGetSize(qf_input_fields[i], &size);
+      CeedChkBackend(ierr);
+      ierr = CeedOperatorTileQVector_Blocked(impl->q_vecs_in[i],
+                                         impl->qf_q_vecs_in[i], size, num_pts,
+                                         num_active_in); CeedChkBackend(ierr);
+    }
+  }
+
+  // Apply QFunction for all probe directions
+  ierr = CeedQFunctionApply(qf, num_wide, impl->qf_q_vecs_in,
+                            impl->qf_q_vecs_out); CeedChkBackend(ierr);
+
+  // Active outputs, ordered by probe direction then output component
+  for (CeedInt i=0, out=0; i<num_output_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (vec != CEED_VECTOR_ACTIVE) continue;
+    ierr = CeedQFunctionFieldGetSize(qf_output_fields[i], &size);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorGetArrayRead(impl->qf_q_vecs_out[i], CEED_MEM_HOST,
+                                  &wide_array); CeedChkBackend(ierr);
+    for (CeedInt in=0; in<num_active_in; in++)
+      for (CeedInt c=0; c<size; c++)
+        CeedPragmaSIMD
+        for (CeedInt p=0; p<num_pts; p++)
+          assembled[(in*num_active_out + out + c)*num_pts + p] =
+            wide_array[c*num_wide + in*num_pts + p];
+    ierr = CeedVectorRestoreArrayRead(impl->qf_q_vecs_out[i], &wide_array);
+    CeedChkBackend(ierr);
+    out += size;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
@@ -571,8 +795,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(
   CeedVector vec, lvec = impl->qf_lvec;
   CeedInt num_active_in = impl->qf_num_active_in,
           num_active_out = impl->qf_num_active_out;
-  CeedVector *active_in = impl->qf_active_in;
-  CeedScalar *a, *tmp;
+  CeedScalar *a;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
 
@@ -601,23 +824,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(
       if (vec == CEED_VECTOR_ACTIVE) {
         ierr = CeedQFunctionFieldGetSize(qf_input_fields[i], &size);
         CeedChkBackend(ierr);
-        ierr = CeedVectorSetValue(impl->q_vecs_in[i], 0.0); CeedChkBackend(ierr);
-        ierr = CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &tmp);
-        CeedChkBackend(ierr);
-        ierr = CeedRealloc(num_active_in + size, &active_in); CeedChkBackend(ierr);
-        for (CeedInt field=0; field<size; field++) {
-          ierr = CeedVectorCreate(ceed, Q*blk_size, &active_in[num_active_in+field]);
-          CeedChkBackend(ierr);
-          ierr = CeedVectorSetArray(active_in[num_active_in+field], CEED_MEM_HOST,
-                                    CEED_USE_POINTER, &tmp[field*Q*blk_size]);
-          CeedChkBackend(ierr);
-        }
         num_active_in += size;
-        ierr = CeedVectorRestoreArray(impl->q_vecs_in[i], &tmp); CeedChkBackend(ierr);
       }
     }
     impl->qf_num_active_in = num_active_in;
-    impl->qf_active_in = active_in;
   }
 
   // Count number of active output fields
@@ -644,6 +854,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(
                      "and outputs");
   // LCOV_EXCL_STOP
 
+  // Setup QFunction linearization
+  ierr = CeedOperatorSetupLinearizeQFunction_Blocked(op, Q*blk_size, impl);
+  CeedChkBackend(ierr);
+
   // Setup Lvec
   if (!lvec) {
     ierr = CeedVectorCreate(ceed, num_blks*blk_size*Q*num_active_in*num_active_out,
@@ -672,44 +886,11 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(
                                           num_input_fields, blk_size, true, impl);
     CeedChkBackend(ierr);
 
-    // Assemble QFunction
-    for (CeedInt in=0; in<num_active_in; in++) {
-      // Set Inputs
-      ierr = CeedVectorSetValue(active_in[in], 1.0); CeedChkBackend(ierr);
-      if (num_active_in > 1) {
-        ierr = CeedVectorSetValue(active_in[(in+num_active_in-1)%num_active_in],
-                                  0.0); CeedChkBackend(ierr);
-      }
-      // Set Outputs
-      for (CeedInt out=0; out<num_output_fields; out++) {
-        // Get output vector
-        ierr = CeedOperatorFieldGetVector(op_output_fields[out], &vec);
-        CeedChkBackend(ierr);
-        // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST,
-                             CEED_USE_POINTER, a); CeedChkBackend(ierr);
-          ierr = CeedQFunctionFieldGetSize(qf_output_fields[out], &size);
-          CeedChkBackend(ierr);
-          a += size*Q*blk_size; // Advance the pointer by the size of the output
-        }
-      }
-      // Apply QFunction
-      ierr = CeedQFunctionApply(qf, Q*blk_size, impl->q_vecs_in, impl->q_vecs_out);
-      CeedChkBackend(ierr);
-    }
-  }
-
-  // Un-set output Qvecs to prevent accidental overwrite of Assembled
-  for (CeedInt out=0; out<num_output_fields; out++) {
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(op_output_fields[out], &vec);
-    CeedChkBackend(ierr);
-    // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_COPY_VALUES,
-                         NULL); CeedChkBackend(ierr);
-    }
+    // Linearize QFunction
+    ierr = CeedOperatorLinearizeQFunction_Blocked(qf, Q*blk_size, qf_input_fields,
+           op_input_fields, num_input_fields, qf_output_fields,
+           op_output_fields, num_output_fields, impl,
+           &a[e*Q*num_active_in*num_active_out]); CeedChkBackend(ierr);
   }
 
   // Restore input arrays
@@ -750,6 +931,56 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Blocked(CeedOperator op,
          &rstr, request);
 }
 
+//------------------------------------------------------------------------------
+// Get Passive Input E-vector for Fallback Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorGetPassiveEVector_Blocked(CeedOperator op,
+    CeedInt input_field, CeedVector *e_vec, CeedInt *blk_size) {
+  int ierr;
+  CeedOperator_Blocked *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedOperatorField *op_input_fields;
+  ierr = CeedOperatorGetFields(op, NULL, &op_input_fields, NULL, NULL);
+  CeedChkBackend(ierr);
+  CeedQFunctionField *qf_input_fields;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, NULL);
+  CeedChkBackend(ierr);
+  CeedEvalMode eval_mode;
+  CeedVector vec;
+  uint64_t state;
+  bool is_compressed;
+
+  // Setup
+  ierr = CeedOperatorSetup_Blocked(op); CeedChkBackend(ierr);
+
+  // Only restricted passive inputs are shared
+  *e_vec = NULL;
+  ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[input_field],
+                                       &eval_mode); CeedChkBackend(ierr);
+  ierr = CeedOperatorFieldIsQDataCompressed(op_input_fields[input_field],
+         &is_compressed); CeedChkBackend(ierr);
+  ierr = CeedOperatorFieldGetVector(op_input_fields[input_field], &vec);
+  CeedChkBackend(ierr);
+  if (eval_mode == CEED_EVAL_WEIGHT || is_compressed ||
+      vec == CEED_VECTOR_ACTIVE || impl->is_identity_restr_op)
+    return CEED_ERROR_SUCCESS;
+
+  // Restrict, if input changed
+  ierr = CeedVectorGetState(vec, &state); CeedChkBackend(ierr);
+  if (state != impl->input_state[input_field]) {
+    ierr = CeedElemRestrictionApply(impl->blk_restr[input_field],
+                                    CEED_NOTRANSPOSE, vec,
+                                    impl->e_vecs[input_field],
+                                    CEED_REQUEST_IMMEDIATE); CeedChkBackend(ierr);
+    impl->input_state[input_field] = state;
+  }
+  *e_vec = impl->e_vecs[input_field];
+  *blk_size = 8;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -782,10 +1013,16 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   ierr = CeedFree(&impl->q_vecs_out); CeedChkBackend(ierr);
 
   // QFunction assembly data
-  for (CeedInt i=0; i<impl->qf_num_active_in; i++) {
-    ierr = CeedVectorDestroy(&impl->qf_active_in[i]); CeedChkBackend(ierr);
+  if (impl->qf_q_vecs_in) {
+    for (CeedInt i=0; i<impl->num_e_vecs_in; i++) {
+      ierr = CeedVectorDestroy(&impl->qf_q_vecs_in[i]); CeedChkBackend(ierr);
+    }
+    for (CeedInt i=0; i<impl->num_e_vecs_out; i++) {
+      ierr = CeedVectorDestroy(&impl->qf_q_vecs_out[i]); CeedChkBackend(ierr);
+    }
   }
-  ierr = CeedFree(&impl->qf_active_in); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->qf_q_vecs_in); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->qf_q_vecs_out); CeedChkBackend(ierr);
   ierr = CeedVectorDestroy(&impl->qf_lvec); CeedChkBackend(ierr);
   ierr = CeedElemRestrictionDestroy(&impl->qf_blk_rstr); CeedChkBackend(ierr);
 
@@ -812,8 +1049,13 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
                                 "LinearAssembleQFunctionUpdate",
                                 CeedOperatorLinearAssembleQFunctionUpdate_Blocked);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Blocked); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Blocked); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetPassiveEVector",
+                                CeedOperatorGetPassiveEVector_Blocked);
+  CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Blocked); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
@@ -32,6 +32,7 @@ CEED_INTERN int CeedInit_Blocked(const char *resource, Ceed ceed) {
                      "Blocked backend cannot use resource: %s", resource);
   // LCOV_EXCL_STOP
   ierr = CeedSetDeterministic(ceed, true); CeedChkBackend(ierr);
+  ierr = CeedSetCompressedQDataSupport(ceed, true); CeedChkBackend(ierr);
 
   // Create reference CEED that implementation will be dispatched
   //   through unless overridden
@@ -40,7 +40,8 @@ typedef struct {
   CeedInt    num_e_vecs_in;
   CeedInt    num_e_vecs_out;
   CeedInt    qf_num_active_in, qf_num_active_out;
-  CeedVector *qf_active_in;
+  CeedVector *qf_q_vecs_in;   /// Q-vectors with all linearization directions
+  CeedVector *qf_q_vecs_out;
   CeedVector qf_lvec;
   CeedElemRestriction qf_blk_rstr;
 } CeedOperator_Blocked;
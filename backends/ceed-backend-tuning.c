@@ -0,0 +1,330 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#define _POSIX_C_SOURCE 200809L
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "ceed-backend-tuning.h"
+
+// Tuning database line format: <cpu model>\t<key>\t<value>
+#define CEED_TUNING_LINE_LEN 512
+
+// Entries of the tuning database for this CPU model, parsed once per process
+//   and parsed again only if the database file is replaced or modified
+typedef struct {
+  char key[CEED_TUNING_LINE_LEN];
+  CeedInt value;
+} CeedBackendTuningEntry;
+
+static struct {
+  int lock;
+  bool has_model, is_loaded;
+  char model[CEED_TUNING_LINE_LEN], path[CEED_TUNING_LINE_LEN];
+  struct stat file_stat;
+  CeedInt num_entries, max_entries;
+  CeedBackendTuningEntry *entries;
+} tuning_db;
+
+//------------------------------------------------------------------------------
+// Lock and unlock the cached tuning database
+//------------------------------------------------------------------------------
+static void CeedBackendTuningLock(void) {
+  int unlocked = 0;
+  while (!CeedAtomicCompareExchange(tuning_db.lock, unlocked, 1))
+    unlocked = 0;
+}
+
+static void CeedBackendTuningUnlock(void) {
+  CeedAtomicStore(tuning_db.lock, 0);
+}
+
+//------------------------------------------------------------------------------
+// Check if autotuning is enabled via CEED_TUNE
+//------------------------------------------------------------------------------
+int CeedBackendTuningIsEnabled(bool *is_enabled) {
+  const char *tune = getenv("CEED_TUNE");
+  *is_enabled = tune && tune[0] && strcmp(tune, "0");
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get path to tuning database, NULL if no database is in use
+//------------------------------------------------------------------------------
+static int CeedBackendTuningGetPath(const char **path) {
+  int ierr;
+  bool is_enabled;
+
+  *path = getenv("CEED_TUNE_DB");
+  if (*path && (*path)[0]) return CEED_ERROR_SUCCESS;
+
+  ierr = CeedBackendTuningIsEnabled(&is_enabled); CeedChkBackend(ierr);
+  *path = is_enabled ? "ceed-tune.db" : NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get CPU model used to key the tuning database
+//------------------------------------------------------------------------------
+static int CeedBackendTuningGetCPUModel(char *model, size_t len) {
+  char line[CEED_TUNING_LINE_LEN];
+  FILE *cpuinfo = fopen("/proc/cpuinfo", "r");
+
+  snprintf(model, len, "unknown");
+  if (!cpuinfo) return CEED_ERROR_SUCCESS;
+  while (fgets(line, sizeof(line), cpuinfo)) {
+    if (strncmp(line, "model name", 10)) continue;
+    char *value = strchr(line, ':');
+    if (!value) continue;
+    value++;
+    while (*value == ' ' || *value == '\t') value++;
+    // Tabs and newlines are reserved by the database format
+    for (char *c = value; *c; c++)
+      if (*c == '\t' || *c == '\n') *c = ' ';
+    size_t value_len = strlen(value);
+    while (value_len && value[value_len-1] == ' ') value[--value_len] = '\0';
+    if (value_len) snprintf(model, len, "%s", value);
+    break;
+  }
+  fclose(cpuinfo);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get value of database line if it matches the CPU model and key, else NULL
+//------------------------------------------------------------------------------
+static const char *CeedBackendTuningMatchLine(const char *line,
+    const char *model, const char *key) {
+  const size_t model_len = strlen(model), key_len = strlen(key);
+
+  if (strncmp(line, model, model_len) || line[model_len] != '\t') return NULL;
+  const char *line_key = &line[model_len+1];
+  if (strncmp(line_key, key, key_len) || line_key[key_len] != '\t') return NULL;
+  return &line_key[key_len+1];
+}
+
+//------------------------------------------------------------------------------
+// Set cached value, replacing any earlier entry for the same key
+//------------------------------------------------------------------------------
+static int CeedBackendTuningSetEntry(const char *key, CeedInt value) {
+  int ierr;
+
+  for (CeedInt i=0; i<tuning_db.num_entries; i++)
+    if (!strcmp(tuning_db.entries[i].key, key)) {
+      tuning_db.entries[i].value = value;
+      return CEED_ERROR_SUCCESS;
+    }
+  if (tuning_db.num_entries == tuning_db.max_entries) {
+    tuning_db.max_entries = tuning_db.max_entries ? 2*tuning_db.max_entries : 16;
+    ierr = CeedRealloc(tuning_db.max_entries, &tuning_db.entries);
+    CeedChkBackend(ierr);
+  }
+  snprintf(tuning_db.entries[tuning_db.num_entries].key, CEED_TUNING_LINE_LEN,
+           "%s", key);
+  tuning_db.entries[tuning_db.num_entries++].value = value;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Check if the database file differs from the one that was parsed
+//------------------------------------------------------------------------------
+static bool CeedBackendTuningFileChanged(const struct stat *file_stat) {
+  const struct stat *cached = &tuning_db.file_stat;
+
+  return file_stat->st_dev != cached->st_dev ||
+         file_stat->st_ino != cached->st_ino ||
+         file_stat->st_size != cached->st_size ||
+         file_stat->st_mtim.tv_sec != cached->st_mtim.tv_sec ||
+         file_stat->st_mtim.tv_nsec != cached->st_mtim.tv_nsec;
+}
+
+//------------------------------------------------------------------------------
+// Cache database line if it matches the CPU model
+//------------------------------------------------------------------------------
+static int CeedBackendTuningCacheLine(const char *line) {
+  int ierr;
+  const size_t model_len = strlen(tuning_db.model);
+  char key[CEED_TUNING_LINE_LEN];
+
+  if (strncmp(line, tuning_db.model, model_len) || line[model_len] != '\t')
+    return CEED_ERROR_SUCCESS;
+  snprintf(key, sizeof(key), "%s", &line[model_len+1]);
+  char *value = strchr(key, '\t');
+  if (!value) return CEED_ERROR_SUCCESS;
+  *value++ = '\0';
+  ierr = CeedBackendTuningSetEntry(key, atoi(value)); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Clear the cache, reading the CPU model on first use; caller holds lock
+//------------------------------------------------------------------------------
+static int CeedBackendTuningResetCache(void) {
+  int ierr;
+
+  if (!tuning_db.has_model) {
+    ierr = CeedBackendTuningGetCPUModel(tuning_db.model,
+                                        sizeof(tuning_db.model));
+    CeedChkBackend(ierr);
+    tuning_db.has_model = true;
+  }
+  tuning_db.is_loaded = false;
+  tuning_db.num_entries = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Mark the cache as matching the current database file; caller holds lock
+//------------------------------------------------------------------------------
+static void CeedBackendTuningSetLoaded(const char *path) {
+  // A missing database is cached as empty
+  if (stat(path, &tuning_db.file_stat))
+    memset(&tuning_db.file_stat, 0, sizeof(tuning_db.file_stat));
+  snprintf(tuning_db.path, sizeof(tuning_db.path), "%s", path);
+  tuning_db.is_loaded = true;
+}
+
+//------------------------------------------------------------------------------
+// Parse the database into the cache, if not already cached; caller holds lock
+//------------------------------------------------------------------------------
+static int CeedBackendTuningLoad(const char *path) {
+  int ierr;
+  char line[CEED_TUNING_LINE_LEN];
+  struct stat file_stat;
+
+  if (stat(path, &file_stat)) memset(&file_stat, 0, sizeof(file_stat));
+  if (tuning_db.is_loaded && !strcmp(tuning_db.path, path) &&
+      !CeedBackendTuningFileChanged(&file_stat))
+    return CEED_ERROR_SUCCESS;
+
+  ierr = CeedBackendTuningResetCache(); CeedChkBackend(ierr);
+  FILE *db = fopen(path, "r");
+  if (db) {
+    while (fgets(line, sizeof(line), db)) {
+      ierr = CeedBackendTuningCacheLine(line);
+      if (ierr) {
+        // LCOV_EXCL_START
+        fclose(db);
+        return ierr;
+        // LCOV_EXCL_STOP
+      }
+    }
+    fclose(db);
+  }
+  CeedBackendTuningSetLoaded(path);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Look up tuned value; later entries override earlier ones
+//------------------------------------------------------------------------------
+int CeedBackendTuningLookup(Ceed ceed, const char *key, CeedInt *value,
+                            bool *found) {
+  int ierr;
+  const char *path;
+
+  *found = false;
+  ierr = CeedBackendTuningGetPath(&path); CeedChkBackend(ierr);
+  if (!path) return CEED_ERROR_SUCCESS;
+
+  CeedBackendTuningLock();
+  ierr = CeedBackendTuningLoad(path);
+  for (CeedInt i=0; !ierr && i<tuning_db.num_entries; i++)
+    if (!strcmp(tuning_db.entries[i].key, key)) {
+      *value = tuning_db.entries[i].value;
+      *found = true;
+    }
+  CeedBackendTuningUnlock();
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Write the new value to the database, caching the entries copied from the old
+//   database on the way; caller holds lock
+//------------------------------------------------------------------------------
+static int CeedBackendTuningWrite(const char *path, const char *key,
+                                  CeedInt value) {
+  int ierr;
+  char line[CEED_TUNING_LINE_LEN], tmp_path[CEED_TUNING_LINE_LEN];
+
+  // A read-only database only disables persistence, not the tuned choice
+  snprintf(tmp_path, sizeof(tmp_path), "%s.%ld", path, (long)getpid());
+  FILE *tmp = fopen(tmp_path, "w");
+  if (!tmp) {
+    ierr = CeedBackendTuningLoad(path); CeedChkBackend(ierr);
+    ierr = CeedBackendTuningSetEntry(key, value); CeedChkBackend(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+  ierr = CeedBackendTuningResetCache(); CeedChkBackend(ierr);
+  FILE *db = fopen(path, "r");
+  if (db) {
+    while (!ierr && fgets(line, sizeof(line), db))
+      if (!CeedBackendTuningMatchLine(line, tuning_db.model, key)) {
+        fputs(line, tmp);
+        ierr = CeedBackendTuningCacheLine(line);
+      }
+    fclose(db);
+  }
+  if (!ierr) ierr = CeedBackendTuningSetEntry(key, value);
+  if (ierr) {
+    // LCOV_EXCL_START
+    fclose(tmp);
+    remove(tmp_path);
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+  fprintf(tmp, "%s\t%s\t%d\n", tuning_db.model, key, value);
+  if (fclose(tmp) || rename(tmp_path, path)) remove(tmp_path);
+  CeedBackendTuningSetLoaded(path);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Store tuned value, replacing any earlier entry for the same CPU model and key
+//   The database is rewritten to a temporary file that is renamed over it, so
+//   concurrent readers see either the old or the new database
+//------------------------------------------------------------------------------
+int CeedBackendTuningStore(Ceed ceed, const char *key, CeedInt value) {
+  int ierr;
+  const char *path;
+
+  ierr = CeedBackendTuningGetPath(&path); CeedChkBackend(ierr);
+  if (!path) return CEED_ERROR_SUCCESS;
+
+  CeedBackendTuningLock();
+  ierr = CeedBackendTuningWrite(path, key, value);
+  CeedBackendTuningUnlock();
+  CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Wall clock time in seconds
+//------------------------------------------------------------------------------
+int CeedBackendTuningGetTime(double *time) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  *time = ts.tv_sec + 1e-9*ts.tv_nsec;
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
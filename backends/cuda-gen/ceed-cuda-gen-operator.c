@@ -190,7 +190,8 @@ static int CeedOperatorApplyAdd_Cuda_gen(CeedOperator op, CeedVector invec,
   CeedQFunctionContext ctx;
   ierr = CeedQFunctionGetInnerContext(qf, &ctx); CeedChkBackend(ierr);
   if (ctx) {
-    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_DEVICE, &qf_data->d_c);
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_DEVICE,
+                                           &qf_data->d_c);
     CeedChkBackend(ierr);
   }
 
@@ -254,7 +255,7 @@ static int CeedOperatorApplyAdd_Cuda_gen(CeedOperator op, CeedVector invec,
 
   // Restore context data
   if (ctx) {
-    ierr = CeedQFunctionContextRestoreData(ctx, &qf_data->d_c);
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &qf_data->d_c);
     CeedChkBackend(ierr);
   }
   return CEED_ERROR_SUCCESS;
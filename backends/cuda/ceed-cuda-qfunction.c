@@ -56,7 +56,8 @@ static int CeedQFunctionApply_Cuda(CeedQFunction qf, CeedInt Q,
   CeedQFunctionContext ctx;
   ierr = CeedQFunctionGetInnerContext(qf, &ctx); CeedChkBackend(ierr);
   if (ctx) {
-    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_DEVICE, &data->d_c);
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_DEVICE,
+                                           &data->d_c);
     CeedChkBackend(ierr);
   }
 
@@ -77,7 +78,7 @@ static int CeedQFunctionApply_Cuda(CeedQFunction qf, CeedInt Q,
 
   // Restore context
   if (ctx) {
-    ierr = CeedQFunctionContextRestoreData(ctx, &data->d_c);
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &data->d_c);
     CeedChkBackend(ierr);
   }
   return CEED_ERROR_SUCCESS;
@@ -32,17 +32,28 @@ static inline size_t bytes(const CeedQFunctionContext ctx) {
 
 //------------------------------------------------------------------------------
 // Sync host to device
+//   Only the bytes modified since the last sync are copied, unless the device
+//   buffer is newly allocated
 //------------------------------------------------------------------------------
 static inline int CeedQFunctionContextSyncH2D_Cuda(
-  const CeedQFunctionContext ctx) {
+  const CeedQFunctionContext ctx, bool is_new) {
   int ierr;
   Ceed ceed;
   ierr = CeedQFunctionContextGetCeed(ctx, &ceed); CeedChkBackend(ierr);
   CeedQFunctionContext_Cuda *impl;
   ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChkBackend(ierr);
 
-  ierr = cudaMemcpy(impl->d_data, impl->h_data, bytes(ctx),
-                    cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+  size_t begin = 0, end = bytes(ctx);
+  if (!is_new) {
+    ierr = CeedQFunctionContextGetDirtyRange(ctx, &begin, &end);
+    CeedChkBackend(ierr);
+  }
+  if (end > begin) {
+    ierr = cudaMemcpy((char *)impl->d_data + begin,
+                      (char *)impl->h_data + begin, end - begin,
+                      cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+  }
+  ierr = CeedQFunctionContextClearDirtyRange(ctx); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -166,6 +177,7 @@ static int CeedQFunctionContextTakeData_Cuda(const CeedQFunctionContext ctx,
   // LCOV_EXCL_STOP
 
   // Sync array to requested memtype and update pointer
+  bool is_new = false;
   switch (mtype) {
   case CEED_MEM_HOST:
     if (impl->h_data == NULL) {
@@ -186,9 +198,10 @@ static int CeedQFunctionContextTakeData_Cuda(const CeedQFunctionContext ctx,
       ierr = cudaMalloc((void **)&impl->d_data_allocated, bytes(ctx));
       CeedChk_Cu(ceed, ierr);
       impl->d_data = impl->d_data_allocated;
+      is_new = true;
     }
     if (impl->memState == CEED_CUDA_HOST_SYNC) {
-      ierr = CeedQFunctionContextSyncH2D_Cuda(ctx); CeedChkBackend(ierr);
+      ierr = CeedQFunctionContextSyncH2D_Cuda(ctx, is_new); CeedChkBackend(ierr);
     }
     impl->memState = CEED_CUDA_DEVICE_SYNC;
     *(void **)data = impl->d_data;
@@ -215,6 +228,7 @@ static int CeedQFunctionContextGetData_Cuda(const CeedQFunctionContext ctx,
   // LCOV_EXCL_STOP
 
   // Sync array to requested memtype and update pointer
+  bool is_new = false;
   switch (mtype) {
   case CEED_MEM_HOST:
     if (impl->h_data == NULL) {
@@ -233,9 +247,10 @@ static int CeedQFunctionContextGetData_Cuda(const CeedQFunctionContext ctx,
       ierr = cudaMalloc((void **)&impl->d_data_allocated, bytes(ctx));
       CeedChk_Cu(ceed, ierr);
       impl->d_data = impl->d_data_allocated;
+      is_new = true;
     }
     if (impl->memState == CEED_CUDA_HOST_SYNC) {
-      ierr = CeedQFunctionContextSyncH2D_Cuda(ctx); CeedChkBackend(ierr);
+      ierr = CeedQFunctionContextSyncH2D_Cuda(ctx, is_new); CeedChkBackend(ierr);
     }
     impl->memState = CEED_CUDA_DEVICE_SYNC;
     *(void **)data = impl->d_data;
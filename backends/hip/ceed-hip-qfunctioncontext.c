@@ -32,17 +32,28 @@ static inline size_t bytes(const CeedQFunctionContext ctx) {
 
 //------------------------------------------------------------------------------
 // Sync host to device
+//   Only the bytes modified since the last sync are copied, unless the device
+//   buffer is newly allocated
 //------------------------------------------------------------------------------
 static inline int CeedQFunctionContextSyncH2D_Hip(
-  const CeedQFunctionContext ctx) {
+  const CeedQFunctionContext ctx, bool is_new) {
   int ierr;
   Ceed ceed;
   ierr = CeedQFunctionContextGetCeed(ctx, &ceed); CeedChkBackend(ierr);
   CeedQFunctionContext_Hip *impl;
   ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChkBackend(ierr);
 
-  ierr = hipMemcpy(impl->d_data, impl->h_data, bytes(ctx),
-                   hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
+  size_t begin = 0, end = bytes(ctx);
+  if (!is_new) {
+    ierr = CeedQFunctionContextGetDirtyRange(ctx, &begin, &end);
+    CeedChkBackend(ierr);
+  }
+  if (end > begin) {
+    ierr = hipMemcpy((char *)impl->d_data + begin,
+                     (char *)impl->h_data + begin, end - begin,
+                     hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
+  }
+  ierr = CeedQFunctionContextClearDirtyRange(ctx); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -164,6 +175,7 @@ static int CeedQFunctionContextTakeData_Hip(const CeedQFunctionContext ctx,
   // LCOV_EXCL_STOP
 
   // Sync array to requested memtype and update pointer
+  bool is_new = false;
   switch (mtype) {
   case CEED_MEM_HOST:
     if (impl->h_data == NULL) {
@@ -184,9 +196,10 @@ static int CeedQFunctionContextTakeData_Hip(const CeedQFunctionContext ctx,
       ierr = hipMalloc((void **)&impl->d_data_allocated, bytes(ctx));
       CeedChk_Hip(ceed, ierr);
       impl->d_data = impl->d_data_allocated;
+      is_new = true;
     }
     if (impl->memState == CEED_HIP_HOST_SYNC) {
-      ierr = CeedQFunctionContextSyncH2D_Hip(ctx); CeedChkBackend(ierr);
+      ierr = CeedQFunctionContextSyncH2D_Hip(ctx, is_new); CeedChkBackend(ierr);
     }
     impl->memState = CEED_HIP_DEVICE_SYNC;
     *(void **)data = impl->d_data;
@@ -213,6 +226,7 @@ static int CeedQFunctionContextGetData_Hip(const CeedQFunctionContext ctx,
   // LCOV_EXCL_STOP
 
   // Sync array to requested memtype and update pointer
+  bool is_new = false;
   switch (mtype) {
   case CEED_MEM_HOST:
     if (impl->h_data == NULL) {
@@ -231,9 +245,10 @@ static int CeedQFunctionContextGetData_Hip(const CeedQFunctionContext ctx,
       ierr = hipMalloc((void **)&impl->d_data_allocated, bytes(ctx));
       CeedChk_Hip(ceed, ierr);
       impl->d_data = impl->d_data_allocated;
+      is_new = true;
     }
     if (impl->memState == CEED_HIP_HOST_SYNC) {
-      ierr = CeedQFunctionContextSyncH2D_Hip(ctx); CeedChkBackend(ierr);
+      ierr = CeedQFunctionContextSyncH2D_Hip(ctx, is_new); CeedChkBackend(ierr);
     }
     impl->memState = CEED_HIP_DEVICE_SYNC;
     *(void **)data = impl->d_data;
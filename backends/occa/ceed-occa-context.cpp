@@ -42,5 +42,29 @@ namespace ceed {
     bool Context::usingGpuDevice() const {
       return _usingGpuDevice;
     }
+
+    ::occa::kernel Context::buildKernel(const std::string &kernelSource,
+                                        const std::string &kernelName,
+                                        const ::occa::properties &props) {
+      // Operators with identical generated source share a single kernel.
+      // OCCA keys its on-disk binary cache on the same content, so a kernel
+      // missing here is only compiled if no earlier run has built it.
+      const std::string hash = (
+        ::occa::hash(kernelSource)
+        ^ ::occa::hash(kernelName)
+        ^ props.hash()
+      ).getFullString();
+
+      std::map<std::string, ::occa::kernel>::iterator it = _kernelCache.find(hash);
+      if (it != _kernelCache.end()) {
+        return it->second;
+      }
+
+      ::occa::kernel kernel = device.buildKernelFromString(kernelSource,
+                                                           kernelName,
+                                                           props);
+      _kernelCache[hash] = kernel;
+      return kernel;
+    }
   }
 }
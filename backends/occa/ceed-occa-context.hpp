@@ -17,6 +17,8 @@
 #ifndef CEED_OCCA_CONTEXT_HEADER
 #define CEED_OCCA_CONTEXT_HEADER
 
+#include <map>
+
 #include "ceed-occa-types.hpp"
 
 namespace ceed {
@@ -26,6 +28,9 @@ namespace ceed {
       bool _usingCpuDevice;
       bool _usingGpuDevice;
 
+      // Kernels built on this device, keyed on a hash of their source and props
+      std::map<std::string, ::occa::kernel> _kernelCache;
+
      public:
       ::occa::device device;
 
@@ -35,6 +40,10 @@ namespace ceed {
 
       bool usingCpuDevice() const;
       bool usingGpuDevice() const;
+
+      ::occa::kernel buildKernel(const std::string &kernelSource,
+                                 const std::string &kernelName,
+                                 const ::occa::properties &props);
     };
   }
 }
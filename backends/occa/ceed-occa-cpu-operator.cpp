@@ -15,6 +15,9 @@
 // testbed platforms, in support of the nation's exascale computing imperative.
 #define CEED_DEBUG_COLOR 12
 
+#include <algorithm>
+
+#include "ceed-occa-context.hpp"
 #include "ceed-occa-cpu-operator.hpp"
 #include "ceed-occa-elem-restriction.hpp"
 #include "ceed-occa-qfunction.hpp"
@@ -26,6 +29,19 @@
 
 namespace ceed {
   namespace occa {
+    static bool basisSourceLess(const Basis *a, const Basis *b) {
+      if (a->isTensorBasis() != b->isTensorBasis()) {
+        return a->isTensorBasis();
+      }
+      if (a->dim != b->dim) {
+        return a->dim < b->dim;
+      }
+      if (a->P != b->P) {
+        return a->P < b->P;
+      }
+      return a->Q < b->Q;
+    }
+
     CpuOperator::CpuOperator() {}
 
     CpuOperator::~CpuOperator() {}
@@ -241,10 +257,9 @@ namespace ceed {
 
       CeedDebug(kernelSource.c_str());
 
-      // TODO: Store a kernel per Q
-      return getDevice().buildKernelFromString(kernelSource,
-                                               "applyAdd",
-                                               getKernelProps());
+      return Context::from(ceed)->buildKernel(kernelSource,
+                                              "applyAdd",
+                                              getKernelProps());
     }
 
     //---[ Kernel Generation ]--------------------
@@ -257,6 +272,10 @@ namespace ceed {
         addBasisIfMissingSource(sourceBasis, args.getOpOutput(i).basis);
       }
 
+      // Order basis sources independently of the field order so operators
+      //   with the same bases generate the same kernel source
+      std::sort(sourceBasis.begin(), sourceBasis.end(), basisSourceLess);
+
       // Make sure there's a break between past code
       ss << std::endl;
 
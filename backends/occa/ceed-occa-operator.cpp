@@ -78,8 +78,9 @@ namespace ceed {
     }
 
     int Operator::applyAdd(Vector *in, Vector *out, CeedRequest *request) {
-      // TODO: Cache kernel objects rather than relying on OCCA kernel caching
-      applyAddKernel = buildApplyAddKernel();
+      if (!applyAddKernel.isInitialized()) {
+        applyAddKernel = buildApplyAddKernel();
+      }
 
       if (needsInitialSetup) {
         initialSetup();
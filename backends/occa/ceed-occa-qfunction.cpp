@@ -16,6 +16,7 @@
 
 #include <sstream>
 
+#include "ceed-occa-context.hpp"
 #include "ceed-occa-qfunction.hpp"
 #include "ceed-occa-qfunctioncontext.hpp"
 #include "ceed-occa-vector.hpp"
@@ -119,9 +120,9 @@ namespace ceed {
         const std::string kernelName = "qFunctionKernel";
 
         qFunctionKernel = (
-          getDevice().buildKernelFromString(getKernelSource(kernelName, Q),
-                                            kernelName,
-                                            props)
+          Context::from(ceed)->buildKernel(getKernelSource(kernelName, Q),
+                                           kernelName,
+                                           props)
         );
       }
 
@@ -56,6 +56,8 @@ namespace ceed {
       int ierr;
       ierr = CeedVectorGetCeed(vec, &vector->ceed); CeedOccaFromChk(ierr);
       ierr = CeedVectorGetLength(vec, &vector->length); CeedOccaFromChk(ierr);
+      // Kernels read the device memory directly
+      ierr = CeedVectorMaterialize(vec); CeedOccaFromChk(ierr);
 
       return vector;
     }
@@ -16,6 +16,7 @@
 
  #warning "libCEED OCCA backend is experimental; for best performance, use device native backends"
 
+#include <cstdlib>
 #include <map>
 #include <vector>
 #include <occa.hpp>
@@ -272,6 +273,12 @@ namespace ceed {
       ::occa::properties deviceProps(devicePropsStr);
       setDefaultProps(deviceProps, mode);
 
+      // Persistent cache of compiled kernels, shared between runs
+      const char *cacheDir = getenv("CEED_OCCA_CACHE_DIR");
+      if (cacheDir && cacheDir[0]) {
+        ::occa::env::setOccaCacheDir(cacheDir);
+      }
+
       ceed::occa::Context *context = new Context(::occa::device(deviceProps));
       ierr = CeedSetData(ceed, context); CeedChkBackend(ierr);
 
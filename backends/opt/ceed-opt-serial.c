@@ -44,6 +44,7 @@ static int CeedInit_Opt_Serial(const char *resource, Ceed ceed) {
                      "Opt backend cannot use resource: %s", resource);
   // LCOV_EXCL_STOP
   ierr = CeedSetDeterministic(ceed, true); CeedChkBackend(ierr);
+  ierr = CeedSetCompressedQDataSupport(ceed, true); CeedChkBackend(ierr);
 
   // Create reference CEED that implementation will be dispatched
   //   through unless overridden
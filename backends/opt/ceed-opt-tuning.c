@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed/ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ceed-opt.h"
+#include "../ceed-backend-tuning.h"
+
+// Length of tuning database keys
+#define CEED_OPT_TUNING_KEY_LEN 512
+
+//------------------------------------------------------------------------------
+// Time basis actions used by operator apply for a given block size
+//------------------------------------------------------------------------------
+static int CeedOptTuningTimeBasis(CeedBasis basis, CeedInt blk_size,
+                                  CeedInt num_elem, double *time) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChkBackend(ierr);
+  CeedInt dim, num_comp, P, Q;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &P); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &Q); CeedChkBackend(ierr);
+  CeedVector u, v, u_out, v_out;
+  ierr = CeedVectorCreate(ceed, blk_size*num_comp*P, &u); CeedChkBackend(ierr);
+  ierr = CeedVectorCreate(ceed, blk_size*num_comp*P, &u_out);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorCreate(ceed, blk_size*num_comp*Q*dim, &v);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorCreate(ceed, blk_size*num_comp*Q*dim, &v_out);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorSetValue(u, 1.0); CeedChkBackend(ierr);
+  ierr = CeedVectorSetValue(v, 1.0); CeedChkBackend(ierr);
+
+  // Best of several trials to filter out noise
+  const CeedInt num_blks = (num_elem + blk_size - 1)/blk_size;
+  *time = -1.0;
+  for (CeedInt trial=0; trial<3; trial++) {
+    double start, end;
+    ierr = CeedBackendTuningGetTime(&start); CeedChkBackend(ierr);
+    for (CeedInt b=0; b<num_blks; b++) {
+      ierr = CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_GRAD,
+                            u, v_out); CeedChkBackend(ierr);
+      ierr = CeedBasisApply(basis, blk_size, CEED_TRANSPOSE, CEED_EVAL_GRAD,
+                            v, u_out); CeedChkBackend(ierr);
+    }
+    ierr = CeedBackendTuningGetTime(&end); CeedChkBackend(ierr);
+    if (*time < 0 || end - start < *time) *time = end - start;
+  }
+
+  ierr = CeedVectorDestroy(&u); CeedChkBackend(ierr);
+  ierr = CeedVectorDestroy(&v); CeedChkBackend(ierr);
+  ierr = CeedVectorDestroy(&u_out); CeedChkBackend(ierr);
+  ierr = CeedVectorDestroy(&v_out); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Select operator block size from tuning database or by benchmarking
+//------------------------------------------------------------------------------
+int CeedOptTuneBlockSize(CeedOperator op, CeedInt *blk_size) {
+  int ierr;
+  Ceed ceed, ceed_parent;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  ierr = CeedGetParent(ceed, &ceed_parent); CeedChkBackend(ierr);
+  CeedInt num_input_fields;
+  CeedOperatorField *op_input_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, NULL,
+                               NULL); CeedChkBackend(ierr);
+
+  // Only tensor bases of active inputs are tuned
+  CeedBasis basis = NULL;
+  for (CeedInt i=0; i<num_input_fields && !basis; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
+      CeedChkBackend(ierr);
+    }
+  }
+  if (!basis || basis == CEED_BASIS_COLLOCATED) return CEED_ERROR_SUCCESS;
+  bool is_tensor;
+  ierr = CeedBasisIsTensor(basis, &is_tensor); CeedChkBackend(ierr);
+  if (!is_tensor) return CEED_ERROR_SUCCESS;
+
+  // Tuning key
+  const char *resource;
+  ierr = CeedGetResource(ceed_parent, &resource); CeedChkBackend(ierr);
+  CeedInt dim, num_comp, P_1d, Q_1d;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumNodes1D(basis, &P_1d); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d); CeedChkBackend(ierr);
+  char key[CEED_OPT_TUNING_KEY_LEN];
+  snprintf(key, sizeof(key), "%s:blk_size:dim=%d:P=%d:Q=%d:num_comp=%d",
+           resource, dim, P_1d, Q_1d, num_comp);
+
+  // Check database, only for block sizes supported by the opt operator
+  const CeedInt candidates[] = {1, 8},
+                num_candidates = sizeof(candidates)/sizeof(candidates[0]);
+  CeedInt value;
+  bool found, is_enabled;
+  ierr = CeedBackendTuningLookup(ceed, key, &value, &found); CeedChkBackend(ierr);
+  for (CeedInt i=0; found && i<num_candidates; i++)
+    if (value == candidates[i]) {
+      *blk_size = value;
+      return CEED_ERROR_SUCCESS;
+    }
+  ierr = CeedBackendTuningIsEnabled(&is_enabled); CeedChkBackend(ierr);
+  if (!is_enabled) return CEED_ERROR_SUCCESS;
+
+  // Benchmark same number of elements for each candidate
+  const CeedInt num_elem = 128;
+  double best_time = -1.0;
+  for (CeedInt i=0; i<num_candidates; i++) {
+    double time = 0.0;
+    ierr = CeedOptTuningTimeBasis(basis, candidates[i], num_elem, &time);
+    CeedChkBackend(ierr);
+    if (best_time < 0 || time < best_time) {
+      best_time = time;
+      *blk_size = candidates[i];
+    }
+  }
+  ierr = CeedBackendTuningStore(ceed, key, *blk_size); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
@@ -32,6 +32,7 @@ typedef struct {
 
 typedef struct {
   bool is_identity_qf, is_identity_restr_op;
+  CeedInt blk_size;        /* Element block size, may be tuned in setup */
   CeedElemRestriction *blk_restr; /* Blocked versions of restrictions */
   CeedVector
   *e_vecs;   /* E-vectors needed to apply operator (input followed by outputs) */
@@ -44,11 +45,14 @@ typedef struct {
   CeedInt    num_e_vecs_in;
   CeedInt    num_e_vecs_out;
   CeedInt    qf_num_active_in, qf_num_active_out;
-  CeedVector *qf_active_in;
+  CeedVector *qf_q_vecs_in;   /* Q-vectors with all linearization directions */
+  CeedVector *qf_q_vecs_out;
   CeedVector qf_lvec;
   CeedElemRestriction qf_blk_rstr;
 } CeedOperator_Opt;
 
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
 
+CEED_INTERN int CeedOptTuneBlockSize(CeedOperator op, CeedInt *blk_size);
+
 #endif // _ceed_opt_h
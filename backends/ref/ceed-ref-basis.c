@@ -305,6 +305,123 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Basis Apply At Points
+//------------------------------------------------------------------------------
+static int CeedBasisApplyAtPoints_Ref(CeedBasis basis, CeedInt num_elem,
+                                      CeedInt num_points,
+                                      CeedTransposeMode t_mode,
+                                      CeedEvalMode eval_mode,
+                                      CeedVector X_ref, CeedVector U,
+                                      CeedVector V) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChkBackend(ierr);
+  CeedInt dim, num_comp, num_nodes, P_1d;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &num_nodes); CeedChkBackend(ierr);
+  ierr = CeedBasisGetNumNodes1D(basis, &P_1d); CeedChkBackend(ierr);
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
+  if (!impl->chebyshev_interp_1d)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Evaluation at points requires Q_1d >= P_1d");
+  // LCOV_EXCL_STOP
+  const CeedInt num_eval = eval_mode == CEED_EVAL_GRAD ? dim : 1;
+  const CeedScalar *x, *u;
+  CeedScalar *v;
+  ierr = CeedVectorGetArrayRead(X_ref, CEED_MEM_HOST, &x); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArray(V, CEED_MEM_HOST, &v); CeedChkBackend(ierr);
+
+  // Clear v if operating in transpose
+  if (t_mode == CEED_TRANSPOSE) {
+    const CeedInt v_size = num_elem*num_comp*num_nodes;
+    for (CeedInt i = 0; i < v_size; i++)
+      v[i] = (CeedScalar) 0.0;
+  }
+
+  CeedScalar chebyshev_x[P_1d], chebyshev_dx[P_1d];
+  CeedScalar interp_1d[dim][P_1d], grad_1d[dim][P_1d];
+  CeedScalar tmp[2][num_nodes];
+  const CeedScalar *C = impl->chebyshev_interp_1d;
+  for (CeedInt e=0; e<num_elem; e++) {
+    for (CeedInt p=0; p<num_points; p++) {
+      // 1D basis functions and derivatives at each coordinate of the point
+      for (CeedInt d=0; d<dim; d++) {
+        const CeedScalar x_d = x[(d*num_points + p)*num_elem + e];
+        chebyshev_x[0] = 1.0;
+        chebyshev_dx[0] = 0.0;
+        if (P_1d > 1) {
+          chebyshev_x[1] = x_d;
+          chebyshev_dx[1] = 1.0;
+        }
+        for (CeedInt k=2; k<P_1d; k++) {
+          chebyshev_x[k] = 2*x_d*chebyshev_x[k-1] - chebyshev_x[k-2];
+          chebyshev_dx[k] = 2*chebyshev_x[k-1] + 2*x_d*chebyshev_dx[k-1] -
+                            chebyshev_dx[k-2];
+        }
+        for (CeedInt j=0; j<P_1d; j++) {
+          interp_1d[d][j] = 0.0;
+          grad_1d[d][j] = 0.0;
+          for (CeedInt k=0; k<P_1d; k++) {
+            interp_1d[d][j] += chebyshev_x[k]*C[j+P_1d*k];
+            grad_1d[d][j] += chebyshev_dx[k]*C[j+P_1d*k];
+          }
+        }
+      }
+      for (CeedInt c=0; c<num_comp; c++) {
+        for (CeedInt i=0; i<num_eval; i++) {
+          const CeedInt point_index = ((i*num_comp + c)*num_points + p)*num_elem
+                                      + e;
+          if (t_mode == CEED_NOTRANSPOSE) {
+            // Contract the fastest node index with one dimension at a time
+            CeedInt size = num_nodes;
+            for (CeedInt n=0; n<num_nodes; n++)
+              tmp[0][n] = u[(c*num_nodes + n)*num_elem + e];
+            for (CeedInt d=0; d<dim; d++) {
+              const bool is_grad = eval_mode == CEED_EVAL_GRAD && d == i;
+              const CeedScalar *b = is_grad ? grad_1d[d] : interp_1d[d];
+              const CeedScalar *in = tmp[d%2];
+              CeedScalar *out = tmp[(d+1)%2];
+              size /= P_1d;
+              for (CeedInt r=0; r<size; r++) {
+                out[r] = 0.0;
+                for (CeedInt j=0; j<P_1d; j++)
+                  out[r] += b[j]*in[j + P_1d*r];
+              }
+            }
+            v[point_index] = tmp[dim%2][0];
+          } else {
+            // Expand from the slowest node index back to the fastest
+            CeedInt size = 1;
+            tmp[0][0] = u[point_index];
+            for (CeedInt d=dim-1; d>=0; d--) {
+              const bool is_grad = eval_mode == CEED_EVAL_GRAD && d == i;
+              const CeedScalar *b = is_grad ? grad_1d[d] : interp_1d[d];
+              const CeedScalar *in = tmp[(dim-1-d)%2];
+              CeedScalar *out = tmp[(dim-d)%2];
+              for (CeedInt r=0; r<size; r++)
+                for (CeedInt j=0; j<P_1d; j++)
+                  out[j + P_1d*r] = b[j]*in[r];
+              size *= P_1d;
+            }
+            for (CeedInt n=0; n<num_nodes; n++)
+              v[(c*num_nodes + n)*num_elem + e] += tmp[dim%2][n];
+          }
+        }
+      }
+    }
+  }
+
+  ierr = CeedVectorRestoreArrayRead(X_ref, &x); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(U, &u); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(V, &v); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Basis Create Non-Tensor
 //------------------------------------------------------------------------------
@@ -340,6 +457,7 @@ static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
   CeedBasis_Ref *impl;
   ierr = CeedBasisGetData(basis, &impl); CeedChkBackend(ierr);
   ierr = CeedFree(&impl->collograd1d); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->chebyshev_interp_1d); CeedChkBackend(ierr);
   ierr = CeedFree(&impl); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
@@ -376,6 +494,13 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d,
     ierr = CeedBasisGetCollocatedGrad(basis, impl->collograd1d);
     CeedChkBackend(ierr);
   }
+  // Calculate Chebyshev coefficients for evaluation at arbitrary points
+  if (Q_1d >= P_1d) {
+    ierr = CeedMalloc(P_1d*P_1d, &impl->chebyshev_interp_1d);
+    CeedChkBackend(ierr);
+    ierr = CeedBasisGetChebyshevInterp1D(basis, impl->chebyshev_interp_1d);
+    CeedChkBackend(ierr);
+  }
   ierr = CeedBasisSetData(basis, impl); CeedChkBackend(ierr);
 
   Ceed parent;
@@ -386,6 +511,8 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d,
 
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApply_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "ApplyAtPoints",
+                                CeedBasisApplyAtPoints_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
                                 CeedBasisDestroyTensor_Ref); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
@@ -22,6 +22,97 @@
 #include <stdint.h>
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Check if a passive input L-vector can be read in place as an E-vector
+//------------------------------------------------------------------------------
+static int CeedOperatorFieldUseLVector_Ref(CeedOperatorField op_field,
+    bool *use_l_vec) {
+  int ierr;
+  CeedVector vec;
+  CeedElemRestriction elem_restr;
+  bool is_strided, has_backend_strides;
+
+  *use_l_vec = false;
+  ierr = CeedOperatorFieldGetVector(op_field, &vec); CeedChkBackend(ierr);
+  if (vec == CEED_VECTOR_ACTIVE || vec == CEED_VECTOR_NONE)
+    return CEED_ERROR_SUCCESS;
+  ierr = CeedOperatorFieldGetElemRestriction(op_field, &elem_restr);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionIsStrided(elem_restr, &is_strided);
+  CeedChkBackend(ierr);
+  if (!is_strided) return CEED_ERROR_SUCCESS;
+
+  // L-vector layout must match the E-vector layout used by this backend
+  CeedInt num_comp, elem_size, strides[3];
+  ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionHasBackendStrides(elem_restr, &has_backend_strides);
+  CeedChkBackend(ierr);
+  if (has_backend_strides) {
+    ierr = CeedElemRestrictionGetELayout(elem_restr, &strides);
+    CeedChkBackend(ierr);
+  } else {
+    ierr = CeedElemRestrictionGetStrides(elem_restr, &strides);
+    CeedChkBackend(ierr);
+  }
+  *use_l_vec = strides[0] == 1 && strides[1] == elem_size &&
+               strides[2] == elem_size*num_comp;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get the vector a passive input without its own E-vector is read from, if any
+//------------------------------------------------------------------------------
+static int CeedOperatorGetInPlaceInput_Ref(CeedOperator op, CeedInt i,
+    CeedOperatorField op_field, CeedVector *vec) {
+  int ierr;
+  bool use_l_vec;
+  CeedInt blk_size;
+
+  ierr = CeedOperatorFieldUseLVector_Ref(op_field, &use_l_vec);
+  CeedChkBackend(ierr);
+  if (use_l_vec) {
+    ierr = CeedOperatorFieldGetVector(op_field, vec); CeedChkBackend(ierr);
+  } else {
+    // Unblocked E-vector of the operator this fallback was created from
+    ierr = CeedOperatorGetFallbackPassiveEVector(op, i, vec, &blk_size);
+    CeedChkBackend(ierr);
+    if (blk_size != 1) *vec = NULL;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Copy a blocked E-vector of the fallback parent into an E-vector
+//------------------------------------------------------------------------------
+static int CeedOperatorUnblockEVector_Ref(CeedElemRestriction elem_restr,
+    CeedInt blk_size, CeedVector blk_e_vec, CeedVector e_vec) {
+  int ierr;
+  CeedInt num_elem, elem_size, num_comp;
+  const CeedScalar *blk_data;
+  CeedScalar *data;
+
+  ierr = CeedElemRestrictionGetNumElements(elem_restr, &num_elem);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+  CeedChkBackend(ierr);
+  const CeedInt size = elem_size*num_comp;
+
+  ierr = CeedVectorGetArrayRead(blk_e_vec, CEED_MEM_HOST, &blk_data);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorGetArray(e_vec, CEED_MEM_HOST, &data); CeedChkBackend(ierr);
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt j=0; j<size; j++)
+      data[e*size + j] = blk_data[((e/blk_size)*size + j)*blk_size + e%blk_size];
+  ierr = CeedVectorRestoreArray(e_vec, &data); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArrayRead(blk_e_vec, &blk_data); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
@@ -58,9 +149,24 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
     if (eval_mode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(op_fields[i], &elem_restr);
       CeedChkBackend(ierr);
-      ierr = CeedElemRestrictionCreateVector(elem_restr, NULL,
-                                             &full_evecs[i+starte]);
-      CeedChkBackend(ierr);
+      // Active E-vectors are created on first apply, as assembly does not
+      //   use them, passive inputs in E-vector layout or unblocked in the
+      //   fallback parent are read in place, and compressed quadrature data
+      //   is decoded for each element
+      CeedVector vec, in_place_vec = NULL;
+      bool is_compressed = false;
+      ierr = CeedOperatorFieldGetVector(op_fields[i], &vec); CeedChkBackend(ierr);
+      if (!inOrOut && vec != CEED_VECTOR_ACTIVE) {
+        ierr = CeedOperatorFieldIsQDataCompressed(op_fields[i], &is_compressed);
+        CeedChkBackend(ierr);
+        ierr = CeedOperatorGetInPlaceInput_Ref(op, i, op_fields[i],
+                                               &in_place_vec); CeedChkBackend(ierr);
+      }
+      if (vec != CEED_VECTOR_ACTIVE && !in_place_vec && !is_compressed) {
+        ierr = CeedElemRestrictionCreateVector(elem_restr, NULL,
+                                               &full_evecs[i+starte]);
+        CeedChkBackend(ierr);
+      }
     }
 
     switch(eval_mode) {
@@ -177,18 +283,62 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Active E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupActiveEVecs_Ref(CeedOperator op) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  if (impl->is_active_setup_done) return CEED_ERROR_SUCCESS;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedInt num_input_fields, num_output_fields;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields);
+  CeedChkBackend(ierr);
+
+  for (CeedInt i=0; i<num_input_fields + num_output_fields; i++) {
+    bool is_input = i < num_input_fields;
+    CeedOperatorField op_field = is_input ? op_input_fields[i] :
+                                 op_output_fields[i - num_input_fields];
+    CeedQFunctionField qf_field = is_input ? qf_input_fields[i] :
+                                  qf_output_fields[i - num_input_fields];
+    CeedEvalMode eval_mode;
+    CeedVector vec;
+    CeedElemRestriction elem_restr;
+    ierr = CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode);
+    CeedChkBackend(ierr);
+    ierr = CeedOperatorFieldGetVector(op_field, &vec); CeedChkBackend(ierr);
+    if (eval_mode != CEED_EVAL_WEIGHT && vec == CEED_VECTOR_ACTIVE) {
+      ierr = CeedOperatorFieldGetElemRestriction(op_field, &elem_restr);
+      CeedChkBackend(ierr);
+      ierr = CeedElemRestrictionCreateVector(elem_restr, NULL, &impl->e_vecs[i]);
+      CeedChkBackend(ierr);
+    }
+  }
+  impl->is_active_setup_done = true;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
-static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields,
-    CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-    CeedVector in_vec, const bool skip_active, CeedOperator_Ref *impl,
-    CeedRequest *request) {
-  CeedInt ierr;
+static inline int CeedOperatorSetupInputs_Ref(CeedOperator op,
+    CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+    CeedOperatorField *op_input_fields, CeedVector in_vec,
+    const bool skip_active, CeedOperator_Ref *impl, CeedRequest *request) {
+  CeedInt ierr, blk_size;
   CeedEvalMode eval_mode;
-  CeedVector vec;
+  CeedVector vec, blk_e_vec;
   CeedElemRestriction elem_restr;
   uint64_t state;
+  bool is_compressed;
 
   for (CeedInt i=0; i<num_input_fields; i++) {
     // Get input vector
@@ -203,8 +353,17 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields,
 
     ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
     CeedChkBackend(ierr);
+    ierr = CeedOperatorFieldIsQDataCompressed(op_input_fields[i], &is_compressed);
+    CeedChkBackend(ierr);
     // Restrict and Evec
-    if (eval_mode == CEED_EVAL_WEIGHT) { // Skip
+    if (eval_mode == CEED_EVAL_WEIGHT || is_compressed) { // Skip
+    } else if (!impl->e_vecs[i]) {
+      // Passive input in E-vector layout, read in place
+      ierr = CeedOperatorGetInPlaceInput_Ref(op, i, op_input_fields[i], &vec);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST,
+                                    (const CeedScalar **) &impl->e_data[i]);
+      CeedChkBackend(ierr);
     } else {
       // Restrict
       ierr = CeedVectorGetState(vec, &state); CeedChkBackend(ierr);
@@ -212,8 +371,16 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields,
       if (state != impl->input_state[i] || vec == in_vec) {
         ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr);
         CeedChkBackend(ierr);
-        ierr = CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, vec,
-                                        impl->e_vecs[i], request); CeedChkBackend(ierr);
+        // Reuse the blocked E-vector of a fallback parent, if it has one
+        ierr = CeedOperatorGetFallbackPassiveEVector(op, i, &blk_e_vec, &blk_size);
+        CeedChkBackend(ierr);
+        if (vec != in_vec && blk_e_vec) {
+          ierr = CeedOperatorUnblockEVector_Ref(elem_restr, blk_size, blk_e_vec,
+                                                impl->e_vecs[i]); CeedChkBackend(ierr);
+        } else {
+          ierr = CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, vec,
+                                          impl->e_vecs[i], request); CeedChkBackend(ierr);
+        }
         impl->input_state[i] = state;
       }
       // Get evec
@@ -257,11 +424,24 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
     CeedChkBackend(ierr);
     // Basis action
     switch(eval_mode) {
-    case CEED_EVAL_NONE:
-      ierr = CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER, &impl->e_data[i][e*Q*size]);
-      CeedChkBackend(ierr);
-      break;
+    case CEED_EVAL_NONE: {
+      bool is_compressed;
+      ierr = CeedOperatorFieldIsQDataCompressed(op_input_fields[i],
+             &is_compressed); CeedChkBackend(ierr);
+      if (is_compressed) {
+        CeedScalar *q_data;
+        ierr = CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &q_data);
+        CeedChkBackend(ierr);
+        ierr = CeedOperatorFieldDecompressQData(op_input_fields[i], e, 1, q_data);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorRestoreArray(impl->q_vecs_in[i], &q_data);
+        CeedChkBackend(ierr);
+      } else {
+        ierr = CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, &impl->e_data[i][e*Q*size]);
+        CeedChkBackend(ierr);
+      }
+    } break;
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
       CeedChkBackend(ierr);
@@ -374,11 +554,13 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
 //------------------------------------------------------------------------------
 // Restore Input Vectors
 //------------------------------------------------------------------------------
-static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields,
-    CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-    const bool skip_active, CeedOperator_Ref *impl) {
+static inline int CeedOperatorRestoreInputs_Ref(CeedOperator op,
+    CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+    CeedOperatorField *op_input_fields, const bool skip_active,
+    CeedOperator_Ref *impl) {
   CeedInt ierr;
   CeedEvalMode eval_mode;
+  bool is_compressed;
 
   for (CeedInt i=0; i<num_input_fields; i++) {
     // Skip active inputs
@@ -392,7 +574,16 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields,
     // Restore input
     ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
     CeedChkBackend(ierr);
-    if (eval_mode == CEED_EVAL_WEIGHT) { // Skip
+    ierr = CeedOperatorFieldIsQDataCompressed(op_input_fields[i], &is_compressed);
+    CeedChkBackend(ierr);
+    if (eval_mode == CEED_EVAL_WEIGHT || is_compressed) { // Skip
+    } else if (!impl->e_vecs[i]) {
+      CeedVector vec;
+      ierr = CeedOperatorGetInPlaceInput_Ref(op, i, op_input_fields[i], &vec);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorRestoreArrayRead(vec,
+                                        (const CeedScalar **) &impl->e_data[i]);
+      CeedChkBackend(ierr);
     } else {
       ierr = CeedVectorRestoreArrayRead(impl->e_vecs[i],
                                         (const CeedScalar **) &impl->e_data[i]);
@@ -403,10 +594,49 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Output Restriction
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
-                                    CeedVector out_vec, CeedRequest *request) {
+static inline int CeedOperatorOutputRestriction_Ref(CeedInt i,
+    CeedOperatorField *op_output_fields, CeedVector e_vec, CeedVector out_vec,
+    bool is_overwrite, CeedRequest *request) {
+  int ierr;
+  CeedVector vec;
+  CeedElemRestriction elem_restr;
+
+  // Get output vector
+  ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+  CeedChkBackend(ierr);
+  // Active
+  if (vec == CEED_VECTOR_ACTIVE)
+    vec = out_vec;
+  // Only the first field writing to a vector overwrites it
+  for (CeedInt j=0; is_overwrite && j<i; j++) {
+    CeedVector vec_j;
+    ierr = CeedOperatorFieldGetVector(op_output_fields[j], &vec_j);
+    CeedChkBackend(ierr);
+    if (vec_j == CEED_VECTOR_ACTIVE)
+      vec_j = out_vec;
+    is_overwrite = vec_j != vec;
+  }
+  // Restrict
+  ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_restr);
+  CeedChkBackend(ierr);
+  if (is_overwrite) {
+    ierr = CeedElemRestrictionApplyTransposeOverwrite(elem_restr, e_vec, vec,
+           request); CeedChkBackend(ierr);
+  } else {
+    ierr = CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE, e_vec, vec,
+                                    request); CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Core
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyCore_Ref(CeedOperator op, CeedVector in_vec,
+                                     CeedVector out_vec, bool is_overwrite,
+                                     CeedRequest *request) {
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
@@ -424,11 +654,11 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
                                 &qf_output_fields);
   CeedChkBackend(ierr);
   CeedEvalMode eval_mode;
-  CeedVector vec;
   CeedElemRestriction elem_restr;
 
   // Setup
   ierr = CeedOperatorSetup_Ref(op); CeedChkBackend(ierr);
+  ierr = CeedOperatorSetupActiveEVecs_Ref(op); CeedChkBackend(ierr);
 
   // Restriction only operator
   if (impl->is_identity_restr_op) {
@@ -436,15 +666,13 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
     CeedChkBackend(ierr);
     ierr = CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, in_vec,
                                     impl->e_vecs[0], request); CeedChkBackend(ierr);
-    ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_restr);
-    CeedChkBackend(ierr);
-    ierr = CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE, impl->e_vecs[0],
-                                    out_vec, request); CeedChkBackend(ierr);
+    ierr = CeedOperatorOutputRestriction_Ref(0, op_output_fields,
+           impl->e_vecs[0], out_vec, is_overwrite, request); CeedChkBackend(ierr);
     return CEED_ERROR_SUCCESS;
   }
 
   // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields,
+  ierr = CeedOperatorSetupInputs_Ref(op, num_input_fields, qf_input_fields,
                                      op_input_fields, in_vec, false, impl,
                                      request); CeedChkBackend(ierr);
 
@@ -493,25 +721,664 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
     ierr = CeedVectorRestoreArray(impl->e_vecs[i+impl->num_e_vecs_in],
                                   &impl->e_data[i + num_input_fields]);
     CeedChkBackend(ierr);
-    // Get output vector
+    // Restrict
+    ierr = CeedOperatorOutputRestriction_Ref(i, op_output_fields,
+           impl->e_vecs[i+impl->num_e_vecs_in], out_vec, is_overwrite, request);
+    CeedChkBackend(ierr);
+  }
+
+  // Restore input arrays
+  ierr = CeedOperatorRestoreInputs_Ref(op, num_input_fields, qf_input_fields,
+                                       op_input_fields, false, impl);
+  CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApply_Ref(CeedOperator op, CeedVector in_vec,
+                                 CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyCore_Ref(op, in_vec, out_vec, true, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Add
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
+                                    CeedVector out_vec, CeedRequest *request) {
+  return CeedOperatorApplyCore_Ref(op, in_vec, out_vec, false, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Add on a Subset of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddElements_Ref(CeedOperator op,
+    CeedInt num_elem_list, const CeedInt *elem_list, CeedScalar alpha,
+    CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedInt Q, num_input_fields, num_output_fields, size, elem_size, num_comp;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChkBackend(ierr);
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields);
+  CeedChkBackend(ierr);
+  CeedEvalMode eval_mode;
+  CeedElemRestriction elem_restr;
+  CeedVector vec, e_vec_elem;
+
+  // Setup
+  ierr = CeedOperatorSetup_Ref(op); CeedChkBackend(ierr);
+  ierr = CeedOperatorSetupActiveEVecs_Ref(op); CeedChkBackend(ierr);
+
+  // Restriction only operator
+  if (impl->is_identity_restr_op) {
+    ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_restr);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+    CeedChkBackend(ierr);
+    ierr = CeedOperatorFieldGetVector(op_output_fields[0], &vec);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE)
+      vec = out_vec;
+    ierr = CeedVectorCreate(ceed, elem_size*num_comp, &e_vec_elem);
+    CeedChkBackend(ierr);
+    for (CeedInt k=0; k<num_elem_list; k++) {
+      ierr = CeedElemRestrictionApplyBlock(elem_restr, elem_list[k],
+                                           CEED_NOTRANSPOSE, in_vec, e_vec_elem,
+                                           request); CeedChkBackend(ierr);
+      if (alpha != 1.0) {
+        ierr = CeedVectorScale(e_vec_elem, alpha); CeedChkBackend(ierr);
+      }
+      ierr = CeedElemRestrictionApplyBlock(elem_restr, elem_list[k],
+                                           CEED_TRANSPOSE, e_vec_elem, vec,
+                                           request); CeedChkBackend(ierr);
+    }
+    ierr = CeedVectorDestroy(&e_vec_elem); CeedChkBackend(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Passive input Evecs and Restriction
+  ierr = CeedOperatorSetupInputs_Ref(op, num_input_fields, qf_input_fields,
+                                     op_input_fields, in_vec, true, impl,
+                                     request); CeedChkBackend(ierr);
+
+  // Active input Evecs, restricted only on listed elements
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (vec != CEED_VECTOR_ACTIVE) continue;
+    ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorGetArray(impl->e_vecs[i], CEED_MEM_HOST, &impl->e_data[i]);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorCreate(ceed, elem_size*num_comp, &e_vec_elem);
+    CeedChkBackend(ierr);
+    for (CeedInt k=0; k<num_elem_list; k++) {
+      const CeedInt e = elem_list[k];
+      ierr = CeedVectorSetArray(e_vec_elem, CEED_MEM_HOST, CEED_USE_POINTER,
+                                &impl->e_data[i][e*elem_size*num_comp]);
+      CeedChkBackend(ierr);
+      ierr = CeedElemRestrictionApplyBlock(elem_restr, e, CEED_NOTRANSPOSE,
+                                           in_vec, e_vec_elem, request);
+      CeedChkBackend(ierr);
+    }
+    ierr = CeedVectorDestroy(&e_vec_elem); CeedChkBackend(ierr);
+  }
+
+  // Output Evecs
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    ierr = CeedVectorGetArray(impl->e_vecs[i+impl->num_e_vecs_in], CEED_MEM_HOST,
+                              &impl->e_data[i + num_input_fields]); CeedChkBackend(ierr);
+  }
+
+  // Loop through listed elements
+  for (CeedInt k=0; k<num_elem_list; k++) {
+    const CeedInt e = elem_list[k];
+    // Output pointers
+    for (CeedInt i=0; i<num_output_fields; i++) {
+      ierr = CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode);
+      CeedChkBackend(ierr);
+      if (eval_mode == CEED_EVAL_NONE) {
+        ierr = CeedQFunctionFieldGetSize(qf_output_fields[i], &size);
+        CeedChkBackend(ierr);
+        ierr = CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->e_data[i + num_input_fields][e*Q*size]);
+        CeedChkBackend(ierr);
+      }
+    }
+
+    // Input basis apply
+    ierr = CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields,
+                                      num_input_fields, false, impl);
+    CeedChkBackend(ierr);
+
+    // Q function
+    if (!impl->is_identity_qf) {
+      ierr = CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out);
+      CeedChkBackend(ierr);
+    }
+
+    // Output basis apply
+    ierr = CeedOperatorOutputBasis_Ref(e, Q, qf_output_fields, op_output_fields,
+                                       num_input_fields, num_output_fields, op, impl);
+    CeedChkBackend(ierr);
+  }
+
+  // Output restriction of listed elements
+  for (CeedInt i=0; i<num_output_fields; i++) {
     ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
     CeedChkBackend(ierr);
-    // Active
     if (vec == CEED_VECTOR_ACTIVE)
       vec = out_vec;
-    // Restrict
     ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_restr);
     CeedChkBackend(ierr);
-    ierr = CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE,
-                                    impl->e_vecs[i+impl->num_e_vecs_in], vec, request);
+    ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorCreate(ceed, elem_size*num_comp, &e_vec_elem);
+    CeedChkBackend(ierr);
+    CeedScalar *e_data_out = impl->e_data[i + num_input_fields];
+    for (CeedInt k=0; k<num_elem_list; k++) {
+      const CeedInt e = elem_list[k];
+      CeedScalar *e_data_elem = &e_data_out[e*elem_size*num_comp];
+      if (alpha != 1.0)
+        for (CeedInt j=0; j<elem_size*num_comp; j++)
+          e_data_elem[j] *= alpha;
+      ierr = CeedVectorSetArray(e_vec_elem, CEED_MEM_HOST, CEED_USE_POINTER,
+                                e_data_elem); CeedChkBackend(ierr);
+      ierr = CeedElemRestrictionApplyBlock(elem_restr, e, CEED_TRANSPOSE,
+                                           e_vec_elem, vec, request);
+      CeedChkBackend(ierr);
+    }
+    ierr = CeedVectorDestroy(&e_vec_elem); CeedChkBackend(ierr);
+    ierr = CeedVectorRestoreArray(impl->e_vecs[i+impl->num_e_vecs_in],
+                                  &impl->e_data[i + num_input_fields]);
     CeedChkBackend(ierr);
   }
 
   // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields,
-                                       op_input_fields, false, impl);
+  ierr = CeedOperatorRestoreInputs_Ref(op, num_input_fields, qf_input_fields,
+                                       op_input_fields, true, impl);
   CeedChkBackend(ierr);
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (vec != CEED_VECTOR_ACTIVE) continue;
+    ierr = CeedVectorRestoreArray(impl->e_vecs[i], &impl->e_data[i]);
+    CeedChkBackend(ierr);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
 
+//------------------------------------------------------------------------------
+// Restrict One Element of a Set of Vectors, Interleaved by Vector
+//------------------------------------------------------------------------------
+static inline int CeedOperatorMultiRestriction_Ref(
+  CeedElemRestriction elem_restr, const CeedInt *offsets, CeedInt e,
+  CeedTransposeMode t_mode, CeedInt num_vecs, CeedScalar **l_arrays,
+  CeedScalar *e_array) {
+  int ierr;
+  CeedInt elem_size, num_comp, comp_stride = 0, strides[3] = {0, 0, 0};
+  ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+  CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+  CeedChkBackend(ierr);
+  if (offsets) {
+    ierr = CeedElemRestrictionGetCompStride(elem_restr, &comp_stride);
+    CeedChkBackend(ierr);
+  } else {
+    bool has_backend_strides;
+    ierr = CeedElemRestrictionHasBackendStrides(elem_restr,
+           &has_backend_strides); CeedChkBackend(ierr);
+    if (has_backend_strides) {
+      ierr = CeedElemRestrictionGetELayout(elem_restr, &strides);
+      CeedChkBackend(ierr);
+    } else {
+      ierr = CeedElemRestrictionGetStrides(elem_restr, &strides);
+      CeedChkBackend(ierr);
+    }
+  }
+
+  // E-vector entry of vector v at ((c*elem_size + i)*num_vecs + v)
+  for (CeedInt c=0; c<num_comp; c++)
+    for (CeedInt i=0; i<elem_size; i++) {
+      const CeedInt ind = offsets ? offsets[e*elem_size + i] + c*comp_stride :
+                          i*strides[0] + c*strides[1] + e*strides[2];
+      CeedScalar *e_node = &e_array[(c*elem_size + i)*num_vecs];
+      if (t_mode == CEED_NOTRANSPOSE)
+        for (CeedInt v=0; v<num_vecs; v++)
+          e_node[v] = l_arrays[v][ind];
+      else
+        for (CeedInt v=0; v<num_vecs; v++)
+          l_arrays[v][ind] += e_node[v];
+    }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Copy a Single Element Q-vector to Each Vector of an Interleaved Q-vector
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSpreadQVector_Ref(CeedVector q_vec,
+    CeedInt q_size, CeedInt num_vecs, CeedScalar *q_batch) {
+  int ierr;
+  const CeedScalar *q_array;
+
+  ierr = CeedVectorGetArrayRead(q_vec, CEED_MEM_HOST, &q_array);
+  CeedChkBackend(ierr);
+  for (CeedInt j=0; j<q_size; j++)
+    for (CeedInt v=0; v<num_vecs; v++)
+      q_batch[j*num_vecs + v] = q_array[j];
+  ierr = CeedVectorRestoreArrayRead(q_vec, &q_array); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Add to a Set of Vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddMulti_Ref(CeedOperator op, CeedInt num_vecs,
+    CeedVector *in_vecs, CeedVector *out_vecs, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedInt Q, num_elem, num_input_fields, num_output_fields, size, elem_size,
+          num_comp;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChkBackend(ierr);
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields);
+  CeedChkBackend(ierr);
+  const CeedInt num_fields = num_input_fields + num_output_fields;
+  CeedEvalMode eval_mode;
+  CeedElemRestriction elem_restr;
+  CeedBasis basis;
+  CeedVector vec;
+
+  // Setup
+  ierr = CeedOperatorSetup_Ref(op); CeedChkBackend(ierr);
+
+  // Identity QFunctions have no pointwise work to share between vectors
+  if (impl->is_identity_qf) {
+    for (CeedInt v=0; v<num_vecs; v++) {
+      ierr = CeedOperatorApplyCore_Ref(op, in_vecs[v], out_vecs[v], false,
+                                       request); CeedChkBackend(ierr);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Passive input Evecs and Restriction
+  ierr = CeedOperatorSetupInputs_Ref(op, num_input_fields, qf_input_fields,
+                                     op_input_fields, NULL, true, impl,
+                                     request); CeedChkBackend(ierr);
+
+  // Element E- and Q-vectors with the vector index as the fastest dimension,
+  //   so the basis treats the set of vectors as a block of elements
+  bool has_active_in = false, has_active_out = false;
+  bool *is_active;
+  const CeedInt **offsets;
+  CeedScalar **e_batch, **q_batch;
+  CeedVector *e_vecs_batch, *q_vecs_batch;
+  ierr = CeedCalloc(num_fields, &is_active); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_fields, &offsets); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_fields, &e_batch); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_fields, &q_batch); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_fields, &e_vecs_batch); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_fields, &q_vecs_batch); CeedChkBackend(ierr);
+  for (CeedInt i=0; i<num_fields; i++) {
+    bool is_input = i < num_input_fields;
+    CeedOperatorField op_field = is_input ? op_input_fields[i] :
+                                 op_output_fields[i - num_input_fields];
+    CeedQFunctionField qf_field = is_input ? qf_input_fields[i] :
+                                  qf_output_fields[i - num_input_fields];
+    ierr = CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode);
+    CeedChkBackend(ierr);
+    ierr = CeedQFunctionFieldGetSize(qf_field, &size); CeedChkBackend(ierr);
+    ierr = CeedOperatorFieldGetVector(op_field, &vec); CeedChkBackend(ierr);
+    is_active[i] = vec == CEED_VECTOR_ACTIVE;
+    if (!is_input && !is_active[i])
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_BACKEND,
+                       "Passive outputs must be computed once per vector");
+    // LCOV_EXCL_STOP
+    has_active_in = has_active_in || (is_input && is_active[i]);
+    has_active_out = has_active_out || !is_input;
+
+    // Q-vector
+    ierr = CeedCalloc(Q*size*num_vecs, &q_batch[i]); CeedChkBackend(ierr);
+    ierr = CeedVectorCreate(ceed, Q*size*num_vecs, &q_vecs_batch[i]);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorSetArray(q_vecs_batch[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                              q_batch[i]); CeedChkBackend(ierr);
+    if (eval_mode == CEED_EVAL_WEIGHT) {
+      ierr = CeedOperatorSpreadQVector_Ref(impl->q_vecs_in[i], Q, num_vecs,
+                                           q_batch[i]); CeedChkBackend(ierr);
+    }
+    if (!is_active[i]) continue;
+
+    // Active E-vector, the Q-vector itself for CEED_EVAL_NONE
+    ierr = CeedOperatorFieldGetElemRestriction(op_field, &elem_restr);
+    CeedChkBackend(ierr);
+    bool is_strided;
+    ierr = CeedElemRestrictionIsStrided(elem_restr, &is_strided);
+    CeedChkBackend(ierr);
+    if (!is_strided) {
+      ierr = CeedElemRestrictionGetOffsets(elem_restr, CEED_MEM_HOST,
+                                           &offsets[i]); CeedChkBackend(ierr);
+    }
+    if (eval_mode == CEED_EVAL_NONE) {
+      e_batch[i] = q_batch[i];
+    } else {
+      ierr = CeedElemRestrictionGetElementSize(elem_restr, &elem_size);
+      CeedChkBackend(ierr);
+      ierr = CeedElemRestrictionGetNumComponents(elem_restr, &num_comp);
+      CeedChkBackend(ierr);
+      ierr = CeedCalloc(elem_size*num_comp*num_vecs, &e_batch[i]);
+      CeedChkBackend(ierr);
+      ierr = CeedVectorCreate(ceed, elem_size*num_comp*num_vecs,
+                              &e_vecs_batch[i]); CeedChkBackend(ierr);
+      ierr = CeedVectorSetArray(e_vecs_batch[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, e_batch[i]);
+      CeedChkBackend(ierr);
+    }
+  }
+
+  // Input and output L-vector arrays
+  CeedScalar **in_arrays, **out_arrays;
+  ierr = CeedCalloc(num_vecs, &in_arrays); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_vecs, &out_arrays); CeedChkBackend(ierr);
+  for (CeedInt v=0; v<num_vecs; v++) {
+    if (has_active_in) {
+      ierr = CeedVectorGetArrayRead(in_vecs[v], CEED_MEM_HOST,
+                                    (const CeedScalar **) &in_arrays[v]);
+      CeedChkBackend(ierr);
+    }
+    if (has_active_out) {
+      ierr = CeedVectorGetArray(out_vecs[v], CEED_MEM_HOST, &out_arrays[v]);
+      CeedChkBackend(ierr);
+    }
+  }
+
+  // Loop through elements, applying the basis and QFunction to all vectors
+  //   while the passive data of the element is in cache
+  for (CeedInt e=0; e<num_elem; e++) {
+    // Passive input basis apply, shared by all vectors
+    ierr = CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields,
+                                      num_input_fields, true, impl);
+    CeedChkBackend(ierr);
+
+    // Input restriction and basis apply
+    for (CeedInt i=0; i<num_input_fields; i++) {
+      ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+      CeedChkBackend(ierr);
+      if (eval_mode == CEED_EVAL_WEIGHT) continue;
+      if (!is_active[i]) {
+        ierr = CeedQFunctionFieldGetSize(qf_input_fields[i], &size);
+        CeedChkBackend(ierr);
+        ierr = CeedOperatorSpreadQVector_Ref(impl->q_vecs_in[i], Q*size,
+                                             num_vecs, q_batch[i]);
+        CeedChkBackend(ierr);
+        continue;
+      }
+      ierr = CeedOperatorFieldGetElemRestriction(op_input_fields[i],
+             &elem_restr); CeedChkBackend(ierr);
+      ierr = CeedOperatorMultiRestriction_Ref(elem_restr, offsets[i], e,
+                                              CEED_NOTRANSPOSE, num_vecs,
+                                              in_arrays, e_batch[i]);
+      CeedChkBackend(ierr);
+      if (eval_mode != CEED_EVAL_NONE) {
+        ierr = CeedOperatorFieldGetBasis(op_input_fields[i], &basis);
+        CeedChkBackend(ierr);
+        ierr = CeedBasisApply(basis, num_vecs, CEED_NOTRANSPOSE, eval_mode,
+                              e_vecs_batch[i], q_vecs_batch[i]);
+        CeedChkBackend(ierr);
+      }
+    }
+
+    // Q function
+    ierr = CeedQFunctionApply(qf, Q*num_vecs, q_vecs_batch,
+                              &q_vecs_batch[num_input_fields]);
+    CeedChkBackend(ierr);
+
+    // Output basis apply and restriction
+    for (CeedInt i=0; i<num_output_fields; i++) {
+      const CeedInt j = i + num_input_fields;
+      ierr = CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode);
+      CeedChkBackend(ierr);
+      if (eval_mode != CEED_EVAL_NONE) {
+        ierr = CeedOperatorFieldGetBasis(op_output_fields[i], &basis);
+        CeedChkBackend(ierr);
+        ierr = CeedBasisApply(basis, num_vecs, CEED_TRANSPOSE, eval_mode,
+                              q_vecs_batch[j], e_vecs_batch[j]);
+        CeedChkBackend(ierr);
+      }
+      ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[i],
+             &elem_restr); CeedChkBackend(ierr);
+      ierr = CeedOperatorMultiRestriction_Ref(elem_restr, offsets[j], e,
+                                              CEED_TRANSPOSE, num_vecs,
+                                              out_arrays, e_batch[j]);
+      CeedChkBackend(ierr);
+    }
+  }
+
+  // Restore arrays
+  for (CeedInt v=0; v<num_vecs; v++) {
+    if (has_active_in) {
+      ierr = CeedVectorRestoreArrayRead(in_vecs[v],
+                                        (const CeedScalar **) &in_arrays[v]);
+      CeedChkBackend(ierr);
+    }
+    if (has_active_out) {
+      ierr = CeedVectorRestoreArray(out_vecs[v], &out_arrays[v]);
+      CeedChkBackend(ierr);
+    }
+  }
+  ierr = CeedFree(&in_arrays); CeedChkBackend(ierr);
+  ierr = CeedFree(&out_arrays); CeedChkBackend(ierr);
+  ierr = CeedOperatorRestoreInputs_Ref(op, num_input_fields, qf_input_fields,
+                                       op_input_fields, true, impl);
+  CeedChkBackend(ierr);
+
+  // Cleanup
+  for (CeedInt i=0; i<num_fields; i++) {
+    if (offsets[i]) {
+      bool is_input = i < num_input_fields;
+      ierr = CeedOperatorFieldGetElemRestriction(is_input ? op_input_fields[i] :
+             op_output_fields[i - num_input_fields], &elem_restr);
+      CeedChkBackend(ierr);
+      ierr = CeedElemRestrictionRestoreOffsets(elem_restr, &offsets[i]);
+      CeedChkBackend(ierr);
+    }
+    if (e_vecs_batch[i]) {
+      ierr = CeedVectorDestroy(&e_vecs_batch[i]); CeedChkBackend(ierr);
+      ierr = CeedFree(&e_batch[i]); CeedChkBackend(ierr);
+    }
+    ierr = CeedVectorDestroy(&q_vecs_batch[i]); CeedChkBackend(ierr);
+    ierr = CeedFree(&q_batch[i]); CeedChkBackend(ierr);
+  }
+  ierr = CeedFree(&is_active); CeedChkBackend(ierr);
+  ierr = CeedFree(&offsets); CeedChkBackend(ierr);
+  ierr = CeedFree(&e_batch); CeedChkBackend(ierr);
+  ierr = CeedFree(&q_batch); CeedChkBackend(ierr);
+  ierr = CeedFree(&e_vecs_batch); CeedChkBackend(ierr);
+  ierr = CeedFree(&q_vecs_batch); CeedChkBackend(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tile Q-vector across QFunction linearization probe directions
+//------------------------------------------------------------------------------
+static inline int CeedOperatorTileQVector_Ref(CeedVector q_vec,
+    CeedVector q_vec_wide, CeedInt size, CeedInt num_pts, CeedInt num_dir) {
+  int ierr;
+  const CeedScalar *q_array;
+  CeedScalar *wide_array;
+  const CeedInt num_wide = num_pts*num_dir;
+
+  ierr = CeedVectorGetArrayRead(q_vec, CEED_MEM_HOST, &q_array);
+  CeedChkBackend(ierr);
+  ierr = CeedVectorGetArray(q_vec_wide, CEED_MEM_HOST, &wide_array);
+  CeedChkBackend(ierr);
+  for (CeedInt c=0; c<size; c++)
+    for (CeedInt d=0; d<num_dir; d++)
+      CeedPragmaSIMD
+      for (CeedInt p=0; p<num_pts; p++)
+        wide_array[c*num_wide + d*num_pts + p] = q_array[c*num_pts + p];
+  ierr = CeedVectorRestoreArrayRead(q_vec, &q_array); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(q_vec_wide, &wide_array); CeedChkBackend(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup QFunction Linearization
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupLinearizeQFunction_Ref(CeedOperator op,
+    CeedInt num_pts, CeedOperator_Ref *impl) {
+  int ierr;
+  if (impl->qf_q_vecs_in) return CEED_ERROR_SUCCESS;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChkBackend(ierr);
+  CeedInt num_input_fields, num_output_fields, size;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChkBackend(ierr);
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields);
+  CeedChkBackend(ierr);
+  CeedEvalMode eval_mode;
+  CeedVector vec;
+  CeedScalar *wide_array;
+
+  // Q-vectors hold all probe directions side by side, so the QFunction is
+  //   linearized by a single QFunction call over num_pts*num_active_in points
+  const CeedInt num_active_in = impl->qf_num_active_in,
+                num_wide = num_pts*num_active_in;
+  ierr = CeedCalloc(num_input_fields, &impl->qf_q_vecs_in); CeedChkBackend(ierr);
+  ierr = CeedCalloc(num_output_fields, &impl->qf_q_vecs_out);
+  CeedChkBackend(ierr);
+  for (CeedInt i=0, in=0; i<num_input_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+    CeedChkBackend(ierr);
+    ierr = CeedQFunctionFieldGetSize(qf_input_fields[i], &size);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorCreate(ceed, num_wide*size, &impl->qf_q_vecs_in[i]);
+    CeedChkBackend(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      // Unit probe direction for each active input component
+      ierr = CeedVectorSetValue(impl->qf_q_vecs_in[i], 0.0); CeedChkBackend(ierr);
+      ierr = CeedVectorGetArray(impl->qf_q_vecs_in[i], CEED_MEM_HOST,
+                                &wide_array); CeedChkBackend(ierr);
+      for (CeedInt c=0; c<size; c++, in++)
+        for (CeedInt p=0; p<num_pts; p++)
+          wide_array[c*num_wide + in*num_pts + p] = 1.0;
+      ierr = CeedVectorRestoreArray(impl->qf_q_vecs_in[i], &wide_array);
+      CeedChkBackend(ierr);
+    } else if (eval_mode == CEED_EVAL_WEIGHT) {
+      // Quadrature weights are the same for every element
+      ierr = CeedOperatorTileQVector_Ref(impl->q_vecs_in[i],
+                                         impl->qf_q_vecs_in[i], size, num_pts,
+                                         num_active_in); CeedChkBackend(ierr);
+    }
+  }
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    ierr = CeedQFunctionFieldGetSize(qf_output_fields[i], &size);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorCreate(ceed, num_wide*size, &impl->qf_q_vecs_out[i]);
+    CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Linearize QFunction for current Q-vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearizeQFunction_Ref(CeedQFunction qf,
+    CeedInt num_pts, CeedQFunctionField *qf_input_fields,
+    CeedOperatorField *op_input_fields, CeedInt num_input_fields,
+    CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+    CeedInt num_output_fields, CeedOperator_Ref *impl, CeedScalar *assembled) {
+  int ierr;
+  CeedEvalMode eval_mode;
+  CeedVector vec;
+  CeedInt size;
+  const CeedScalar *wide_array;
+  const CeedInt num_active_in = impl->qf_num_active_in,
+                num_active_out = impl->qf_num_active_out,
+                num_wide = num_pts*num_active_in;
+
+  // Passive inputs, repeated for each probe direction
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec);
+    CeedChkBackend(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+    CeedChkBackend(ierr);
+    if (vec != CEED_VECTOR_ACTIVE && eval_mode != CEED_EVAL_WEIGHT) {
+      ierr = CeedQFunctionFieldGetSize(qf_input_fields[i], &size);
+      CeedChkBackend(ierr);
+      ierr = CeedOperatorTileQVector_Ref(impl->q_vecs_in[i],
+                                         impl->qf_q_vecs_in[i], size, num_pts,
+                                         num_active_in); CeedChkBackend(ierr);
+    }
+  }
+
+  // Apply QFunction for all probe directions
+  ierr = CeedQFunctionApply(qf, num_wide, impl->qf_q_vecs_in,
+                            impl->qf_q_vecs_out); CeedChkBackend(ierr);
+
+  // Active outputs, ordered by probe direction then output component
+  for (CeedInt i=0, out=0; i<num_output_fields; i++) {
+    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec);
+    CeedChkBackend(ierr);
+    if (vec != CEED_VECTOR_ACTIVE) continue;
+    ierr = CeedQFunctionFieldGetSize(qf_output_fields[i], &size);
+    CeedChkBackend(ierr);
+    ierr = CeedVectorGetArrayRead(impl->qf_q_vecs_out[i], CEED_MEM_HOST,
+                                  &wide_array); CeedChkBackend(ierr);
+    for (CeedInt in=0; in<num_active_in; in++)
+      for (CeedInt c=0; c<size; c++)
+        CeedPragmaSIMD
+        for (CeedInt p=0; p<num_pts; p++)
+          assembled[(in*num_active_out + out + c)*num_pts + p] =
+            wide_array[c*num_wide + in*num_pts + p];
+    ierr = CeedVectorRestoreArrayRead(impl->qf_q_vecs_out[i], &wide_array);
+    CeedChkBackend(ierr);
+    out += size;
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -519,8 +1386,8 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec,
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
 static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
-    bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
-    CeedRequest *request) {
+    bool build_objects, CeedInt elem_start, CeedInt elem_end,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChkBackend(ierr);
@@ -540,8 +1407,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
   CeedVector vec;
   CeedInt num_active_in = impl->qf_num_active_in,
           num_active_out = impl->qf_num_active_out;
-  CeedVector *active_in = impl->qf_active_in;
-  CeedScalar *a, *tmp;
+  CeedScalar *a;
   Ceed ceed, ceed_parent;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChkBackend(ierr);
   ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceed_parent);
@@ -559,7 +1425,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
   // LCOV_EXCL_STOP
 
   // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields,
+  ierr = CeedOperatorSetupInputs_Ref(op, num_input_fields, qf_input_fields,
                                      op_input_fields, NULL, true, impl, request);
   CeedChkBackend(ierr);
 
@@ -573,23 +1439,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
       if (vec == CEED_VECTOR_ACTIVE) {
         ierr = CeedQFunctionFieldGetSize(qf_input_fields[i], &size);
         CeedChkBackend(ierr);
-        ierr = CeedVectorSetValue(impl->q_vecs_in[i], 0.0); CeedChkBackend(ierr);
-        ierr = CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &tmp);
-        CeedChkBackend(ierr);
-        ierr = CeedRealloc(num_active_in + size, &active_in); CeedChkBackend(ierr);
-        for (CeedInt field=0; field<size; field++) {
-          ierr = CeedVectorCreate(ceed, Q, &active_in[num_active_in+field]);
-          CeedChkBackend(ierr);
-          ierr = CeedVectorSetArray(active_in[num_active_in+field], CEED_MEM_HOST,
-                                    CEED_USE_POINTER, &tmp[field*Q]);
-          CeedChkBackend(ierr);
-        }
         num_active_in += size;
-        ierr = CeedVectorRestoreArray(impl->q_vecs_in[i], &tmp); CeedChkBackend(ierr);
       }
     }
     impl->qf_num_active_in = num_active_in;
-    impl->qf_active_in = active_in;
   }
 
   // Count number of active output fields
@@ -616,6 +1469,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
                      "and outputs");
   // LCOV_EXCL_STOP
 
+  // Setup QFunction linearization
+  ierr = CeedOperatorSetupLinearizeQFunction_Ref(op, Q, impl);
+  CeedChkBackend(ierr);
+
   // Build objects if needed
   if (build_objects) {
     // Create output restriction
@@ -633,54 +1490,22 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
   ierr = CeedVectorGetArray(*assembled, CEED_MEM_HOST, &a); CeedChkBackend(ierr);
 
   // Loop through elements
-  for (CeedInt e=0; e<num_elem; e++) {
+  for (CeedInt e=elem_start; e<elem_end; e++) {
     // Input basis apply
     ierr = CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields,
                                       num_input_fields, true, impl);
     CeedChkBackend(ierr);
 
-    // Assemble QFunction
-    for (CeedInt in=0; in<num_active_in; in++) {
-      // Set Inputs
-      ierr = CeedVectorSetValue(active_in[in], 1.0); CeedChkBackend(ierr);
-      if (num_active_in > 1) {
-        ierr = CeedVectorSetValue(active_in[(in+num_active_in-1)%num_active_in],
-                                  0.0); CeedChkBackend(ierr);
-      }
-      // Set Outputs
-      for (CeedInt out=0; out<num_output_fields; out++) {
-        // Get output vector
-        ierr = CeedOperatorFieldGetVector(op_output_fields[out], &vec);
-        CeedChkBackend(ierr);
-        // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST,
-                             CEED_USE_POINTER, a); CeedChkBackend(ierr);
-          ierr = CeedQFunctionFieldGetSize(qf_output_fields[out], &size);
-          CeedChkBackend(ierr);
-          a += size*Q; // Advance the pointer by the size of the output
-        }
-      }
-      // Apply QFunction
-      ierr = CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out);
-      CeedChkBackend(ierr);
-    }
-  }
-
-  // Un-set output Qvecs to prevent accidental overwrite of Assembled
-  for (CeedInt out=0; out<num_output_fields; out++) {
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(op_output_fields[out], &vec);
+    // Linearize QFunction
+    ierr = CeedOperatorLinearizeQFunction_Ref(qf, Q, qf_input_fields,
+           op_input_fields, num_input_fields, qf_output_fields,
+           op_output_fields, num_output_fields, impl,
+           &a[(e - elem_start)*Q*num_active_in*num_active_out]);
     CeedChkBackend(ierr);
-    // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL);
-      CeedChkBackend(ierr);
-    }
   }
 
   // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields,
+  ierr = CeedOperatorRestoreInputs_Ref(op, num_input_fields, qf_input_fields,
                                        op_input_fields, true, impl);
   CeedChkBackend(ierr);
 
@@ -695,8 +1520,11 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
 //------------------------------------------------------------------------------
 static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
     CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
-  return CeedOperatorLinearAssembleQFunctionCore_Ref(op, true, assembled, rstr,
-         request);
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+  return CeedOperatorLinearAssembleQFunctionCore_Ref(op, true, 0, num_elem,
+         assembled, rstr, request);
 }
 
 //------------------------------------------------------------------------------
@@ -704,8 +1532,21 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
 //------------------------------------------------------------------------------
 static int CeedOperatorLinearAssembleQFunctionUpdate_Ref(CeedOperator op,
     CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
-  return CeedOperatorLinearAssembleQFunctionCore_Ref(op, false, &assembled,
-         &rstr, request);
+  int ierr;
+  CeedInt num_elem;
+  ierr = CeedOperatorGetNumElements(op, &num_elem); CeedChkBackend(ierr);
+  return CeedOperatorLinearAssembleQFunctionCore_Ref(op, false, 0, num_elem,
+         &assembled, &rstr, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction on a Range of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionElements_Ref(CeedOperator op,
+    CeedInt elem_start, CeedInt elem_end, CeedVector assembled,
+    CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Ref(op, false, elem_start,
+         elem_end, &assembled, NULL, request);
 }
 
 //------------------------------------------------------------------------------
@@ -738,10 +1579,16 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   ierr = CeedFree(&impl->q_vecs_out); CeedChkBackend(ierr);
 
   // QFunction assembly
-  for (CeedInt i=0; i<impl->qf_num_active_in; i++) {
-    ierr = CeedVectorDestroy(&impl->qf_active_in[i]); CeedChkBackend(ierr);
+  if (impl->qf_q_vecs_in) {
+    for (CeedInt i=0; i<impl->num_e_vecs_in; i++) {
+      ierr = CeedVectorDestroy(&impl->qf_q_vecs_in[i]); CeedChkBackend(ierr);
+    }
+    for (CeedInt i=0; i<impl->num_e_vecs_out; i++) {
+      ierr = CeedVectorDestroy(&impl->qf_q_vecs_out[i]); CeedChkBackend(ierr);
+    }
   }
-  ierr = CeedFree(&impl->qf_active_in); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->qf_q_vecs_in); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->qf_q_vecs_out); CeedChkBackend(ierr);
 
   ierr = CeedFree(&impl); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
@@ -766,8 +1613,20 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
                                 "LinearAssembleQFunctionUpdate",
                                 CeedOperatorLinearAssembleQFunctionUpdate_Ref);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleQFunctionElements",
+                                CeedOperatorLinearAssembleQFunctionElements_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Ref); CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Ref); CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMulti",
+                                CeedOperatorApplyAddMulti_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddElements",
+                                CeedOperatorApplyAddElements_Ref);
+  CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Ref); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
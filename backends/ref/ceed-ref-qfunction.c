@@ -25,14 +25,11 @@
 static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
                                   CeedVector *U, CeedVector *V) {
   int ierr;
-  CeedQFunction_Ref *impl;
-  ierr = CeedQFunctionGetData(qf, &impl); CeedChkBackend(ierr);
-
   CeedQFunctionContext ctx;
   ierr = CeedQFunctionGetContext(qf, &ctx); CeedChkBackend(ierr);
   void *ctxData = NULL;
   if (ctx) {
-    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_HOST, &ctxData);
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxData);
     CeedChkBackend(ierr);
   }
 
@@ -42,25 +39,30 @@ static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
   CeedInt num_in, num_out;
   ierr = CeedQFunctionGetNumArgs(qf, &num_in, &num_out); CeedChkBackend(ierr);
 
+  // Field pointers are local so a QFunction may be applied on several threads
+  const CeedScalar *inputs[16];
+  CeedScalar *outputs[16];
+
   for (int i = 0; i<num_in; i++) {
-    ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &impl->inputs[i]);
+    ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &inputs[i]);
     CeedChkBackend(ierr);
   }
   for (int i = 0; i<num_out; i++) {
-    ierr = CeedVectorGetArray(V[i], CEED_MEM_HOST, &impl->outputs[i]);
+    ierr = CeedVectorGetArray(V[i], CEED_MEM_HOST, &outputs[i]);
     CeedChkBackend(ierr);
   }
 
-  ierr = f(ctxData, Q, impl->inputs, impl->outputs); CeedChkBackend(ierr);
+  ierr = f(ctxData, Q, inputs, outputs); CeedChkBackend(ierr);
 
   for (int i = 0; i<num_in; i++) {
-    ierr = CeedVectorRestoreArrayRead(U[i], &impl->inputs[i]); CeedChkBackend(ierr);
+    ierr = CeedVectorRestoreArrayRead(U[i], &inputs[i]); CeedChkBackend(ierr);
   }
   for (int i = 0; i<num_out; i++) {
-    ierr = CeedVectorRestoreArray(V[i], &impl->outputs[i]); CeedChkBackend(ierr);
+    ierr = CeedVectorRestoreArray(V[i], &outputs[i]); CeedChkBackend(ierr);
   }
   if (ctx) {
-    ierr = CeedQFunctionContextRestoreData(ctx, &ctxData); CeedChkBackend(ierr);
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxData);
+    CeedChkBackend(ierr);
   }
 
   return CEED_ERROR_SUCCESS;
@@ -74,8 +76,6 @@ static int CeedQFunctionDestroy_Ref(CeedQFunction qf) {
   CeedQFunction_Ref *impl;
   ierr = CeedQFunctionGetData(qf, &impl); CeedChkBackend(ierr);
 
-  ierr = CeedFree(&impl->inputs); CeedChkBackend(ierr);
-  ierr = CeedFree(&impl->outputs); CeedChkBackend(ierr);
   ierr = CeedFree(&impl); CeedChkBackend(ierr);
 
   return CEED_ERROR_SUCCESS;
@@ -91,8 +91,6 @@ int CeedQFunctionCreate_Ref(CeedQFunction qf) {
 
   CeedQFunction_Ref *impl;
   ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
-  ierr = CeedCalloc(16, &impl->inputs); CeedChkBackend(ierr);
-  ierr = CeedCalloc(16, &impl->outputs); CeedChkBackend(ierr);
   ierr = CeedQFunctionSetData(qf, impl); CeedChkBackend(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Apply",
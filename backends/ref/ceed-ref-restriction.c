@@ -20,6 +20,50 @@
 #include <string.h>
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Structured ElemRestriction Element Index
+//------------------------------------------------------------------------------
+static inline void CeedElemRestrictionStructuredIndex_Ref(
+  const CeedElemRestriction_Ref *impl, CeedInt elem, CeedInt elem_1d[3]) {
+  for (CeedInt d=0; d<3; d++) {
+    elem_1d[d] = elem % impl->struct_num_elem[d];
+    elem /= impl->struct_num_elem[d];
+  }
+}
+
+//------------------------------------------------------------------------------
+// Structured ElemRestriction Next Element Index
+//------------------------------------------------------------------------------
+static inline void CeedElemRestrictionStructuredNext_Ref(
+  const CeedElemRestriction_Ref *impl, CeedInt elem_1d[3]) {
+  for (CeedInt d=0; d<3; d++) {
+    if (++elem_1d[d] < impl->struct_num_elem[d]) return;
+    elem_1d[d] = 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Structured ElemRestriction Element Offsets
+//------------------------------------------------------------------------------
+static inline void CeedElemRestrictionStructuredOffsets_Ref(
+  const CeedElemRestriction_Ref *impl, const CeedInt elem_1d[3],
+  CeedInt *elem_offsets) {
+  const CeedInt dim = impl->struct_dim, P = impl->struct_P_1d;
+  const CeedInt P_1 = dim > 1 ? P : 1, P_2 = dim > 2 ? P : 1;
+  const CeedInt *offsets_0 = &impl->struct_offsets_1d[0][elem_1d[0]*P];
+  const CeedInt *offsets_1 = &impl->struct_offsets_1d[1][elem_1d[1]*P];
+  const CeedInt *offsets_2 = &impl->struct_offsets_1d[2][elem_1d[2]*P];
+
+  // Tensor product of directional offsets
+  for (CeedInt i_2=0; i_2<P_2; i_2++)
+    for (CeedInt i_1=0; i_1<P_1; i_1++) {
+      const CeedInt base = offsets_2[i_2] + offsets_1[i_1];
+      CeedPragmaSIMD
+      for (CeedInt i_0=0; i_0<P; i_0++)
+        elem_offsets[(i_2*P_1 + i_1)*P + i_0] = base + offsets_0[i_0];
+    }
+}
+
 //------------------------------------------------------------------------------
 // Core ElemRestriction Apply Code
 //------------------------------------------------------------------------------
@@ -42,8 +86,53 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
   // Restriction from L-vector to E-vector
   // Perform: v = r * u
   if (t_mode == CEED_NOTRANSPOSE) {
-    // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (impl->is_structured) {
+      // Structured restriction, offsets computed for each element
+      // vv has shape [elem_size, num_comp, num_elem], row-major
+      // uu has shape [nnodes, num_comp]
+      //   elements are visited in order, so padding repeats the last element
+      CeedInt elem_offsets[elem_size], elem_1d[3];
+      CeedElemRestrictionStructuredIndex_Ref(impl,
+                                             CeedIntMin(start*blk_size, num_elem-1),
+                                             elem_1d);
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        for (CeedInt j = 0; j < blk_size; j++) {
+          CeedElemRestrictionStructuredOffsets_Ref(impl, elem_1d, elem_offsets);
+          if (e+j < num_elem-1)
+            CeedElemRestrictionStructuredNext_Ref(impl, elem_1d);
+          for (CeedInt k = 0; k < num_comp; k++)
+            CeedPragmaSIMD
+            for (CeedInt n = 0; n < elem_size; n++)
+              vv[elem_size*(k*blk_size+num_comp*e) + n*blk_size + j - v_offset]
+                = uu[elem_offsets[n] + k*comp_stride];
+        }
+    } else if (impl->comp_delta) {
+      // Compressed offsets, element base with 16-bit node deltas
+      // vv has shape [elem_size, num_comp, num_elem], row-major
+      // uu has shape [nnodes, num_comp]
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        for (CeedInt j = 0; j < blk_size; j++) {
+          const CeedInt elem = CeedIntMin(e+j, num_elem-1);
+          const CeedScalar *uu_elem = &uu[impl->comp_base[elem]];
+          const uint16_t *delta = &impl->comp_delta[elem*elem_size];
+          if (comp_stride == 1 && num_comp > 1) {
+            // Interlaced components, gather all components of a node at once
+            for (CeedInt n = 0; n < elem_size; n++) {
+              const CeedScalar *uu_node = &uu_elem[delta[n]];
+              for (CeedInt k = 0; k < num_comp; k++)
+                vv[elem_size*(k*blk_size+num_comp*e) + n*blk_size + j - v_offset]
+                  = uu_node[k];
+            }
+          } else {
+            for (CeedInt k = 0; k < num_comp; k++)
+              CeedPragmaSIMD
+              for (CeedInt n = 0; n < elem_size; n++)
+                vv[elem_size*(k*blk_size+num_comp*e) + n*blk_size + j - v_offset]
+                  = uu_elem[delta[n] + k*comp_stride];
+          }
+        }
+    } else if (!impl->offsets) {
+      // No offsets provided, Identity Restriction
       bool has_backend_strides;
       ierr = CeedElemRestrictionHasBackendStrides(r, &has_backend_strides);
       CeedChkBackend(ierr);
@@ -75,6 +164,17 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
                   = uu[n*strides[0] + k*strides[1] +
                                     CeedIntMin(e+j, num_elem-1)*strides[2]];
       }
+    } else if (comp_stride == 1 && num_comp > 1) {
+      // Offsets provided, interlaced components
+      // vv has shape [elem_size, num_comp, num_elem], row-major
+      // uu has shape [nnodes, num_comp] with components contiguous per node,
+      //   so all components of a node are gathered from one cache line
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        for (CeedInt i = 0; i < elem_size*blk_size; i++) {
+          const CeedScalar *uu_node = &uu[impl->offsets[i+elem_size*e]];
+          for (CeedInt k = 0; k < num_comp; k++)
+            vv[elem_size*(k*blk_size+num_comp*e) + i - v_offset] = uu_node[k];
+        }
     } else {
       // Offsets provided, standard or blocked restriction
       // vv has shape [elem_size, num_comp, num_elem], row-major
@@ -90,8 +190,51 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
   } else {
     // Restriction from E-vector to L-vector
     // Performing v += r^T * u
-    // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (impl->is_structured) {
+      // Structured restriction, offsets computed for each element
+      // uu has shape [elem_size, num_comp, num_elem]
+      // vv has shape [nnodes, num_comp]
+      CeedInt elem_offsets[elem_size], elem_1d[3];
+      CeedElemRestrictionStructuredIndex_Ref(impl,
+                                             CeedIntMin(start*blk_size, num_elem-1),
+                                             elem_1d);
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        // Iteration bound set to discard padding elements
+        for (CeedInt j = 0; j < CeedIntMin(blk_size, num_elem-e); j++) {
+          CeedElemRestrictionStructuredOffsets_Ref(impl, elem_1d, elem_offsets);
+          if (e+j < num_elem-1)
+            CeedElemRestrictionStructuredNext_Ref(impl, elem_1d);
+          for (CeedInt k = 0; k < num_comp; k++)
+            for (CeedInt n = 0; n < elem_size; n++)
+              vv[elem_offsets[n] + k*comp_stride]
+              += uu[elem_size*(k*blk_size+num_comp*e) + n*blk_size + j - v_offset];
+        }
+    } else if (impl->comp_delta) {
+      // Compressed offsets, element base with 16-bit node deltas
+      // uu has shape [elem_size, num_comp, num_elem]
+      // vv has shape [nnodes, num_comp]
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        // Iteration bound set to discard padding elements
+        for (CeedInt j = 0; j < CeedIntMin(blk_size, num_elem-e); j++) {
+          CeedScalar *vv_elem = &vv[impl->comp_base[e+j]];
+          const uint16_t *delta = &impl->comp_delta[(e+j)*elem_size];
+          if (comp_stride == 1 && num_comp > 1) {
+            // Interlaced components, scatter all components of a node at once
+            for (CeedInt n = 0; n < elem_size; n++) {
+              CeedScalar *vv_node = &vv_elem[delta[n]];
+              for (CeedInt k = 0; k < num_comp; k++)
+                vv_node[k]
+                += uu[elem_size*(k*blk_size+num_comp*e) + n*blk_size + j - v_offset];
+            }
+          } else {
+            for (CeedInt k = 0; k < num_comp; k++)
+              for (CeedInt n = 0; n < elem_size; n++)
+                vv_elem[delta[n] + k*comp_stride]
+                += uu[elem_size*(k*blk_size+num_comp*e) + n*blk_size + j - v_offset];
+          }
+        }
+    } else if (!impl->offsets) {
+      // No offsets provided, Identity Restriction
       bool has_backend_strides;
       ierr = CeedElemRestrictionHasBackendStrides(r, &has_backend_strides);
       CeedChkBackend(ierr);
@@ -121,6 +264,18 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
                 vv[n*strides[0] + k*strides[1] + (e+j)*strides[2]]
                 += uu[e*elem_size*num_comp + (k*elem_size+n)*blk_size + j - v_offset];
       }
+    } else if (comp_stride == 1 && num_comp > 1) {
+      // Offsets provided, interlaced components
+      // uu has shape [elem_size, num_comp, num_elem]
+      // vv has shape [nnodes, num_comp] with components contiguous per node
+      for (CeedInt e = start*blk_size; e < stop*blk_size; e+=blk_size)
+        for (CeedInt i = 0; i < elem_size*blk_size; i+=blk_size)
+          // Iteration bound set to discard padding elements
+          for (CeedInt j = i; j < i+CeedIntMin(blk_size, num_elem-e); j++) {
+            CeedScalar *vv_node = &vv[impl->offsets[j+e*elem_size]];
+            for (CeedInt k = 0; k < num_comp; k++)
+              vv_node[k] += uu[elem_size*(k*blk_size+num_comp*e) + j - v_offset];
+          }
     } else {
       // Offsets provided, standard or blocked restriction
       // uu has shape [elem_size, num_comp, num_elem]
@@ -176,6 +331,22 @@ static int CeedElemRestrictionApply_Ref_181(CeedElemRestriction r,
          u, v, request);
 }
 
+static int CeedElemRestrictionApply_Ref_211(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 2, 1, 1, start, stop, t_mode,
+         u, v, request);
+}
+
+static int CeedElemRestrictionApply_Ref_281(CeedElemRestriction r,
+    const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
+  return CeedElemRestrictionApply_Ref_Core(r, 2, 8, 1, start, stop, t_mode,
+         u, v, request);
+}
+
 static int CeedElemRestrictionApply_Ref_310(CeedElemRestriction r,
     const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
     CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u,
@@ -281,6 +452,125 @@ static int CeedElemRestrictionApplyBlock_Ref(CeedElemRestriction r,
                      u, v, request);
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Setup
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetupTranspose_Ref(CeedElemRestriction r,
+    CeedElemRestrictionTranspose_Ref **transpose) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+  *transpose = CeedAtomicLoad(impl->transpose);
+  if (*transpose) return CEED_ERROR_SUCCESS;
+
+  CeedInt num_elem, elem_size, num_blk, blk_size, num_comp, comp_stride, l_size;
+  ierr = CeedElemRestrictionGetNumElements(r, &num_elem); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elem_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumBlocks(r, &num_blk); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blk_size); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &num_comp); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetCompStride(r, &comp_stride); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(r, &l_size); CeedChkBackend(ierr);
+  const CeedInt *offsets = impl->offsets;
+  CeedInt strides[3] = {1, elem_size, elem_size*num_comp};
+  if (!offsets) {
+    bool has_backend_strides;
+    ierr = CeedElemRestrictionHasBackendStrides(r, &has_backend_strides);
+    CeedChkBackend(ierr);
+    if (!has_backend_strides) {
+      ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChkBackend(ierr);
+    }
+  }
+
+  // Count E-vector entries for each L-vector entry, discarding padding
+  CeedElemRestrictionTranspose_Ref *built;
+  CeedInt *t_offsets, *t_indices;
+  ierr = CeedCalloc(1, &built); CeedChkBackend(ierr);
+  ierr = CeedCalloc(l_size+1, &t_offsets); CeedChkBackend(ierr);
+  ierr = CeedMalloc(num_elem*elem_size*num_comp, &t_indices);
+  CeedChkBackend(ierr);
+  for (CeedInt pass = 0; pass < 2; pass++) {
+    for (CeedInt e = 0; e < num_blk*blk_size; e+=blk_size)
+      for (CeedInt k = 0; k < num_comp; k++)
+        for (CeedInt n = 0; n < elem_size; n++)
+          for (CeedInt j = 0; j < CeedIntMin(blk_size, num_elem-e); j++) {
+            const CeedInt l = offsets ?
+                              offsets[e*elem_size + n*blk_size + j] + k*comp_stride
+                              : n*strides[0] + k*strides[1] + (e+j)*strides[2];
+            if (pass == 0)
+              t_offsets[l+1]++;
+            else
+              t_indices[t_offsets[l]++] =
+                elem_size*(k*blk_size+num_comp*e) + n*blk_size + j;
+          }
+    // Prefix sum after counting, shift back after filling
+    if (pass == 0) {
+      for (CeedInt l = 0; l < l_size; l++)
+        t_offsets[l+1] += t_offsets[l];
+    } else {
+      for (CeedInt l = l_size; l > 0; l--)
+        t_offsets[l] = t_offsets[l-1];
+      t_offsets[0] = 0;
+    }
+  }
+  built->offsets = t_offsets;
+  built->indices = t_indices;
+
+  // Publish the CSR; if another thread published first, use its copy instead
+  CeedElemRestrictionTranspose_Ref *expected = NULL;
+  if (CeedAtomicCompareExchange(impl->transpose, expected, built)) {
+    *transpose = built;
+  } else {
+    ierr = CeedFree(&built->offsets); CeedChkBackend(ierr);
+    ierr = CeedFree(&built->indices); CeedChkBackend(ierr);
+    ierr = CeedFree(&built); CeedChkBackend(ierr);
+    *transpose = expected;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply Transpose Overwrite
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyTransposeOverwrite_Ref(CeedElemRestriction r,
+    CeedVector u, CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
+
+  // Structured and compressed restrictions keep their compact offsets and
+  //   accumulate into a zeroed L-vector instead of building the CSR
+  if (impl->is_structured || impl->comp_delta) {
+    ierr = CeedVectorSetValue(v, 0.0); CeedChkBackend(ierr);
+    return CeedElemRestrictionApply(r, CEED_TRANSPOSE, u, v, request);
+  }
+
+  CeedElemRestrictionTranspose_Ref *transpose;
+  ierr = CeedElemRestrictionSetupTranspose_Ref(r, &transpose);
+  CeedChkBackend(ierr);
+  CeedInt l_size;
+  ierr = CeedElemRestrictionGetLVectorSize(r, &l_size); CeedChkBackend(ierr);
+  const CeedScalar *uu;
+  CeedScalar *vv;
+
+  // Gather contributions to each L-vector entry, so every entry is written once
+  // Perform: v = r^T * u
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChkBackend(ierr);
+  ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &vv); CeedChkBackend(ierr);
+  const CeedInt *t_offsets = transpose->offsets, *t_indices = transpose->indices;
+  for (CeedInt l = 0; l < l_size; l++) {
+    CeedScalar sum = 0.0;
+    for (CeedInt t = t_offsets[l]; t < t_offsets[l+1]; t++)
+      sum += uu[t_indices[t]];
+    vv[l] = sum;
+  }
+  ierr = CeedVectorRestoreArrayRead(u, &uu); CeedChkBackend(ierr);
+  ierr = CeedVectorRestoreArray(v, &vv); CeedChkBackend(ierr);
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Get Offsets
 //------------------------------------------------------------------------------
@@ -297,10 +587,71 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr,
     return CeedError(ceed, CEED_ERROR_BACKEND, "Can only provide to HOST memory");
   // LCOV_EXCL_STOP
 
+  // Structured and compressed restrictions decode offsets into a temporary
+  //   array, freed by RestoreOffsets, so their compact storage is kept
+  if (impl->is_structured || impl->comp_delta) {
+    CeedInt num_elem, elem_size, num_blk, blk_size;
+    CeedInt *offsets_decoded;
+    ierr = CeedElemRestrictionGetNumElements(rstr, &num_elem);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetElementSize(rstr, &elem_size);
+    CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetNumBlocks(rstr, &num_blk); CeedChkBackend(ierr);
+    ierr = CeedElemRestrictionGetBlockSize(rstr, &blk_size); CeedChkBackend(ierr);
+    CeedInt elem_offsets[elem_size], elem_1d[3] = {0, 0, 0};
+    ierr = CeedMalloc(num_blk*blk_size*elem_size, &offsets_decoded);
+    CeedChkBackend(ierr);
+    for (CeedInt e = 0; e < num_blk*blk_size; e+=blk_size)
+      for (CeedInt j = 0; j < blk_size; j++) {
+        const CeedInt elem = CeedIntMin(e+j, num_elem-1);
+        if (impl->is_structured) {
+          CeedElemRestrictionStructuredOffsets_Ref(impl, elem_1d, elem_offsets);
+          if (e+j < num_elem-1)
+            CeedElemRestrictionStructuredNext_Ref(impl, elem_1d);
+        } else
+          for (CeedInt n = 0; n < elem_size; n++)
+            elem_offsets[n] = impl->comp_base[elem] +
+                              impl->comp_delta[elem*elem_size + n];
+        for (CeedInt n = 0; n < elem_size; n++)
+          offsets_decoded[e*elem_size + n*blk_size + j] = elem_offsets[n];
+      }
+    *offsets = offsets_decoded;
+    return CEED_ERROR_SUCCESS;
+  }
+
   *offsets = impl->offsets;
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Restore Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionRestoreOffsets_Ref(CeedElemRestriction rstr,
+    const CeedInt **offsets) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(rstr, &impl); CeedChkBackend(ierr);
+
+  if (impl->is_structured || impl->comp_delta) {
+    ierr = CeedFree(offsets); CeedChkBackend(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Get Compressed Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetCompressedOffsets_Ref(CeedElemRestriction rstr,
+    const CeedInt **base, const uint16_t **delta) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(rstr, &impl); CeedChkBackend(ierr);
+
+  *base = impl->comp_base;
+  *delta = impl->comp_delta;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Destroy
 //------------------------------------------------------------------------------
@@ -310,6 +661,16 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction r) {
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChkBackend(ierr);
 
   ierr = CeedFree(&impl->offsets_allocated); CeedChkBackend(ierr);
+  for (CeedInt d=0; d<3; d++) {
+    ierr = CeedFree(&impl->struct_offsets_1d[d]); CeedChkBackend(ierr);
+  }
+  ierr = CeedFree(&impl->comp_base_allocated); CeedChkBackend(ierr);
+  ierr = CeedFree(&impl->comp_delta_allocated); CeedChkBackend(ierr);
+  if (impl->transpose) {
+    ierr = CeedFree(&impl->transpose->offsets); CeedChkBackend(ierr);
+    ierr = CeedFree(&impl->transpose->indices); CeedChkBackend(ierr);
+    ierr = CeedFree(&impl->transpose); CeedChkBackend(ierr);
+  }
   ierr = CeedFree(&impl); CeedChkBackend(ierr);
   return CEED_ERROR_SUCCESS;
 }
@@ -339,9 +700,61 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   ierr = CeedCalloc(1, &impl); CeedChkBackend(ierr);
 
   // Offsets data
-  bool is_strided;
+  bool is_strided, is_structured, is_compressed;
+  CeedElemRestriction rstr_base;
   ierr = CeedElemRestrictionIsStrided(r, &is_strided); CeedChkBackend(ierr);
-  if (!is_strided) {
+  ierr = CeedElemRestrictionIsStructured(r, &is_structured); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionIsCompressed(r, &is_compressed); CeedChkBackend(ierr);
+  ierr = CeedElemRestrictionGetSharedBase(r, &rstr_base); CeedChkBackend(ierr);
+  if (rstr_base) {
+    // Blocked restriction sharing the offsets of an unblocked restriction,
+    //   which may have been created by another backend
+    ierr = CeedElemRestrictionGetCompressedOffsets(rstr_base, &impl->comp_base,
+           &impl->comp_delta); CeedChkBackend(ierr);
+    if (!impl->comp_delta) {
+      // Uncompressed offsets are permuted into the blocked layout
+      const CeedInt *offsets_base;
+      ierr = CeedElemRestrictionGetOffsets(rstr_base, CEED_MEM_HOST,
+                                           &offsets_base); CeedChkBackend(ierr);
+      ierr = CeedMalloc(num_blk*blk_size*elem_size, &impl->offsets_allocated);
+      CeedChkBackend(ierr);
+      for (CeedInt e = 0; e < num_blk*blk_size; e+=blk_size)
+        for (CeedInt j = 0; j < blk_size; j++)
+          for (CeedInt n = 0; n < elem_size; n++)
+            impl->offsets_allocated[e*elem_size + n*blk_size + j] =
+              offsets_base[CeedIntMin(e+j, num_elem-1)*elem_size + n];
+      ierr = CeedElemRestrictionRestoreOffsets(rstr_base, &offsets_base);
+      CeedChkBackend(ierr);
+      impl->offsets = impl->offsets_allocated;
+    }
+  } else if (is_structured) {
+    // Offsets are computed from the structure instead of stored
+    //   from the offsets of the element nodes along each direction
+    CeedInt num_elem_1d[3], stride = 1;
+    bool is_periodic[3];
+    ierr = CeedElemRestrictionGetStructure(r, &impl->struct_dim, &num_elem_1d,
+                                           &impl->struct_P_1d, &is_periodic);
+    CeedChkBackend(ierr);
+    const CeedInt P = impl->struct_P_1d;
+    for (CeedInt d=0; d<3; d++) {
+      impl->struct_num_elem[d] = num_elem_1d[d];
+      ierr = CeedCalloc(num_elem_1d[d]*P, &impl->struct_offsets_1d[d]);
+      CeedChkBackend(ierr);
+      if (d >= impl->struct_dim) continue;
+      const CeedInt num_nodes_1d = num_elem_1d[d]*(P-1) + !is_periodic[d];
+      for (CeedInt e_d=0; e_d<num_elem_1d[d]; e_d++)
+        for (CeedInt i=0; i<P; i++) {
+          CeedInt node = e_d*(P-1) + i;
+          if (node >= num_nodes_1d) node -= num_nodes_1d;
+          impl->struct_offsets_1d[d][e_d*P + i] = node*stride;
+        }
+      stride *= num_nodes_1d;
+    }
+    impl->is_structured = true;
+    if (copy_mode == CEED_OWN_POINTER) {
+      ierr = CeedFree(&offsets); CeedChkBackend(ierr);
+    }
+  } else if (!is_strided) {
     // Check indices for ref or memcheck backends
     Ceed parent_ceed = ceed, curr_ceed = NULL;
     while (parent_ceed != curr_ceed) {
@@ -366,21 +779,53 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
       // LCOV_EXCL_STOP
     }
 
-    // Copy data
-    switch (copy_mode) {
-    case CEED_COPY_VALUES:
-      ierr = CeedMalloc(num_elem*elem_size, &impl->offsets_allocated);
+    // Compress offsets as element base and 16-bit node deltas, if requested
+    //   and the offsets of every element span fewer than 2^16 nodes
+    bool use_compressed = is_compressed && blk_size == 1;
+    for (CeedInt e = 0; use_compressed && e < num_elem; e++) {
+      CeedInt min = offsets[e*elem_size], max = offsets[e*elem_size];
+      for (CeedInt n = 1; n < elem_size; n++) {
+        min = CeedIntMin(min, offsets[e*elem_size + n]);
+        max = CeedIntMax(max, offsets[e*elem_size + n]);
+      }
+      use_compressed = max - min <= UINT16_MAX;
+    }
+    if (use_compressed) {
+      ierr = CeedMalloc(num_elem, &impl->comp_base_allocated);
       CeedChkBackend(ierr);
-      memcpy(impl->offsets_allocated, offsets,
-             num_elem * elem_size * sizeof(offsets[0]));
-      impl->offsets = impl->offsets_allocated;
-      break;
-    case CEED_OWN_POINTER:
-      impl->offsets_allocated = (CeedInt *)offsets;
-      impl->offsets = impl->offsets_allocated;
-      break;
-    case CEED_USE_POINTER:
-      impl->offsets = offsets;
+      ierr = CeedMalloc(num_elem*elem_size, &impl->comp_delta_allocated);
+      CeedChkBackend(ierr);
+      for (CeedInt e = 0; e < num_elem; e++) {
+        CeedInt min = offsets[e*elem_size];
+        for (CeedInt n = 1; n < elem_size; n++)
+          min = CeedIntMin(min, offsets[e*elem_size + n]);
+        impl->comp_base_allocated[e] = min;
+        for (CeedInt n = 0; n < elem_size; n++)
+          impl->comp_delta_allocated[e*elem_size + n] =
+            (uint16_t)(offsets[e*elem_size + n] - min);
+      }
+      impl->comp_base = impl->comp_base_allocated;
+      impl->comp_delta = impl->comp_delta_allocated;
+      if (copy_mode == CEED_OWN_POINTER) {
+        ierr = CeedFree(&offsets); CeedChkBackend(ierr);
+      }
+    } else {
+      // Copy data
+      switch (copy_mode) {
+      case CEED_COPY_VALUES:
+        ierr = CeedMalloc(num_elem*elem_size, &impl->offsets_allocated);
+        CeedChkBackend(ierr);
+        memcpy(impl->offsets_allocated, offsets,
+               num_elem * elem_size * sizeof(offsets[0]));
+        impl->offsets = impl->offsets_allocated;
+        break;
+      case CEED_OWN_POINTER:
+        impl->offsets_allocated = (CeedInt *)offsets;
+        impl->offsets = impl->offsets_allocated;
+        break;
+      case CEED_USE_POINTER:
+        impl->offsets = offsets;
+      }
     }
   }
 
@@ -392,9 +837,20 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlock",
                                 CeedElemRestrictionApplyBlock_Ref);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r,
+                                "ApplyTransposeOverwrite",
+                                CeedElemRestrictionApplyTransposeOverwrite_Ref);
+  CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets",
                                 CeedElemRestrictionGetOffsets_Ref);
   CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "RestoreOffsets",
+                                CeedElemRestrictionRestoreOffsets_Ref);
+  CeedChkBackend(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r,
+                                "GetCompressedOffsets",
+                                CeedElemRestrictionGetCompressedOffsets_Ref);
+  CeedChkBackend(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy",
                                 CeedElemRestrictionDestroy_Ref); CeedChkBackend(ierr);
 
@@ -415,6 +871,12 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   case 181:
     impl->Apply = CeedElemRestrictionApply_Ref_181;
     break;
+  case 211:
+    impl->Apply = CeedElemRestrictionApply_Ref_211;
+    break;
+  case 281:
+    impl->Apply = CeedElemRestrictionApply_Ref_281;
+    break;
   case 310:
     impl->Apply = CeedElemRestrictionApply_Ref_310;
     break;
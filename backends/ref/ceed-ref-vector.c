@@ -92,7 +92,7 @@ static int CeedVectorGetArray_Ref(CeedVector vec, CeedMemType mem_type,
     return CeedError(ceed, CEED_ERROR_BACKEND, "Can only provide to HOST memory");
   // LCOV_EXCL_STOP
   if (!impl->array) { // Allocate if array is not yet allocated
-    ierr = CeedVectorSetArray(vec, CEED_MEM_HOST, CEED_COPY_VALUES, NULL);
+    ierr = CeedVectorSetArray_Ref(vec, CEED_MEM_HOST, CEED_COPY_VALUES, NULL);
     CeedChkBackend(ierr);
   }
   *array = impl->array;
@@ -115,7 +115,7 @@ static int CeedVectorGetArrayRead_Ref(CeedVector vec, CeedMemType mem_type,
     return CeedError(ceed, CEED_ERROR_BACKEND, "Can only provide to HOST memory");
   // LCOV_EXCL_STOP
   if (!impl->array) { // Allocate if array is not yet allocated
-    ierr = CeedVectorSetArray(vec, CEED_MEM_HOST, CEED_COPY_VALUES, NULL);
+    ierr = CeedVectorSetArray_Ref(vec, CEED_MEM_HOST, CEED_COPY_VALUES, NULL);
     CeedChkBackend(ierr);
   }
   *array = impl->array;
@@ -24,6 +24,7 @@
 
 typedef struct {
   CeedScalar *collograd1d;
+  CeedScalar *chebyshev_interp_1d;
   bool collo_interp;
 } CeedBasis_Ref;
 
@@ -32,17 +33,31 @@ typedef struct {
   CeedScalar *array_allocated;
 } CeedVector_Ref;
 
+typedef struct {
+  CeedInt *offsets;             /* transpose CSR, L-vector entry to E-vector */
+  CeedInt *indices;             /*   entries */
+} CeedElemRestrictionTranspose_Ref;
+
 typedef struct {
   const CeedInt *offsets;
   CeedInt *offsets_allocated;
+  bool is_structured;           /* offsets computed from mesh structure */
+  CeedInt struct_dim, struct_P_1d;
+  CeedInt struct_num_elem[3];   /* number of elements in each direction */
+  CeedInt *struct_offsets_1d[3]; /* L-vector offsets of the nodes of each
+                                    element along each direction */
+  const CeedInt *comp_base;     /* compressed offsets, base for each element */
+  const uint16_t *comp_delta;   /* compressed offsets, delta for each node */
+  CeedInt *comp_base_allocated;
+  uint16_t *comp_delta_allocated;
   int (*Apply)(CeedElemRestriction, const CeedInt, const CeedInt,
                const CeedInt, CeedInt, CeedInt, CeedTransposeMode, CeedVector,
                CeedVector, CeedRequest *);
+  CeedElemRestrictionTranspose_Ref *transpose; /* built on first overwrite
+                                                   apply, published atomically */
 } CeedElemRestriction_Ref;
 
 typedef struct {
-  const CeedScalar **inputs;
-  CeedScalar **outputs;
   bool setup_done;
 } CeedQFunction_Ref;
 
@@ -53,8 +68,10 @@ typedef struct {
 
 typedef struct {
   bool is_identity_qf, is_identity_restr_op;
+  bool is_active_setup_done; /* Active E-vectors are created on first apply */
   CeedVector
-  *e_vecs;   /* E-vectors needed to apply operator (input followed by outputs) */
+  *e_vecs;   /* E-vectors needed to apply operator (input followed by outputs),
+                  NULL for passive inputs read in place */
   CeedScalar **e_data;
   uint64_t *input_state;   /* State counter of inputs */
   CeedVector *e_vecs_in;   /* Input E-vectors needed to apply operator */
@@ -64,7 +81,8 @@ typedef struct {
   CeedInt    num_e_vecs_in;
   CeedInt    num_e_vecs_out;
   CeedInt    qf_num_active_in, qf_num_active_out;
-  CeedVector *qf_active_in;
+  CeedVector *qf_q_vecs_in;   /* Q-vectors with all linearization directions */
+  CeedVector *qf_q_vecs_out;
 } CeedOperator_Ref;
 
 CEED_INTERN int CeedVectorCreate_Ref(CeedInt n, CeedVector vec);
@@ -63,18 +63,25 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
   CeedTensorContract_Xsmm *impl;
   ierr = CeedTensorContractGetData(contract, &impl); CeedChkBackend(ierr);
 
-  // Get kernel
-  libxsmm_smmfunction kernel;
-  CeedHashIJKLMKey key = {B, C, J, t_mode, add};
-  khint_t k = kh_get(f32, impl->lookup_f32, key);
-  CeedHashGetValue(impl->lookup_f32, k, kernel);
-
   // Run kernel or fallback to default implementation
-  if (C != 1)
-    for (CeedInt a=0; a<A; a++)
-      kernel(&u[a*B*C], &t[0], &v[a*J*C], NULL, NULL, NULL);
-  else
+  if (C != 1) {
+    // Get kernel
+    libxsmm_smmfunction kernel;
+    CeedHashIJKLMKey key = {B, C, J, t_mode, add};
+    khint_t k = kh_get(f32, impl->lookup_f32, key);
+    CeedHashGetValue(impl->lookup_f32, k, kernel);
+
+    // The a slices are a strided batch of identical GEMMs sharing t; the
+    //   kernel is dispatched with LIBXSMM_PREFETCH_AUTO, so the operands for
+    //   the next a are prefetched while the current GEMM runs
+    for (CeedInt a=0; a<A; a++) {
+      const CeedInt a_next = a < A-1 ? a+1 : a;
+      kernel(&u[a*B*C], &t[0], &v[a*J*C],
+             &u[a_next*B*C], &t[0], &v[a_next*J*C]);
+    }
+  } else {
     CeedTensorContract_Xsmm_C1(contract, A, B, C, J, t, t_mode, add, u, v);
+  }
 
   return CEED_ERROR_SUCCESS;
 }
@@ -108,6 +115,7 @@ int CeedTensorContractCreate_f32_Xsmm(CeedBasis basis,
 
   // Setup kernels hash table
   impl->lookup_f32 = kh_init(f32);
+  const int prefetch = LIBXSMM_PREFETCH_AUTO;
 
   // Set up pointers to kernels
   ierr = CeedBasisIsTensor(basis, &impl->is_tensor); CeedChkBackend(ierr);
@@ -134,7 +142,7 @@ int CeedTensorContractCreate_f32_Xsmm(CeedBasis basis,
                 float alpha = 1.0, beta = 1.0;
                 if (!add) beta = 0.0;
                 libxsmm_smmfunction kernel = libxsmm_smmdispatch(
-                                               C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
+                                               C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, &prefetch);
                 if (!kernel)
                   // LCOV_EXCL_START
                   return CeedError(ceed, CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
@@ -166,7 +174,7 @@ int CeedTensorContractCreate_f32_Xsmm(CeedBasis basis,
               float alpha = 1.0, beta = 1.0;
               if (!add) beta = 0.0;
               libxsmm_smmfunction kernel = libxsmm_smmdispatch(
-                                             C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
+                                             C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, &prefetch);
               if (!kernel)
                 // LCOV_EXCL_START
                 return CeedError(ceed, CEED_ERROR_BACKEND, "LIBXSMM kernel failed to build.");
@@ -267,17 +267,19 @@ struct AdvectionContext_ {
 
 // Struct that contains all enums and structs used for the physics of all problems
 struct Physics_private {
-  DCContext            dc_ctx;
-  EulerContext         euler_ctx;
-  AdvectionContext     advection_ctx;
-  WindType             wind_type;
-  BubbleType           bubble_type;
-  BubbleContinuityType bubble_continuity_type;
-  EulerTestType        euler_test;
-  StabilizationType    stab;
-  PetscBool            implicit;
-  PetscBool            has_curr_time;
-  PetscBool            has_neumann;
+  DCContext             dc_ctx;
+  EulerContext          euler_ctx;
+  AdvectionContext      advection_ctx;
+  WindType              wind_type;
+  BubbleType            bubble_type;
+  BubbleContinuityType  bubble_continuity_type;
+  EulerTestType         euler_test;
+  StabilizationType     stab;
+  PetscBool             implicit;
+  PetscBool             has_curr_time;
+  PetscBool             has_neumann;
+  CeedQFunctionContext  time_context;
+  CeedContextFieldLabel solution_time_label;
 };
 
 // Problem specific data
@@ -17,6 +17,7 @@
 /// @file
 /// Utility functions for setting up EULER_VORTEX
 
+#include <stddef.h>
 #include "../navierstokes.h"
 #include "../qfunctions/setupgeo.h"
 #include "../qfunctions/eulervortex.h"
@@ -180,6 +181,12 @@ PetscErrorCode SetupContext_EULER_VORTEX(Ceed ceed, CeedData ceed_data,
   CeedQFunctionContextSetData(ceed_data->euler_context, CEED_MEM_HOST,
                               CEED_USE_POINTER,
                               sizeof(*phys->euler_ctx), phys->euler_ctx);
+  CeedQFunctionContextRegisterDouble(ceed_data->euler_context, "solution time",
+                                     offsetof(struct EulerContext_, curr_time), 1,
+                                     "Physical time of the solution");
+  phys->time_context = ceed_data->euler_context;
+  CeedQFunctionContextGetFieldLabel(ceed_data->euler_context, "solution time",
+                                    &phys->solution_time_label);
   if (ceed_data->qf_ics)
     CeedQFunctionSetContext(ceed_data->qf_ics, ceed_data->euler_context);
   if (ceed_data->qf_apply_sur)
@@ -26,7 +26,7 @@ PetscErrorCode ComputeLumpedMassMatrix(Ceed ceed, DM dm, CeedData ceed_data,
   Vec            M_loc;
   CeedQFunction  qf_mass;
   CeedOperator   op_mass;
-  CeedVector     m_ceed, ones_vec;
+  CeedVector     m_ceed;
   CeedInt        num_comp_q, q_data_size;
   PetscErrorCode ierr;
   PetscFunctionBeginUser;
@@ -35,8 +35,6 @@ PetscErrorCode ComputeLumpedMassMatrix(Ceed ceed, DM dm, CeedData ceed_data,
   CeedElemRestrictionGetNumComponents(ceed_data->elem_restr_q, &num_comp_q);
   CeedElemRestrictionGetNumComponents(ceed_data->elem_restr_qd_i, &q_data_size);
   CeedElemRestrictionCreateVector(ceed_data->elem_restr_q, &m_ceed, NULL);
-  CeedElemRestrictionCreateVector(ceed_data->elem_restr_q, &ones_vec, NULL);
-  CeedVectorSetValue(ones_vec, 1.0);
 
   // CEED QFunction
   CeedQFunctionCreateInterior(ceed, 1, Mass, Mass_loc, &qf_mass);
@@ -57,12 +55,14 @@ PetscErrorCode ComputeLumpedMassMatrix(Ceed ceed, DM dm, CeedData ceed_data,
   CeedScalar *m;
   PetscMemType m_mem_type;
   ierr = DMGetLocalVector(dm, &M_loc); CHKERRQ(ierr);
+  ierr = VecZeroEntries(M_loc); CHKERRQ(ierr);
   ierr = VecGetArrayAndMemType(M_loc, (PetscScalar **)&m, &m_mem_type);
   CHKERRQ(ierr);
   CeedVectorSetArray(m_ceed, MemTypeP2C(m_mem_type), CEED_USE_POINTER, m);
 
-  // Apply CEED Operator
-  CeedOperatorApply(op_mass, ones_vec, m_ceed, CEED_REQUEST_IMMEDIATE);
+  // Assemble row-sum lumped mass from the QFunction and basis
+  CeedOperatorLinearAssembleAddLumpedDiagonal(op_mass, m_ceed,
+      CEED_REQUEST_IMMEDIATE);
 
   // Restore vectors
   CeedVectorTakeArray(m_ceed, MemTypeP2C(m_mem_type), NULL);
@@ -78,7 +78,6 @@ PetscErrorCode ComputeLumpedMassMatrix(Ceed ceed, DM dm, CeedData ceed_data,
   ierr = VecReciprocal(M); CHKERRQ(ierr);
 
   // Cleanup
-  CeedVectorDestroy(&ones_vec);
   CeedVectorDestroy(&m_ceed);
   CeedQFunctionDestroy(&qf_mass);
   CeedOperatorDestroy(&op_mass);
@@ -99,7 +98,11 @@ PetscErrorCode RHS_NS(TS ts, PetscReal t, Vec Q, Vec G, void *user_data) {
   PetscFunctionBeginUser;
 
   // Update EulerContext
-  if (user->phys->has_curr_time) user->phys->euler_ctx->curr_time = t;
+  if (user->phys->has_curr_time) {
+    const double time = t;
+    CeedQFunctionContextSetDouble(user->phys->time_context,
+                                  user->phys->solution_time_label, &time);
+  }
 
   // Get local vectors
   ierr = DMGetLocalVector(user->dm, &Q_loc); CHKERRQ(ierr);
@@ -156,7 +159,11 @@ PetscErrorCode IFunction_NS(TS ts, PetscReal t, Vec Q, Vec Q_dot, Vec G,
   PetscFunctionBeginUser;
 
   // Update EulerContext
-  if (user->phys->has_curr_time) user->phys->euler_ctx->curr_time = t;
+  if (user->phys->has_curr_time) {
+    const double time = t;
+    CeedQFunctionContextSetDouble(user->phys->time_context,
+                                  user->phys->solution_time_label, &time);
+  }
 
   // Get local vectors
   ierr = DMGetLocalVector(user->dm, &Q_loc); CHKERRQ(ierr);
@@ -107,6 +107,8 @@ struct Ceed_private {
                                const CeedInt *, CeedElemRestriction);
   int (*ElemRestrictionCreateBlocked)(CeedMemType, CeedCopyMode,
                                       const CeedInt *, CeedElemRestriction);
+  int (*ElemRestrictionCreateStructured)(CeedMemType, CeedCopyMode,
+                                         const CeedInt *, CeedElemRestriction);
   int (*BasisCreateTensorH1)(CeedInt, CeedInt, CeedInt, const CeedScalar *,
                              const CeedScalar *, const CeedScalar *,
                              const CeedScalar *, CeedBasis);
@@ -121,6 +123,7 @@ struct Ceed_private {
   int (*CompositeOperatorCreate)(CeedOperator);
   int ref_count;
   bool is_deterministic;
+  bool has_compressed_qdata;     /* Operators decode compressed qdata */
   void *data;
   bool debug;
   char err_msg[CEED_MAX_RESOURCE_LEN];
@@ -138,6 +141,7 @@ struct CeedVector_private {
   int (*RestoreArray)(CeedVector);
   int (*RestoreArrayRead)(CeedVector);
   int (*Norm)(CeedVector, CeedNormType, CeedScalar *);
+  int (*Dot)(CeedVector, CeedVector, CeedScalar *);
   int (*Scale)(CeedVector, CeedScalar);
   int (*AXPY)(CeedVector, CeedScalar, CeedVector);
   int (*PointwiseMult)(CeedVector, CeedVector, CeedVector);
@@ -147,16 +151,35 @@ struct CeedVector_private {
   CeedInt length;
   uint64_t state;
   uint64_t num_readers;
+  bool is_uniform;         /* values are uniform_value and not yet written to
+                                the backend array */
+  bool is_materializing;   /* a reader is writing uniform_value to the array */
+  bool is_borrowed;        /* array was set with CEED_USE_POINTER */
+  CeedScalar uniform_value;
   void *data;
 };
 
+// Coloring of the blocks of a CeedElemRestriction, see
+//   CeedElemRestrictionGetColoring()
+typedef struct {
+  CeedInt num_colors;
+  CeedInt *color_offsets; /* start of each color in color_blks */
+  CeedInt *color_blks;    /* blocks ordered by color */
+} CeedElemRestrictionColoring_private;
+typedef CeedElemRestrictionColoring_private *CeedElemRestrictionColoring;
+
 struct CeedElemRestriction_private {
   Ceed ceed;
   int (*Apply)(CeedElemRestriction, CeedTransposeMode, CeedVector, CeedVector,
                CeedRequest *);
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector,
                     CeedVector, CeedRequest *);
+  int (*ApplyTransposeOverwrite)(CeedElemRestriction, CeedVector, CeedVector,
+                                 CeedRequest *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*RestoreOffsets)(CeedElemRestriction, const CeedInt **);
+  int (*GetCompressedOffsets)(CeedElemRestriction, const CeedInt **,
+                              const uint16_t **);
   int (*Destroy)(CeedElemRestriction);
   int ref_count;
   CeedInt num_elem;      /* number of elements */
@@ -168,7 +191,17 @@ struct CeedElemRestriction_private {
   CeedInt blk_size;      /* number of elements in a batch */
   CeedInt num_blk;       /* number of blocks of elements */
   CeedInt *strides;      /* strides between [nodes, components, elements] */
+  CeedInt struct_dim;    /* dimension of structured restriction, 0 if the
+                              restriction is not structured */
+  CeedInt struct_P_1d;   /* number of nodes per element in each direction */
+  CeedInt struct_num_elem[3]; /* number of elements in each direction */
+  bool struct_is_periodic[3]; /* periodicity in each direction */
+  bool is_compressed;    /* flag for compressed offset storage request */
+  CeedElemRestriction rstr_base; /* restriction sharing its offset data with
+                                      this blocked restriction, if any */
   CeedInt layout[3];     /* E-vector layout [nodes, components, elements] */
+  CeedElemRestrictionColoring coloring; /* coloring of blocks, computed on
+                                              request */
   uint64_t num_readers;  /* number of instances of offset read only access */
   void *data;            /* place for the backend to store any data */
 };
@@ -177,6 +210,8 @@ struct CeedBasis_private {
   Ceed ceed;
   int (*Apply)(CeedBasis, CeedInt, CeedTransposeMode, CeedEvalMode,
                CeedVector, CeedVector);
+  int (*ApplyAtPoints)(CeedBasis, CeedInt, CeedInt, CeedTransposeMode,
+                       CeedEvalMode, CeedVector, CeedVector, CeedVector);
   int (*Destroy)(CeedBasis);
   int ref_count;
   bool tensor_basis;       /* flag for tensor basis */
@@ -205,6 +240,7 @@ struct CeedBasis_private {
   CeedScalar
   *grad_1d;   /* row-major matrix of shape [Q1d, P1d] matrix expressing
                    derivatives of nodal basis functions at quadrature points */
+  bool is_partition_of_unity; /* interpolation reproduces constants */
   CeedTensorContract contract; /* tensor contraction object */
   void *data;                  /* place for the backend to store any data */
 };
@@ -223,6 +259,8 @@ struct CeedQFunctionField_private {
   const char *field_name;
   CeedInt size;
   CeedEvalMode eval_mode;
+  bool is_symmetric;              /* Symmetric tensor, stored packed in
+                                       compressed quadrature data */
 };
 
 struct CeedQFunction_private {
@@ -256,10 +294,27 @@ struct CeedQFunctionContext_private {
   int (*RestoreData)(CeedQFunctionContext);
   int (*Destroy)(CeedQFunctionContext);
   uint64_t state;
+  uint64_t num_readers;
   size_t ctx_size;
+  CeedInt num_fields;
+  CeedInt max_fields;
+  CeedContextFieldLabel *field_labels;
+  size_t dirty_begin;
+  size_t dirty_end;
   void *data;
 };
 
+/// Struct describing a registered field in CeedQFunctionContext data
+/// @ingroup CeedQFunction
+struct CeedContextFieldLabel_private {
+  const char *name;
+  const char *description;
+  CeedContextFieldType type;
+  size_t size;
+  size_t num_values;
+  size_t offset;
+};
+
 /// Struct to handle the context data to use the Fortran QFunction stub
 /// @ingroup CeedQFunction
 struct CeedFortranContext_private {
@@ -282,6 +337,27 @@ struct CeedFortranContext_private {
 };
 typedef struct CeedFortranContext_private *CeedFortranContext;
 
+// Compressed passive quadrature data, see CeedOperatorCompressQData()
+typedef struct {
+  int ref_count;
+  CeedQDataStorage storage;
+  CeedInt num_elem, num_qpts, num_comp;
+  CeedInt num_comp_stored;        /* Fewer than num_comp for packed
+                                       symmetric tensors */
+  CeedInt *comp_map;              /* Stored component for each component */
+  void *values;                   /* Values, [elem][comp_stored][qpt] */
+  CeedScalar *scales;             /* Scale for each element and stored
+                                       component, NULL for CEED_QDATA_SCALAR */
+  CeedInt *elem_offsets;          /* Start of the values of each element,
+                                       NULL if all elements store all qpts */
+  bool *elem_is_constant;         /* Elements storing a single qpt, or NULL */
+  bool *comp_is_weighted;         /* Stored components of constant elements
+                                       holding values divided by the
+                                       quadrature weights, or NULL */
+  CeedScalar *q_weights;          /* Quadrature weights, or NULL */
+} CeedQDataCompressed_private;
+typedef CeedQDataCompressed_private *CeedQDataCompressed;
+
 struct CeedOperatorField_private {
   CeedElemRestriction elem_restr; /* Restriction from L-vector */
   CeedBasis basis;                /* Basis or CEED_BASIS_COLLOCATED for
@@ -289,17 +365,22 @@ struct CeedOperatorField_private {
   CeedVector vec;                 /* State vector for passive fields or
                                        CEED_VECTOR_NONE for no vector */
   const char *field_name;          /* matching QFunction field name */
+  CeedQDataCompressed qdata;      /* Compressed quadrature data replacing
+                                       vec, or NULL */
 };
 
 struct CeedOperator_private {
   Ceed ceed;
   CeedOperator op_fallback;
+  CeedOperator op_fallback_parent; /* Operator this fallback was created from */
   CeedQFunction qf_fallback;
   int ref_count;
   int (*LinearAssembleQFunction)(CeedOperator, CeedVector *,
                                  CeedElemRestriction *, CeedRequest *);
   int (*LinearAssembleQFunctionUpdate)(CeedOperator, CeedVector,
                                        CeedElemRestriction, CeedRequest *);
+  int (*LinearAssembleQFunctionElements)(CeedOperator, CeedInt, CeedInt,
+      CeedVector, CeedRequest *);
   int (*LinearAssembleDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssembleAddDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssemblePointBlockDiagonal)(CeedOperator, CeedVector,
@@ -313,8 +394,13 @@ struct CeedOperator_private {
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddMulti)(CeedOperator, CeedInt, CeedVector *, CeedVector *,
+                       CeedRequest *);
+  int (*ApplyAddElements)(CeedOperator, CeedInt, const CeedInt *, CeedScalar,
+                          CeedVector, CeedVector, CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector,
                        CeedVector, CeedRequest *);
+  int (*GetPassiveEVector)(CeedOperator, CeedInt, CeedVector *, CeedInt *);
   int (*Destroy)(CeedOperator);
   CeedOperatorField *input_fields;
   CeedOperatorField *output_fields;
@@ -31,6 +31,21 @@
 #define CEED_ALIGN 64
 #define CEED_COMPOSITE_MAX 16
 
+// Reference counts, reader counts, and lazily built backend data are updated
+//   atomically so objects may be shared between application threads.
+//   Sequentially consistent ordering lets an access lock and a reader count be
+//   checked against each other.
+#if defined(__GNUC__)
+#  define CeedAtomicAdd(x, v) __atomic_add_fetch(&(x), (v), __ATOMIC_SEQ_CST)
+#  define CeedAtomicLoad(x) __atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+#  define CeedAtomicStore(x, v) __atomic_store_n(&(x), (v), __ATOMIC_SEQ_CST)
+#  define CeedAtomicCompareExchange(x, expected, desired) \
+     __atomic_compare_exchange_n(&(x), &(expected), (desired), false, \
+                                 __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+#else
+#  error "libCEED requires a compiler with GNU atomic builtins"
+#endif
+
 /**
   @ingroup Ceed
   This macro provides the ability to disable optimization flags for functions that
@@ -116,6 +131,7 @@ CEED_EXTERN int CeedSetOperatorFallbackResource(Ceed ceed,
     const char *resource);
 CEED_EXTERN int CeedGetOperatorFallbackParentCeed(Ceed ceed, Ceed *parent);
 CEED_EXTERN int CeedSetDeterministic(Ceed ceed, bool is_deterministic);
+CEED_EXTERN int CeedSetCompressedQDataSupport(Ceed ceed, bool has_support);
 CEED_EXTERN int CeedSetBackendFunction(Ceed ceed,
                                        const char *type, void *object,
                                        const char *func_name, int (*f)());
@@ -128,6 +144,9 @@ CEED_EXTERN int CeedVectorAddReference(CeedVector vec);
 CEED_EXTERN int CeedVectorGetData(CeedVector vec, void *data);
 CEED_EXTERN int CeedVectorSetData(CeedVector vec, void *data);
 CEED_EXTERN int CeedVectorReference(CeedVector vec);
+CEED_EXTERN int CeedVectorIsUniform(CeedVector vec, bool *is_uniform,
+                                    CeedScalar *value);
+CEED_EXTERN int CeedVectorMaterialize(CeedVector vec);
 
 CEED_EXTERN int CeedElemRestrictionGetStrides(CeedElemRestriction rstr,
     CeedInt (*strides)[3]);
@@ -139,10 +158,26 @@ CEED_EXTERN int CeedElemRestrictionIsStrided(CeedElemRestriction rstr,
     bool *is_strided);
 CEED_EXTERN int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr,
     bool *has_backend_strides);
+CEED_EXTERN int CeedElemRestrictionIsCompressed(CeedElemRestriction rstr,
+    bool *is_compressed);
+CEED_EXTERN int CeedElemRestrictionGetSharedBase(CeedElemRestriction rstr,
+    CeedElemRestriction *rstr_base);
+CEED_EXTERN int CeedElemRestrictionGetCompressedOffsets(CeedElemRestriction rstr,
+    const CeedInt **base, const uint16_t **delta);
+CEED_EXTERN int CeedElemRestrictionIsStructured(CeedElemRestriction rstr,
+    bool *is_structured);
+CEED_EXTERN int CeedElemRestrictionGetStructure(CeedElemRestriction rstr,
+    CeedInt *dim, CeedInt (*num_elem_1d)[3], CeedInt *P_1d,
+    bool (*is_periodic)[3]);
 CEED_EXTERN int CeedElemRestrictionGetELayout(CeedElemRestriction rstr,
     CeedInt (*layout)[3]);
+CEED_EXTERN int CeedElemRestrictionGetColoring(CeedElemRestriction rstr,
+    CeedInt *num_colors, const CeedInt **color_offsets,
+    const CeedInt **color_blks);
 CEED_EXTERN int CeedElemRestrictionSetELayout(CeedElemRestriction rstr,
     CeedInt layout[3]);
+CEED_EXTERN int CeedElemRestrictionApplyTransposeOverwrite(
+  CeedElemRestriction rstr, CeedVector u, CeedVector ru, CeedRequest *request);
 CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr,
     void *data);
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr,
@@ -151,6 +186,8 @@ CEED_EXTERN int CeedElemRestrictionReference(CeedElemRestriction rstr);
 
 CEED_EXTERN int CeedBasisGetCollocatedGrad(CeedBasis basis,
     CeedScalar *colo_grad_1d);
+CEED_EXTERN int CeedBasisGetChebyshevInterp1D(CeedBasis basis,
+    CeedScalar *chebyshev_interp_1d);
 CEED_EXTERN int CeedHouseholderApplyQ(CeedScalar *A, const CeedScalar *Q,
                                       const CeedScalar *tau, CeedTransposeMode t_mode, CeedInt m, CeedInt n,
                                       CeedInt k, CeedInt row, CeedInt col);
@@ -213,6 +250,9 @@ CEED_EXTERN int CeedQFunctionContextGetBackendData(CeedQFunctionContext ctx,
 CEED_EXTERN int CeedQFunctionContextSetBackendData(CeedQFunctionContext ctx,
     void *data);
 CEED_EXTERN int CeedQFunctionContextReference(CeedQFunctionContext ctx);
+CEED_EXTERN int CeedQFunctionContextGetDirtyRange(CeedQFunctionContext ctx,
+    size_t *begin, size_t *end);
+CEED_EXTERN int CeedQFunctionContextClearDirtyRange(CeedQFunctionContext ctx);
 
 CEED_EXTERN int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *num_args);
 CEED_EXTERN int CeedOperatorIsSetupDone(CeedOperator op, bool *is_setup_done);
@@ -225,6 +265,13 @@ CEED_EXTERN int CeedOperatorGetData(CeedOperator op, void *data);
 CEED_EXTERN int CeedOperatorSetData(CeedOperator op, void *data);
 CEED_EXTERN int CeedOperatorReference(CeedOperator op);
 CEED_EXTERN int CeedOperatorSetSetupDone(CeedOperator op);
+CEED_INTERN int CeedOperatorCreateFallback(CeedOperator op);
+CEED_EXTERN int CeedOperatorGetFallbackPassiveEVector(CeedOperator op,
+    CeedInt input_field, CeedVector *e_vec, CeedInt *blk_size);
+CEED_EXTERN int CeedOperatorFieldIsQDataCompressed(CeedOperatorField op_field,
+    bool *is_compressed);
+CEED_EXTERN int CeedOperatorFieldDecompressQData(CeedOperatorField op_field,
+    CeedInt first_elem, CeedInt blk_size, CeedScalar *values);
 
 CEED_INTERN int CeedMatrixMultiply(Ceed ceed, const CeedScalar *mat_A,
                                    const CeedScalar *mat_B, CeedScalar *mat_C,
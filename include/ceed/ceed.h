@@ -168,6 +168,9 @@ typedef struct CeedOperatorField_private *CeedOperatorField;
 /// Handle for object describing context data for CeedQFunctions
 /// @ingroup CeedQFunctionUser
 typedef struct CeedQFunctionContext_private *CeedQFunctionContext;
+/// Handle for object describing a registered field in CeedQFunctionContext data
+/// @ingroup CeedQFunctionUser
+typedef struct CeedContextFieldLabel_private *CeedContextFieldLabel;
 /// Handle for object describing FE-type operators acting on vectors
 ///
 /// Given an element restriction \f$E\f$, basis evaluator \f$B\f$, and
@@ -352,6 +355,7 @@ CEED_EXTERN int CeedVectorRestoreArrayRead(CeedVector vec,
     const CeedScalar **array);
 CEED_EXTERN int CeedVectorNorm(CeedVector vec, CeedNormType type,
                                CeedScalar *norm);
+CEED_EXTERN int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result);
 CEED_EXTERN int CeedVectorScale(CeedVector x, CeedScalar alpha);
 CEED_EXTERN int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x);
 CEED_EXTERN int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y);
@@ -416,6 +420,14 @@ CEED_EXTERN int CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem,
 CEED_EXTERN int CeedElemRestrictionCreateStrided(Ceed ceed,
     CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt l_size,
     const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateCompressed(Ceed ceed,
+    CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride,
+    CeedInt l_size, CeedMemType mem_type, CeedCopyMode copy_mode,
+    const CeedInt *offsets, CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateStructured(Ceed ceed, CeedInt dim,
+    const CeedInt *num_elem_1d, CeedInt P_1d, const bool *is_periodic,
+    CeedInt num_comp, CeedInt comp_stride, CeedInt l_size,
+    CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem,
     CeedInt elem_size, CeedInt blk_size, CeedInt num_comp, CeedInt comp_stride,
     CeedInt l_size, CeedMemType mem_type, CeedCopyMode copy_mode,
@@ -423,6 +435,12 @@ CEED_EXTERN int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem,
 CEED_EXTERN int CeedElemRestrictionCreateBlockedStrided(Ceed ceed,
     CeedInt num_elem, CeedInt elem_size, CeedInt blk_size, CeedInt num_comp,
     CeedInt l_size, const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateBlockedShared(
+    CeedElemRestriction rstr, CeedInt blk_size, CeedElemRestriction *blk_rstr);
+CEED_EXTERN int CeedElemRestrictionCreateBlockedStructured(Ceed ceed,
+    CeedInt dim, const CeedInt *num_elem_1d, CeedInt P_1d,
+    const bool *is_periodic, CeedInt blk_size, CeedInt num_comp,
+    CeedInt comp_stride, CeedInt l_size, CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionReferenceCopy(CeedElemRestriction rstr,
     CeedElemRestriction *rstr_copy);
 CEED_EXTERN int CeedElemRestrictionCreateVector(CeedElemRestriction rstr,
@@ -535,6 +553,10 @@ CEED_EXTERN int CeedBasisView(CeedBasis basis, FILE *stream);
 CEED_EXTERN int CeedBasisApply(CeedBasis basis, CeedInt num_elem,
                                CeedTransposeMode t_mode,
                                CeedEvalMode eval_mode, CeedVector u, CeedVector v);
+CEED_EXTERN int CeedBasisApplyAtPoints(CeedBasis basis, CeedInt num_elem,
+                                       CeedInt num_points, CeedTransposeMode t_mode,
+                                       CeedEvalMode eval_mode, CeedVector x_ref,
+                                       CeedVector u, CeedVector v);
 CEED_EXTERN int CeedBasisGetCeed(CeedBasis basis, Ceed *ceed);
 CEED_EXTERN int CeedBasisGetDimension(CeedBasis basis, CeedInt *dim);
 CEED_EXTERN int CeedBasisGetTopology(CeedBasis basis, CeedElemTopology *topo);
@@ -607,6 +629,8 @@ CEED_EXTERN int CeedQFunctionGetFields(CeedQFunction qf,
                                        CeedQFunctionField **input_fields,
                                        CeedInt *num_output_fields,
                                        CeedQFunctionField **output_fields);
+CEED_EXTERN int CeedQFunctionSetFieldSymmetric(CeedQFunction qf,
+    const char *field_name);
 CEED_EXTERN int CeedQFunctionSetContext(CeedQFunction qf,
                                         CeedQFunctionContext ctx);
 CEED_EXTERN int CeedQFunctionView(CeedQFunction qf, FILE *stream);
@@ -621,6 +645,18 @@ CEED_EXTERN int CeedQFunctionFieldGetSize(CeedQFunctionField qf_field,
     CeedInt *size);
 CEED_EXTERN int CeedQFunctionFieldGetEvalMode(CeedQFunctionField qf_field,
     CeedEvalMode *eval_mode);
+CEED_EXTERN int CeedQFunctionFieldIsSymmetric(CeedQFunctionField qf_field,
+    bool *is_symmetric);
+
+/// Data type of a registered CeedQFunctionContext field
+/// @ingroup CeedQFunction
+typedef enum {
+  /// Double precision values
+  CEED_CONTEXT_FIELD_DOUBLE = 1,
+  /// 32 bit integer values
+  CEED_CONTEXT_FIELD_INT32 = 2,
+} CeedContextFieldType;
+CEED_EXTERN const char *const CeedContextFieldTypes[];
 
 CEED_EXTERN int CeedQFunctionContextCreate(Ceed ceed,
     CeedQFunctionContext *ctx);
@@ -634,12 +670,63 @@ CEED_EXTERN int CeedQFunctionContextGetData(CeedQFunctionContext ctx,
     CeedMemType mem_type, void *data);
 CEED_EXTERN int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx,
     void *data);
+CEED_EXTERN int CeedQFunctionContextGetDataRead(CeedQFunctionContext ctx,
+    CeedMemType mem_type, void *data);
+CEED_EXTERN int CeedQFunctionContextRestoreDataRead(CeedQFunctionContext ctx,
+    void *data);
 CEED_EXTERN int CeedQFunctionContextGetContextSize(CeedQFunctionContext ctx,
     size_t *ctx_size);
+CEED_EXTERN int CeedQFunctionContextRegisterDouble(CeedQFunctionContext ctx,
+    const char *field_name, size_t field_offset, size_t num_values,
+    const char *field_description);
+CEED_EXTERN int CeedQFunctionContextRegisterInt32(CeedQFunctionContext ctx,
+    const char *field_name, size_t field_offset, size_t num_values,
+    const char *field_description);
+CEED_EXTERN int CeedQFunctionContextGetFieldLabel(CeedQFunctionContext ctx,
+    const char *field_name, CeedContextFieldLabel *field_label);
+CEED_EXTERN int CeedQFunctionContextSetDouble(CeedQFunctionContext ctx,
+    CeedContextFieldLabel field_label, const double *values);
+CEED_EXTERN int CeedQFunctionContextSetInt32(CeedQFunctionContext ctx,
+    CeedContextFieldLabel field_label, const int *values);
+CEED_EXTERN int CeedContextFieldLabelGetDescription(CeedContextFieldLabel label,
+    const char **field_name, const char **field_description, size_t *num_values,
+    CeedContextFieldType *field_type);
 CEED_EXTERN int CeedQFunctionContextView(CeedQFunctionContext ctx,
     FILE *stream);
 CEED_EXTERN int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx);
 
+/**
+  @brief Callback to receive a chunk of assembled CeedOperator entries
+
+  @param ctx          User context passed to CeedOperatorLinearAssembleChunked()
+  @param num_entries  Number of entries in this chunk
+  @param rows         Row number for each entry, or NULL if indices were not
+                        requested
+  @param cols         Column number for each entry, or NULL if indices were
+                        not requested
+  @param values       Value of each entry
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ingroup CeedOperator
+**/
+typedef int (*CeedOperatorAssemblyChunkCallback)(void *ctx,
+    CeedInt num_entries, const CeedInt *rows, const CeedInt *cols,
+    const CeedScalar *values);
+
+/// Storage format for compressed passive quadrature data
+/// @ingroup CeedOperator
+typedef enum {
+  /// Full precision CeedScalar values
+  CEED_QDATA_SCALAR = 0,
+  /// Single precision values with per-element scale factors
+  CEED_QDATA_FP32 = 1,
+  /// bfloat16 values with per-element scale factors
+  CEED_QDATA_BF16 = 2,
+} CeedQDataStorage;
+
+CEED_EXTERN const char *const CeedQDataStorages[];
+
 CEED_EXTERN int CeedOperatorCreate(Ceed ceed, CeedQFunction qf,
                                    CeedQFunction dqf, CeedQFunction dqfT,
                                    CeedOperator *op);
@@ -668,9 +755,18 @@ CEED_EXTERN int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
     CeedVector assembled, CeedRequest *request);
 CEED_EXTERN int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
     CeedVector assembled, CeedRequest *request);
+CEED_EXTERN int CeedOperatorLinearAssembleAddLumpedDiagonal(CeedOperator op,
+    CeedVector assembled, CeedRequest *request);
 CEED_EXTERN int CeedOperatorLinearAssembleSymbolic(CeedOperator op,
     CeedInt *num_entries, CeedInt **rows, CeedInt **cols);
 CEED_EXTERN int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values);
+CEED_EXTERN int CeedOperatorLinearAssembleChunked(CeedOperator op,
+    CeedInt chunk_size, bool include_indices,
+    CeedOperatorAssemblyChunkCallback callback, void *ctx);
+CEED_EXTERN int CeedOperatorLinearAssembleLORSymbolic(CeedOperator op,
+    CeedInt *num_rows, CeedInt **row_ptr, CeedInt **col_ind);
+CEED_EXTERN int CeedOperatorLinearAssembleLOR(CeedOperator op,
+    const CeedInt *row_ptr, const CeedInt *col_ind, CeedVector values);
 CEED_EXTERN int CeedOperatorMultigridLevelCreate(CeedOperator op_fine,
     CeedVector p_mult_fine, CeedElemRestriction rstr_coarse, CeedBasis basis_coarse,
     CeedOperator *op_coarse, CeedOperator *op_prolong, CeedOperator *op_restrict);
@@ -684,7 +780,17 @@ CEED_EXTERN int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine,
     CeedOperator *op_prolong, CeedOperator *op_restrict);
 CEED_EXTERN int CeedOperatorCreateFDMElementInverse(CeedOperator op,
     CeedOperator *fdm_inv, CeedRequest *request);
+CEED_EXTERN int CeedOperatorCreateFDMPatchInverse(CeedOperator op,
+    CeedOperator *patch_inv, CeedRequest *request);
 CEED_EXTERN int CeedOperatorSetNumQuadraturePoints(CeedOperator op, CeedInt num_qpts);
+CEED_EXTERN int CeedOperatorCompressElementQData(CeedOperator op,
+    const char *field_name, CeedScalar tol);
+CEED_EXTERN int CeedOperatorCompressQData(CeedOperator op,
+    const char *field_name, CeedQDataStorage storage);
+CEED_EXTERN int CeedOperatorContextSetDouble(CeedOperator op,
+    const char *field_name, const double *values);
+CEED_EXTERN int CeedOperatorContextSetInt32(CeedOperator op,
+    const char *field_name, const int *values);
 CEED_EXTERN int CeedOperatorView(CeedOperator op, FILE *stream);
 CEED_EXTERN int CeedOperatorGetCeed(CeedOperator op, Ceed *ceed);
 CEED_EXTERN int CeedOperatorGetNumElements(CeedOperator op, CeedInt *num_elem);
@@ -694,6 +800,17 @@ CEED_EXTERN int CeedOperatorApply(CeedOperator op, CeedVector in,
                                   CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorApplyAdd(CeedOperator op, CeedVector in,
                                      CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyMulti(CeedOperator op, CeedInt num_vecs,
+                                       CeedVector *in, CeedVector *out,
+                                       CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyAddMulti(CeedOperator op, CeedInt num_vecs,
+    CeedVector *in, CeedVector *out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyAddElements(CeedOperator op,
+    CeedInt num_elem_list, const CeedInt *elem_list, CeedVector in,
+    CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorUpdateElements(CeedOperator op,
+    CeedInt num_elem_list, const CeedInt *elem_list, CeedVector in_prev,
+    CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorDestroy(CeedOperator *op);
 
 CEED_EXTERN int CeedOperatorFieldGetName(CeedOperatorField op_field,
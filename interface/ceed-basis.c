@@ -179,6 +179,43 @@ static int CeedScalarView(const char *name, const char *fp_fmt, CeedInt m,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Check if interpolation and gradient matrices reproduce constants,
+           i.e. rows of the interpolation matrix sum to one and rows of the
+           gradient matrix sum to zero
+
+  @param[in] Q        Number of rows in each matrix
+  @param[in] P        Number of columns in each matrix
+  @param[in] interp   Row-major interpolation matrix of size Q * P
+  @param[in] num_grad Number of gradient matrices
+  @param[in] grad     Row-major gradient matrices of size num_grad * Q * P
+  @param[out] is_pou  Variable to store partition of unity status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisCheckPartitionOfUnity(CeedInt Q, CeedInt P,
+    const CeedScalar *interp, CeedInt num_grad, const CeedScalar *grad,
+    bool *is_pou) {
+  *is_pou = true;
+  for (CeedInt i=0; i<Q; i++) {
+    CeedScalar sum = 0.0;
+    for (CeedInt j=0; j<P; j++)
+      sum += interp[i*P+j];
+    *is_pou = *is_pou && fabs(sum - 1.0) < 100*CEED_EPSILON;
+  }
+  for (CeedInt i=0; i<num_grad*Q; i++) {
+    CeedScalar sum = 0.0, scale = 0.0;
+    for (CeedInt j=0; j<P; j++) {
+      sum += grad[i*P+j];
+      scale += fabs(grad[i*P+j]);
+    }
+    *is_pou = *is_pou && fabs(sum) <= 100*CEED_EPSILON*(1.0 + scale);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -239,6 +276,79 @@ int CeedBasisGetCollocatedGrad(CeedBasis basis, CeedScalar *collo_grad_1d) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Return the 1D basis functions expressed in Chebyshev polynomials
+
+  The nodal basis functions are fit to their values at the quadrature points,
+    which is exact when Q_1d >= P_1d since each basis function is a polynomial
+    of degree P_1d - 1. A basis function can then be evaluated at any point
+    x in the reference element as
+    phi_j(x) = sum_k T_k(x) chebyshev_interp_1d[k*P_1d + j].
+
+  @param basis                     CeedBasis
+  @param[out] chebyshev_interp_1d  Row-major (P_1d * P_1d) matrix of Chebyshev
+                                     coefficients of the 1D basis functions
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetChebyshevInterp1D(CeedBasis basis,
+                                  CeedScalar *chebyshev_interp_1d) {
+  int ierr;
+  Ceed ceed;
+  CeedInt P_1d = basis->P_1d, Q_1d = basis->Q_1d;
+  CeedScalar *vandermonde_1d, *rhs_1d, *tau;
+
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  if (Q_1d < P_1d)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Chebyshev fit requires Q_1d >= P_1d");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedMalloc(Q_1d*P_1d, &vandermonde_1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q_1d*P_1d, &rhs_1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q_1d, &tau); CeedChk(ierr);
+  memcpy(rhs_1d, basis->interp_1d, Q_1d*P_1d*sizeof(basis->interp_1d[0]));
+
+  // Chebyshev polynomials at quadrature points, V[i, k] = T_k(x_i)
+  for (CeedInt i=0; i<Q_1d; i++) {
+    const CeedScalar x = basis->q_ref_1d[i];
+    vandermonde_1d[P_1d*i] = 1.0;
+    if (P_1d > 1)
+      vandermonde_1d[1+P_1d*i] = x;
+    for (CeedInt k=2; k<P_1d; k++)
+      vandermonde_1d[k+P_1d*i] = 2*x*vandermonde_1d[k-1+P_1d*i] -
+                                 vandermonde_1d[k-2+P_1d*i];
+  }
+
+  // Least squares solve of V C = interp_1d, V = Q R
+  ierr = CeedQRFactorization(ceed, vandermonde_1d, tau, Q_1d, P_1d);
+  CeedChk(ierr);
+  // Note: This function is for backend use, so all errors are terminal
+  //   and we do not need to clean up memory on failure.
+
+  // Apply Qtranspose, rhs = Q^T interp_1d
+  ierr = CeedHouseholderApplyQ(rhs_1d, vandermonde_1d, tau, CEED_TRANSPOSE,
+                               Q_1d, P_1d, P_1d, P_1d, 1); CeedChk(ierr);
+
+  // Apply Rinv, C = Rinv rhs
+  for (CeedInt j=0; j<P_1d; j++) { // Column j
+    for (CeedInt i=P_1d-1; i>=0; i--) { // Row i
+      CeedScalar sum = rhs_1d[j+P_1d*i];
+      for (CeedInt k=i+1; k<P_1d; k++)
+        sum -= vandermonde_1d[k+P_1d*i]*chebyshev_interp_1d[j+P_1d*k];
+      chebyshev_interp_1d[j+P_1d*i] = sum / vandermonde_1d[i+P_1d*i];
+    }
+  }
+
+  ierr = CeedFree(&vandermonde_1d); CeedChk(ierr);
+  ierr = CeedFree(&rhs_1d); CeedChk(ierr);
+  ierr = CeedFree(&tau); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get tensor status for given CeedBasis
 
@@ -294,7 +404,7 @@ int CeedBasisSetData(CeedBasis basis, void *data) {
   @ref Backend
 **/
 int CeedBasisReference(CeedBasis basis) {
-  basis->ref_count++;
+  CeedAtomicAdd(basis->ref_count, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -458,6 +568,9 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt num_comp,
   ierr = CeedMalloc(Q_1d*P_1d,&(*basis)->grad_1d); CeedChk(ierr);
   memcpy((*basis)->interp_1d, interp_1d, Q_1d*P_1d*sizeof(interp_1d[0]));
   memcpy((*basis)->grad_1d, grad_1d, Q_1d*P_1d*sizeof(grad_1d[0]));
+  ierr = CeedBasisCheckPartitionOfUnity(Q_1d, P_1d, interp_1d, 1, grad_1d,
+                                        &(*basis)->is_partition_of_unity);
+  CeedChk(ierr);
   ierr = ceed->BasisCreateTensorH1(dim, P_1d, Q_1d, interp_1d, grad_1d, q_ref_1d,
                                    q_weight_1d, *basis); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
@@ -616,6 +729,9 @@ int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo, CeedInt num_comp,
   ierr = CeedMalloc(dim*Q*P, &(*basis)->grad); CeedChk(ierr);
   memcpy((*basis)->interp, interp, Q*P*sizeof(interp[0]));
   memcpy((*basis)->grad, grad, dim*Q*P*sizeof(grad[0]));
+  ierr = CeedBasisCheckPartitionOfUnity(Q, P, interp, dim, grad,
+                                        &(*basis)->is_partition_of_unity);
+  CeedChk(ierr);
   ierr = ceed->BasisCreateH1(topo, dim, P, Q, interp, grad, q_ref,
                              q_weight, *basis); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
@@ -776,10 +892,108 @@ int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode,
                      "Input/output vectors too short for basis and evaluation mode");
   // LCOV_EXCL_STOP
 
+  // Interpolation of a uniform vector reproduces the constant
+  bool is_uniform = false;
+  CeedScalar value = 0.0;
+  if (u && u != CEED_VECTOR_NONE) {
+    ierr = CeedVectorIsUniform(u, &is_uniform, &value); CeedChk(ierr);
+  }
+  if (is_uniform && basis->is_partition_of_unity &&
+      t_mode == CEED_NOTRANSPOSE) {
+    if (eval_mode == CEED_EVAL_INTERP &&
+        v_length == num_elem*num_comp*num_qpts) {
+      ierr = CeedVectorSetValue(v, value); CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+    if (eval_mode == CEED_EVAL_GRAD &&
+        v_length == num_elem*num_comp*num_qpts*dim) {
+      ierr = CeedVectorSetValue(v, 0.0); CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
   ierr = basis->Apply(basis, num_elem, t_mode, eval_mode, u, v); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply basis evaluation at arbitrary reference points
+
+  Each element has its own batch of num_points points in the reference
+    element [-1, 1]^dim. Vector layouts match @ref CeedBasisApply, with the
+    points taking the place of the quadrature points. Tensor product bases
+    are evaluated by sum factorization, with one set of 1D basis evaluations
+    per point coordinate.
+
+  @param basis      CeedBasis to evaluate
+  @param num_elem   The number of elements to apply the basis evaluation to;
+                      the backend will specify the ordering in
+                      CeedElemRestrictionCreateBlocked()
+  @param num_points The number of points per element
+  @param t_mode     \ref CEED_NOTRANSPOSE to evaluate from nodes to points;
+                      \ref CEED_TRANSPOSE to deposit from points to nodes
+  @param eval_mode  \ref CEED_EVAL_INTERP to use interpolated values,
+                      \ref CEED_EVAL_GRAD to use gradients
+  @param[in] x_ref  CeedVector of reference coordinates with shape
+                      [dim, num_points, num_elem]
+  @param[in] u      Input CeedVector
+  @param[out] v     Output CeedVector
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisApplyAtPoints(CeedBasis basis, CeedInt num_elem,
+                           CeedInt num_points, CeedTransposeMode t_mode,
+                           CeedEvalMode eval_mode, CeedVector x_ref,
+                           CeedVector u, CeedVector v) {
+  int ierr;
+  CeedInt x_length, u_length, v_length, dim, num_comp, num_nodes, num_eval;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &num_nodes); CeedChk(ierr);
+  ierr = CeedVectorGetLength(x_ref, &x_length); CeedChk(ierr);
+  ierr = CeedVectorGetLength(u, &u_length); CeedChk(ierr);
+  ierr = CeedVectorGetLength(v, &v_length); CeedChk(ierr);
+
+  if (!basis->ApplyAtPoints)
+    // LCOV_EXCL_START
+    return CeedError(basis->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Backend does not support BasisApplyAtPoints");
+  // LCOV_EXCL_STOP
+
+  switch (eval_mode) {
+  case CEED_EVAL_INTERP: num_eval = 1;
+    break;
+  case CEED_EVAL_GRAD: num_eval = dim;
+    break;
+  // LCOV_EXCL_START
+  default:
+    return CeedError(basis->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Evaluation at points only supports CEED_EVAL_INTERP "
+                     "and CEED_EVAL_GRAD");
+    // LCOV_EXCL_STOP
+  }
+
+  // Check vector lengths to prevent out of bounds issues
+  const CeedInt node_length = num_elem*num_comp*num_nodes,
+                point_length = num_elem*num_comp*num_points*num_eval;
+  if (x_length < num_elem*num_points*dim ||
+      (t_mode == CEED_TRANSPOSE && (u_length < point_length ||
+                                    v_length < node_length)) ||
+      (t_mode == CEED_NOTRANSPOSE && (u_length < node_length ||
+                                      v_length < point_length)))
+    // LCOV_EXCL_START
+    return CeedError(basis->ceed, CEED_ERROR_DIMENSION,
+                     "Input/output vectors too short for basis, number of "
+                     "points, and evaluation mode");
+  // LCOV_EXCL_STOP
+
+  ierr = basis->ApplyAtPoints(basis, num_elem, num_points, t_mode, eval_mode,
+                              x_ref, u, v); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get Ceed associated with a CeedBasis
 
@@ -1071,7 +1285,8 @@ int CeedBasisGetGrad1D(CeedBasis basis, const CeedScalar **grad_1d) {
 int CeedBasisDestroy(CeedBasis *basis) {
   int ierr;
 
-  if (!*basis || --(*basis)->ref_count > 0) return CEED_ERROR_SUCCESS;
+  if (!*basis || CeedAtomicAdd((*basis)->ref_count, -1) > 0)
+    return CEED_ERROR_SUCCESS;
   if ((*basis)->Destroy) {
     ierr = (*basis)->Destroy(*basis); CeedChk(ierr);
   }
@@ -59,6 +59,244 @@ int CeedPermutePadOffsets(const CeedInt *offsets, CeedInt *blk_offsets,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute offsets for a structured restriction
+
+  Nodes are numbered lexicographically, first direction fastest, and the
+    elements are ordered in the same way.
+
+  @param dim          Dimension of the structured mesh
+  @param num_elem_1d  Number of elements in each direction
+  @param P_1d         Number of nodes per element in each direction
+  @param is_periodic  Periodicity in each direction
+  @param[out] offsets Array of shape [@a num_elem, @a P_1d^dim] of offsets
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+static int CeedStructuredOffsets(CeedInt dim, const CeedInt *num_elem_1d,
+                                 CeedInt P_1d, const bool *is_periodic,
+                                 CeedInt *offsets) {
+  CeedInt num_elem = 1, elem_size = 1, num_nodes_1d[3];
+  for (CeedInt d=0; d<dim; d++) {
+    num_elem *= num_elem_1d[d];
+    elem_size *= P_1d;
+    num_nodes_1d[d] = num_elem_1d[d]*(P_1d-1) + !is_periodic[d];
+  }
+
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt n=0; n<elem_size; n++) {
+      CeedInt offset = 0, stride = 1, e_rem = e, n_rem = n;
+      for (CeedInt d=0; d<dim; d++) {
+        offset += ((e_rem % num_elem_1d[d])*(P_1d-1) + n_rem % P_1d) %
+                  num_nodes_1d[d] * stride;
+        stride *= num_nodes_1d[d];
+        e_rem /= num_elem_1d[d];
+        n_rem /= P_1d;
+      }
+      offsets[e*elem_size + n] = offset;
+    }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check and set the structure of a structured restriction
+
+  @param rstr         CeedElemRestriction to set structure of
+  @param dim          Dimension of the structured mesh
+  @param num_elem_1d  Number of elements in each direction
+  @param P_1d         Number of nodes per element in each direction
+  @param is_periodic  Periodicity in each direction, or NULL for no periodicity
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionSetStructure(CeedElemRestriction rstr,
+    CeedInt dim, const CeedInt *num_elem_1d, CeedInt P_1d,
+    const bool *is_periodic) {
+  if (dim < 1 || dim > 3)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                     "Structured restrictions support dimensions 1 to 3");
+  // LCOV_EXCL_STOP
+  if (P_1d < 2)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                     "Structured restrictions require at least 2 nodes per "
+                     "element in each direction");
+  // LCOV_EXCL_STOP
+
+  rstr->struct_dim = dim;
+  rstr->struct_P_1d = P_1d;
+  rstr->num_elem = 1;
+  rstr->elem_size = 1;
+  CeedInt num_nodes = 1;
+  for (CeedInt d=0; d<dim; d++) {
+    if (num_elem_1d[d] < 1)
+      // LCOV_EXCL_START
+      return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                       "Structured restriction requires at least one element "
+                       "in each direction");
+    // LCOV_EXCL_STOP
+    rstr->struct_num_elem[d] = num_elem_1d[d];
+    rstr->struct_is_periodic[d] = is_periodic ? is_periodic[d] : false;
+    rstr->num_elem *= num_elem_1d[d];
+    rstr->elem_size *= P_1d;
+    num_nodes *= num_elem_1d[d]*(P_1d-1) + !rstr->struct_is_periodic[d];
+  }
+  if (rstr->l_size < num_nodes + (rstr->num_comp - 1)*rstr->comp_stride)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                     "L-vector size %d too small for structured restriction "
+                     "with %d nodes and %d components", rstr->l_size,
+                     num_nodes, rstr->num_comp);
+  // LCOV_EXCL_STOP
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute a greedy distance-1 coloring of the blocks of a
+           CeedElemRestriction
+
+  Two blocks conflict if they share an L-vector entry. Blocks are visited in
+    order and each block takes the smallest color not used by a conflicting
+    block visited earlier.
+
+  @param rstr           CeedElemRestriction to color
+  @param[out] coloring  Variable to store the coloring
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionComputeColoring(CeedElemRestriction rstr,
+    CeedElemRestrictionColoring *coloring) {
+  int ierr;
+  const CeedInt num_blk = rstr->num_blk, blk_size = rstr->blk_size,
+                num_comp = rstr->num_comp, elem_size = rstr->elem_size,
+                num_elem = rstr->num_elem, l_size = rstr->l_size,
+                blk_len = blk_size*elem_size*num_comp;
+
+  // L-vector entries of each block
+  CeedInt *blk_nodes;
+  bool is_strided;
+  ierr = CeedMalloc(num_blk*blk_len, &blk_nodes); CeedChk(ierr);
+  ierr = CeedElemRestrictionIsStrided(rstr, &is_strided); CeedChk(ierr);
+  if (is_strided) {
+    bool has_backend_strides;
+    CeedInt strides[3];
+    ierr = CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides);
+    CeedChk(ierr);
+    if (has_backend_strides) {
+      ierr = CeedElemRestrictionGetELayout(rstr, &strides); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionGetStrides(rstr, &strides); CeedChk(ierr);
+    }
+    for (CeedInt b=0; b<num_blk; b++)
+      for (CeedInt i=0; i<elem_size; i++)
+        for (CeedInt j=0; j<num_comp; j++)
+          for (CeedInt e=0; e<blk_size; e++) {
+            const CeedInt elem = CeedIntMin(b*blk_size + e, num_elem - 1);
+            blk_nodes[b*blk_len + (i*num_comp + j)*blk_size + e] =
+              i*strides[0] + j*strides[1] + elem*strides[2];
+          }
+  } else {
+    // Offsets are stored padded and interlaced by block
+    const CeedInt *offsets;
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    for (CeedInt b=0; b<num_blk; b++)
+      for (CeedInt i=0; i<elem_size; i++)
+        for (CeedInt j=0; j<num_comp; j++)
+          for (CeedInt e=0; e<blk_size; e++)
+            blk_nodes[b*blk_len + (i*num_comp + j)*blk_size + e] =
+              offsets[(b*elem_size + i)*blk_size + e] + j*rstr->comp_stride;
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  }
+
+  // Blocks touching each L-vector entry
+  CeedInt *node_ptr, *node_blks;
+  ierr = CeedCalloc(l_size + 1, &node_ptr); CeedChk(ierr);
+  ierr = CeedMalloc(num_blk*blk_len, &node_blks); CeedChk(ierr);
+  for (CeedInt k=0; k<num_blk*blk_len; k++)
+    node_ptr[blk_nodes[k] + 1]++;
+  for (CeedInt i=0; i<l_size; i++)
+    node_ptr[i+1] += node_ptr[i];
+  for (CeedInt k=0; k<num_blk*blk_len; k++)
+    node_blks[node_ptr[blk_nodes[k]]++] = k / blk_len;
+  for (CeedInt i=l_size; i>0; i--)
+    node_ptr[i] = node_ptr[i-1];
+  node_ptr[0] = 0;
+
+  // Greedy coloring
+  CeedInt *blk_color, *forbidden, num_colors = 0;
+  ierr = CeedMalloc(num_blk, &blk_color); CeedChk(ierr);
+  ierr = CeedMalloc(num_blk, &forbidden); CeedChk(ierr);
+  for (CeedInt b=0; b<num_blk; b++) {
+    blk_color[b] = -1;
+    forbidden[b] = -1;
+  }
+  for (CeedInt b=0; b<num_blk; b++) {
+    for (CeedInt k=b*blk_len; k<(b+1)*blk_len; k++) {
+      const CeedInt node = blk_nodes[k];
+      for (CeedInt n=node_ptr[node]; n<node_ptr[node+1]; n++)
+        if (blk_color[node_blks[n]] >= 0)
+          forbidden[blk_color[node_blks[n]]] = b;
+    }
+    CeedInt color = 0;
+    while (forbidden[color] == b) color++;
+    blk_color[b] = color;
+    num_colors = CeedIntMax(num_colors, color + 1);
+  }
+  ierr = CeedFree(&blk_nodes); CeedChk(ierr);
+  ierr = CeedFree(&node_ptr); CeedChk(ierr);
+  ierr = CeedFree(&node_blks); CeedChk(ierr);
+  ierr = CeedFree(&forbidden); CeedChk(ierr);
+
+  // Group blocks by color
+  CeedInt *color_offsets, *color_blks;
+  ierr = CeedCalloc(1, coloring); CeedChk(ierr);
+  ierr = CeedCalloc(num_colors + 1, &color_offsets); CeedChk(ierr);
+  ierr = CeedMalloc(num_blk, &color_blks); CeedChk(ierr);
+  for (CeedInt b=0; b<num_blk; b++)
+    color_offsets[blk_color[b] + 1]++;
+  for (CeedInt c=0; c<num_colors; c++)
+    color_offsets[c+1] += color_offsets[c];
+  for (CeedInt b=0; b<num_blk; b++)
+    color_blks[color_offsets[blk_color[b]]++] = b;
+  for (CeedInt c=num_colors; c>0; c--)
+    color_offsets[c] = color_offsets[c-1];
+  color_offsets[0] = 0;
+  (*coloring)->num_colors = num_colors;
+  (*coloring)->color_offsets = color_offsets;
+  (*coloring)->color_blks = color_blks;
+  ierr = CeedFree(&blk_color); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy a coloring of the blocks of a CeedElemRestriction
+
+  @param coloring  Coloring to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionColoringDestroy(CeedElemRestrictionColoring
+    *coloring) {
+  int ierr;
+
+  if (!*coloring) return CEED_ERROR_SUCCESS;
+  ierr = CeedFree(&(*coloring)->color_offsets); CeedChk(ierr);
+  ierr = CeedFree(&(*coloring)->color_blks); CeedChk(ierr);
+  ierr = CeedFree(coloring); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -98,7 +336,10 @@ int CeedElemRestrictionGetStrides(CeedElemRestriction rstr,
   @param mem_type      Memory type on which to access the array.  If the backend
                          uses a different memory type, this will perform a copy
                          (possibly cached).
-  @param[out] offsets  Array on memory type mem_type
+  @param[out] offsets  Array on memory type mem_type; for restrictions that do
+                         not store offsets, such as structured or compressed
+                         restrictions, this may be a temporary array that is
+                         valid until CeedElemRestrictionRestoreOffsets()
 
   @return An error code: 0 - success, otherwise - failure
 
@@ -116,7 +357,7 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr,
   // LCOV_EXCL_STOP
 
   ierr = rstr->GetOffsets(rstr, mem_type, offsets); CeedChk(ierr);
-  rstr->num_readers++;
+  CeedAtomicAdd(rstr->num_readers, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -132,8 +373,13 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr,
 **/
 int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr,
                                       const CeedInt **offsets) {
+  int ierr;
+
+  if (rstr->RestoreOffsets) {
+    ierr = rstr->RestoreOffsets(rstr, offsets); CeedChk(ierr);
+  }
   *offsets = NULL;
-  rstr->num_readers--;
+  CeedAtomicAdd(rstr->num_readers, -1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -176,6 +422,119 @@ int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the compressed offset storage status of a CeedElemRestriction
+
+  @param rstr                CeedElemRestriction
+  @param[out] is_compressed  Variable to store compressed status, true if
+                               compressed offset storage was requested
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionIsCompressed(CeedElemRestriction rstr,
+                                    bool *is_compressed) {
+  *is_compressed = rstr->is_compressed;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the CeedElemRestriction sharing its offset data with a blocked
+           CeedElemRestriction
+
+  @param rstr            CeedElemRestriction
+  @param[out] rstr_base  Variable to store base CeedElemRestriction, or NULL
+                           if the offset data is not shared
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetSharedBase(CeedElemRestriction rstr,
+                                     CeedElemRestriction *rstr_base) {
+  *rstr_base = rstr->rstr_base;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the compressed offsets of a CeedElemRestriction, stored as a base
+           offset for each element and a 16-bit delta for each element node
+
+  The arrays remain valid for the lifetime of the CeedElemRestriction.
+
+  @param rstr        CeedElemRestriction
+  @param[out] base   Variable to store the base offset of each element, or NULL
+                       if the backend does not store compressed offsets
+  @param[out] delta  Variable to store the delta of each element node, or NULL
+                       if the backend does not store compressed offsets
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetCompressedOffsets(CeedElemRestriction rstr,
+    const CeedInt **base, const uint16_t **delta) {
+  int ierr;
+
+  *base = NULL;
+  *delta = NULL;
+  if (rstr->GetCompressedOffsets) {
+    ierr = rstr->GetCompressedOffsets(rstr, base, delta); CeedChk(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the structured status of a CeedElemRestriction
+
+  @param rstr                CeedElemRestriction
+  @param[out] is_structured  Variable to store structured status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionIsStructured(CeedElemRestriction rstr,
+                                    bool *is_structured) {
+  *is_structured = rstr->struct_dim > 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the structure of a structured CeedElemRestriction
+
+  @param rstr              CeedElemRestriction
+  @param[out] dim          Variable to store dimension of structured mesh
+  @param[out] num_elem_1d  Variable to store number of elements in each
+                             direction
+  @param[out] P_1d         Variable to store number of nodes per element in
+                             each direction
+  @param[out] is_periodic  Variable to store periodicity in each direction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetStructure(CeedElemRestriction rstr, CeedInt *dim,
+                                    CeedInt (*num_elem_1d)[3], CeedInt *P_1d,
+                                    bool (*is_periodic)[3]) {
+  if (!rstr->struct_dim)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_MINOR,
+                     "ElemRestriction has no structure data");
+  // LCOV_EXCL_STOP
+
+  *dim = rstr->struct_dim;
+  *P_1d = rstr->struct_P_1d;
+  for (int i=0; i<3; i++) {
+    (*num_elem_1d)[i] = i < rstr->struct_dim ? rstr->struct_num_elem[i] : 1;
+    (*is_periodic)[i] = i < rstr->struct_dim ? rstr->struct_is_periodic[i] :
+                        false;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
 
   @brief Get the E-vector layout of a CeedElemRestriction
@@ -266,7 +625,96 @@ int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data) {
   @ref Backend
 **/
 int CeedElemRestrictionReference(CeedElemRestriction rstr) {
-  rstr->ref_count++;
+  CeedAtomicAdd(rstr->ref_count, 1);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get a coloring of the blocks of a CeedElemRestriction for
+           concurrent transpose application
+
+  No two blocks of the same color share an L-vector entry, so the transpose
+    restriction of all blocks of one color may be applied concurrently
+    without atomics or reductions. For restrictions created without blocking,
+    each block is a single element. The coloring is computed on first use and
+    stored with the CeedElemRestriction. Concurrent first calls may each
+    compute a coloring, but all callers receive the one that is stored.
+
+  @param rstr                CeedElemRestriction
+  @param[out] num_colors     Variable to store number of colors
+  @param[out] color_offsets  Variable to store array of size num_colors + 1;
+                               blocks of color c are
+                               color_blks[color_offsets[c]:color_offsets[c+1]]
+  @param[out] color_blks     Variable to store array of size num_blk holding
+                               the blocks ordered by color
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetColoring(CeedElemRestriction rstr,
+                                   CeedInt *num_colors,
+                                   const CeedInt **color_offsets,
+                                   const CeedInt **color_blks) {
+  int ierr;
+  CeedElemRestrictionColoring coloring = CeedAtomicLoad(rstr->coloring);
+
+  if (!coloring) {
+    CeedElemRestrictionColoring computed;
+    ierr = CeedElemRestrictionComputeColoring(rstr, &computed); CeedChk(ierr);
+    // Keep the coloring stored by a concurrent call, if any
+    if (CeedAtomicCompareExchange(rstr->coloring, coloring, computed)) {
+      coloring = computed;
+    } else {
+      ierr = CeedElemRestrictionColoringDestroy(&computed); CeedChk(ierr);
+    }
+  }
+  *num_colors = coloring->num_colors;
+  *color_offsets = coloring->color_offsets;
+  *color_blks = coloring->color_blks;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the transpose of a CeedElemRestriction, overwriting the output
+           L-vector instead of summing into it
+
+  Entries of @a ru not touched by any element are set to zero. Backends that
+    provide a gather-based transpose write each L-vector entry once; otherwise
+    @a ru is zeroed before the standard transpose restriction.
+
+  @param rstr     CeedElemRestriction
+  @param u        Input E-vector
+  @param ru       Output L-vector (of size @a l_size)
+  @param request  Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionApplyTransposeOverwrite(CeedElemRestriction rstr,
+    CeedVector u, CeedVector ru, CeedRequest *request) {
+  int ierr;
+
+  if (rstr->ApplyTransposeOverwrite) {
+    if (u->length != rstr->num_blk*rstr->blk_size*rstr->elem_size*rstr->num_comp)
+      // LCOV_EXCL_START
+      return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                       "Input vector size %d not compatible with "
+                       "element restriction", u->length);
+    // LCOV_EXCL_STOP
+    if (ru->length != rstr->l_size)
+      // LCOV_EXCL_START
+      return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                       "Output vector size %d not compatible with "
+                       "element restriction", ru->length);
+    // LCOV_EXCL_STOP
+    ierr = rstr->ApplyTransposeOverwrite(rstr, u, ru, request); CeedChk(ierr);
+  } else {
+    ierr = CeedVectorSetValue(ru, 0.0); CeedChk(ierr);
+    ierr = CeedElemRestrictionApply(rstr, CEED_TRANSPOSE, u, ru, request);
+    CeedChk(ierr);
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -357,6 +805,83 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem, CeedInt elem_size,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a CeedElemRestriction with compressed offset storage
+
+  This is identical to CeedElemRestrictionCreate(), but requests that the
+    backend store the offsets in a compressed form, such as a base offset per
+    element with 16-bit deltas, and decode them while applying the restriction.
+    Backends without compressed storage, or offsets that cannot be compressed,
+    use the standard representation.
+
+  @param ceed         A Ceed object where the CeedElemRestriction will be created
+  @param num_elem     Number of elements described in the @a offsets array
+  @param elem_size    Size (number of "nodes") per element
+  @param num_comp     Number of field components per interpolation node
+                        (1 for scalar fields)
+  @param comp_stride  Stride between components for the same L-vector "node".
+                        Data for node i, component j, element k can be found in
+                        the L-vector at index
+                        offsets[i + k*elem_size] + j*comp_stride.
+  @param l_size       The size of the L-vector. This vector may be larger than
+                        the elements and fields given by this restriction.
+  @param mem_type     Memory type of the @a offsets array, see CeedMemType
+  @param copy_mode    Copy mode for the @a offsets array, see CeedCopyMode
+  @param offsets      Array of shape [@a num_elem, @a elem_size]. Row i holds the
+                        ordered list of the offsets (into the input CeedVector)
+                        for the unknowns corresponding to element i, where
+                        0 <= i < @a num_elem. All offsets must be in the range
+                        [0, @a l_size - 1].
+  @param[out] rstr    Address of the variable where the newly created
+                        CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateCompressed(Ceed ceed, CeedInt num_elem,
+                                        CeedInt elem_size, CeedInt num_comp,
+                                        CeedInt comp_stride, CeedInt l_size,
+                                        CeedMemType mem_type,
+                                        CeedCopyMode copy_mode,
+                                        const CeedInt *offsets,
+                                        CeedElemRestriction *rstr) {
+  int ierr;
+
+  if (!ceed->ElemRestrictionCreate) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                       "Backend does not support ElemRestrictionCreate");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedElemRestrictionCreateCompressed(delegate, num_elem, elem_size,
+           num_comp, comp_stride, l_size, mem_type, copy_mode, offsets, rstr);
+    CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+  (*rstr)->ceed = ceed;
+  ierr = CeedReference(ceed); CeedChk(ierr);
+  (*rstr)->ref_count = 1;
+  (*rstr)->num_elem = num_elem;
+  (*rstr)->elem_size = elem_size;
+  (*rstr)->num_comp = num_comp;
+  (*rstr)->comp_stride = comp_stride;
+  (*rstr)->l_size = l_size;
+  (*rstr)->num_blk = num_elem;
+  (*rstr)->blk_size = 1;
+  (*rstr)->is_compressed = true;
+  ierr = ceed->ElemRestrictionCreate(mem_type, copy_mode, offsets, *rstr);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a strided CeedElemRestriction
 
@@ -423,6 +948,99 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a structured CeedElemRestriction
+
+  A structured restriction describes a Cartesian mesh of tensor product
+    elements with @a P_1d nodes in each direction. L-vector nodes are numbered
+    lexicographically, with the first direction fastest, and elements are
+    ordered in the same way. Backends may compute the offsets arithmetically
+    rather than storing an offsets array.
+
+  @param ceed         A Ceed object where the CeedElemRestriction will be created
+  @param dim          Dimension of the structured mesh, 1 to 3
+  @param num_elem_1d  Array of length @a dim with the number of elements in
+                        each direction
+  @param P_1d         Number of nodes per element in each direction
+  @param is_periodic  Array of length @a dim with the periodicity in each
+                        direction, or NULL if no direction is periodic. In a
+                        periodic direction the last node of the last element is
+                        identified with the first node of the first element.
+  @param num_comp     Number of field components per interpolation node
+                        (1 for scalar fields)
+  @param comp_stride  Stride between components for the same L-vector "node".
+                        Mesh nodes are numbered lexicographically with the
+                        first direction fastest, so the node with index n_d in
+                        direction d has number
+                        n = n_0 + N_0*(n_1 + N_1*n_2), where N_d is the
+                        number of nodes in direction d. Data for node n,
+                        component j can be found in the L-vector at index
+                        n + j*comp_stride.
+  @param l_size       The size of the L-vector. This vector may be larger than
+                        the elements and fields given by this restriction.
+  @param[out] rstr    Address of the variable where the newly created
+                        CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateStructured(Ceed ceed, CeedInt dim,
+                                        const CeedInt *num_elem_1d,
+                                        CeedInt P_1d, const bool *is_periodic,
+                                        CeedInt num_comp, CeedInt comp_stride,
+                                        CeedInt l_size,
+                                        CeedElemRestriction *rstr) {
+  int ierr;
+  CeedInt *offsets;
+
+  if (!ceed->ElemRestrictionCreate) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                       "Backend does not support ElemRestrictionCreate");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedElemRestrictionCreateStructured(delegate, dim, num_elem_1d, P_1d,
+           is_periodic, num_comp, comp_stride, l_size, rstr); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+  (*rstr)->ceed = ceed;
+  ierr = CeedReference(ceed); CeedChk(ierr);
+  (*rstr)->ref_count = 1;
+  (*rstr)->num_comp = num_comp;
+  (*rstr)->comp_stride = comp_stride;
+  (*rstr)->l_size = l_size;
+  ierr = CeedElemRestrictionSetStructure(*rstr, dim, num_elem_1d, P_1d,
+                                         is_periodic); CeedChk(ierr);
+  (*rstr)->num_blk = (*rstr)->num_elem;
+  (*rstr)->blk_size = 1;
+
+  // Backends with structured support receive only the structure
+  if (ceed->ElemRestrictionCreateStructured) {
+    ierr = ceed->ElemRestrictionCreateStructured(CEED_MEM_HOST, CEED_USE_POINTER,
+           NULL, *rstr); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Other backends use the offsets
+  ierr = CeedMalloc((*rstr)->num_elem*(*rstr)->elem_size, &offsets);
+  CeedChk(ierr);
+  ierr = CeedStructuredOffsets(dim, (*rstr)->struct_num_elem, P_1d,
+                               (*rstr)->struct_is_periodic, offsets);
+  CeedChk(ierr);
+  ierr = ceed->ElemRestrictionCreate(CEED_MEM_HOST, CEED_OWN_POINTER,
+                                     (const CeedInt *) offsets, *rstr);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a blocked CeedElemRestriction, typically only called by backends
 
@@ -573,6 +1191,150 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a blocked CeedElemRestriction that shares the offset data of an
+           existing CeedElemRestriction, typically only called by backends
+
+  The blocked restriction holds a reference to @a rstr and reads its offsets,
+    in whatever form the backend stores them, instead of storing a permuted
+    and padded copy. The backend for @a rstr must support shared offsets.
+
+  @param rstr           Unblocked CeedElemRestriction with offsets to share
+  @param blk_size       Number of elements in a block
+  @param[out] blk_rstr  Address of the variable where the newly created
+                          CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateBlockedShared(CeedElemRestriction rstr,
+    CeedInt blk_size, CeedElemRestriction *blk_rstr) {
+  int ierr;
+  Ceed ceed = rstr->ceed;
+
+  if (rstr->blk_size != 1 || rstr->strides)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_INCOMPATIBLE,
+                     "Can only share offsets of an unblocked restriction "
+                     "with offsets");
+  // LCOV_EXCL_STOP
+  if (!ceed->ElemRestrictionCreateBlocked) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate || !delegate->ElemRestrictionCreateBlocked)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support "
+                       "ElemRestrictionCreateBlocked");
+    // LCOV_EXCL_STOP
+    ceed = delegate;
+  }
+
+  ierr = CeedCalloc(1, blk_rstr); CeedChk(ierr);
+  (*blk_rstr)->ceed = ceed;
+  ierr = CeedReference(ceed); CeedChk(ierr);
+  (*blk_rstr)->ref_count = 1;
+  (*blk_rstr)->num_elem = rstr->num_elem;
+  (*blk_rstr)->elem_size = rstr->elem_size;
+  (*blk_rstr)->num_comp = rstr->num_comp;
+  (*blk_rstr)->comp_stride = rstr->comp_stride;
+  (*blk_rstr)->l_size = rstr->l_size;
+  (*blk_rstr)->num_blk = (rstr->num_elem / blk_size) +
+                         !!(rstr->num_elem % blk_size);
+  (*blk_rstr)->blk_size = blk_size;
+  (*blk_rstr)->is_compressed = rstr->is_compressed;
+  ierr = CeedElemRestrictionReferenceCopy(rstr, &(*blk_rstr)->rstr_base);
+  CeedChk(ierr);
+  ierr = ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_USE_POINTER,
+         NULL, *blk_rstr); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create a blocked structured CeedElemRestriction, typically only called
+           by backends
+
+  @param ceed         A Ceed object where the CeedElemRestriction will be created
+  @param dim          Dimension of the structured mesh, 1 to 3
+  @param num_elem_1d  Array of length @a dim with the number of elements in
+                        each direction
+  @param P_1d         Number of nodes per element in each direction
+  @param is_periodic  Array of length @a dim with the periodicity in each
+                        direction, or NULL if no direction is periodic
+  @param blk_size     Number of elements in a block
+  @param num_comp     Number of field components per interpolation node
+                        (1 for scalar fields)
+  @param comp_stride  Stride between components for the same L-vector "node"
+  @param l_size       The size of the L-vector. This vector may be larger than
+                        the elements and fields given by this restriction.
+  @param[out] rstr    Address of the variable where the newly created
+                        CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateBlockedStructured(Ceed ceed, CeedInt dim,
+    const CeedInt *num_elem_1d, CeedInt P_1d, const bool *is_periodic,
+    CeedInt blk_size, CeedInt num_comp, CeedInt comp_stride, CeedInt l_size,
+    CeedElemRestriction *rstr) {
+  int ierr;
+  CeedInt *offsets, *blk_offsets;
+
+  if (!ceed->ElemRestrictionCreateBlocked) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support "
+                       "ElemRestrictionCreateBlocked");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedElemRestrictionCreateBlockedStructured(delegate, dim, num_elem_1d,
+           P_1d, is_periodic, blk_size, num_comp, comp_stride, l_size, rstr);
+    CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+  (*rstr)->ceed = ceed;
+  ierr = CeedReference(ceed); CeedChk(ierr);
+  (*rstr)->ref_count = 1;
+  (*rstr)->num_comp = num_comp;
+  (*rstr)->comp_stride = comp_stride;
+  (*rstr)->l_size = l_size;
+  ierr = CeedElemRestrictionSetStructure(*rstr, dim, num_elem_1d, P_1d,
+                                         is_periodic); CeedChk(ierr);
+  CeedInt num_elem = (*rstr)->num_elem, elem_size = (*rstr)->elem_size;
+  CeedInt num_blk = (num_elem / blk_size) + !!(num_elem % blk_size);
+  (*rstr)->num_blk = num_blk;
+  (*rstr)->blk_size = blk_size;
+
+  // Backends with structured support receive only the structure
+  if (ceed->ElemRestrictionCreateStructured) {
+    ierr = ceed->ElemRestrictionCreateStructured(CEED_MEM_HOST, CEED_USE_POINTER,
+           NULL, *rstr); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Other backends use the offsets
+  ierr = CeedMalloc(num_elem*elem_size, &offsets); CeedChk(ierr);
+  ierr = CeedStructuredOffsets(dim, (*rstr)->struct_num_elem, P_1d,
+                               (*rstr)->struct_is_periodic, offsets);
+  CeedChk(ierr);
+  ierr = CeedCalloc(num_blk*blk_size*elem_size, &blk_offsets); CeedChk(ierr);
+  ierr = CeedPermutePadOffsets(offsets, blk_offsets, num_blk, num_elem, blk_size,
+                               elem_size); CeedChk(ierr);
+  ierr = CeedFree(&offsets); CeedChk(ierr);
+  ierr = ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_OWN_POINTER,
+         (const CeedInt *) blk_offsets, *rstr); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a CeedElemRestriction. Both pointers should
            be destroyed with `CeedElemRestrictionDestroy()`;
@@ -664,6 +1426,16 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode,
                      "Output vector size %d not compatible with "
                      "element restriction (%d, %d)", ru->length, m, n);
   // LCOV_EXCL_STOP
+
+  // Restriction of a uniform L-vector is uniform
+  bool is_uniform;
+  CeedScalar value;
+  ierr = CeedVectorIsUniform(u, &is_uniform, &value); CeedChk(ierr);
+  if (t_mode == CEED_NOTRANSPOSE && is_uniform) {
+    ierr = CeedVectorSetValue(ru, value); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
   ierr = rstr->Apply(rstr, t_mode, u, ru, request); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
 }
@@ -718,6 +1490,16 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block,
                      "total elements %d", block, rstr->blk_size*block,
                      rstr->num_elem);
   // LCOV_EXCL_STOP
+
+  // Restriction of a uniform L-vector is uniform
+  bool is_uniform;
+  CeedScalar value;
+  ierr = CeedVectorIsUniform(u, &is_uniform, &value); CeedChk(ierr);
+  if (t_mode == CEED_NOTRANSPOSE && is_uniform) {
+    ierr = CeedVectorSetValue(ru, value); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
   ierr = rstr->ApplyBlock(rstr, block, t_mode, u, ru, request);
   CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
@@ -898,8 +1680,9 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
   else
     sprintf(stridesstr, "%d", rstr->comp_stride);
 
-  fprintf(stream, "%sCeedElemRestriction from (%d, %d) to %d elements with %d "
-          "nodes each and %s %s\n", rstr->blk_size > 1 ? "Blocked " : "",
+  fprintf(stream, "%s%sCeedElemRestriction from (%d, %d) to %d elements with "
+          "%d nodes each and %s %s\n", rstr->blk_size > 1 ? "Blocked " : "",
+          rstr->struct_dim ? "Structured " : "",
           rstr->l_size, rstr->num_comp, rstr->num_elem, rstr->elem_size,
           rstr->strides ? "strides" : "component stride", stridesstr);
   return CEED_ERROR_SUCCESS;
@@ -917,7 +1700,8 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
 int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
   int ierr;
 
-  if (!*rstr || --(*rstr)->ref_count > 0) return CEED_ERROR_SUCCESS;
+  if (!*rstr || CeedAtomicAdd((*rstr)->ref_count, -1) > 0)
+    return CEED_ERROR_SUCCESS;
   if ((*rstr)->num_readers)
     // LCOV_EXCL_START
     return CeedError((*rstr)->ceed, CEED_ERROR_ACCESS,
@@ -928,6 +1712,8 @@ int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
     ierr = (*rstr)->Destroy(*rstr); CeedChk(ierr);
   }
   ierr = CeedFree(&(*rstr)->strides); CeedChk(ierr);
+  ierr = CeedElemRestrictionColoringDestroy(&(*rstr)->coloring); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&(*rstr)->rstr_base); CeedChk(ierr);
   ierr = CeedDestroy(&(*rstr)->ceed); CeedChk(ierr);
   ierr = CeedFree(rstr); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
@@ -19,6 +19,7 @@
 #include <ceed-impl.h>
 #include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -162,6 +163,9 @@ static int CeedOperatorFieldView(CeedOperatorField field,
 
   if (field->vec == CEED_VECTOR_ACTIVE)
     fprintf(stream, "%s      Active vector\n", pre);
+  else if (field->qdata)
+    fprintf(stream, "%s      Compressed quadrature data, %s\n", pre,
+            CeedQDataStorages[field->qdata->storage]);
   else if (field->vec == CEED_VECTOR_NONE)
     fprintf(stream, "%s      No vector\n", pre);
   return CEED_ERROR_SUCCESS;
@@ -265,6 +269,500 @@ int CeedOperatorGetActiveElemRestriction(CeedOperator op,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Round a single precision value to bfloat16
+
+  @param[in] value  Value to round
+
+  @return Upper 16 bits of the value, rounded to nearest with ties to even
+
+  @ref Developer
+**/
+static inline uint16_t CeedFloatToBF16(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  bits += 0x7FFF + ((bits >> 16) & 1);
+  return (uint16_t)(bits >> 16);
+}
+
+/**
+  @brief Expand a bfloat16 value to single precision
+
+  @param[in] value  Upper 16 bits of a single precision value
+
+  @return Single precision value
+
+  @ref Developer
+**/
+static inline float CeedBF16ToFloat(uint16_t value) {
+  uint32_t bits = (uint32_t)value << 16;
+  float result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+/**
+  @brief Destroy compressed quadrature data once it is no longer referenced
+
+  @param[out] qdata  Compressed quadrature data to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQDataCompressedDestroy(CeedQDataCompressed *qdata) {
+  int ierr;
+
+  if (*qdata && CeedAtomicAdd((*qdata)->ref_count, -1) == 0) {
+    ierr = CeedFree(&(*qdata)->comp_map); CeedChk(ierr);
+    ierr = CeedFree(&(*qdata)->values); CeedChk(ierr);
+    ierr = CeedFree(&(*qdata)->scales); CeedChk(ierr);
+    ierr = CeedFree(&(*qdata)->elem_offsets); CeedChk(ierr);
+    ierr = CeedFree(&(*qdata)->elem_is_constant); CeedChk(ierr);
+    ierr = CeedFree(&(*qdata)->comp_is_weighted); CeedChk(ierr);
+    ierr = CeedFree(&(*qdata)->q_weights); CeedChk(ierr);
+    ierr = CeedFree(qdata); CeedChk(ierr);
+  }
+  *qdata = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Replace the passive quadrature data of a CeedOperator field with
+           compressed quadrature data
+
+  @param op               CeedOperator
+  @param field_name       Name of the passive input field with quadrature data
+  @param storage          Storage format for the values
+  @param detect_constant  Store a single set of values for elements where all
+                            quadrature points agree to within @a tol, with or
+                            without the quadrature weights of the operator
+                            basis
+  @param tol              Relative tolerance for values to be considered
+                            constant over an element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorCompressQData_Core(CeedOperator op,
+    const char *field_name, CeedQDataStorage storage, bool detect_constant,
+    CeedScalar tol) {
+  int ierr;
+  Ceed ceed = op->ceed;
+
+  if (op->is_composite)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_MINOR,
+                     "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+  if (op->is_immutable || op->is_backend_setup)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_MAJOR,
+                     "Operator cannot be changed after it has been set up");
+  // LCOV_EXCL_STOP
+  if (!ceed->has_compressed_qdata)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Backend does not support compressed quadrature data");
+  // LCOV_EXCL_STOP
+
+  // Find field
+  CeedOperatorField op_field = NULL;
+  CeedQFunctionField qf_field = NULL;
+  for (CeedInt i=0; i<op->qf->num_input_fields; i++)
+    if (op->input_fields[i] &&
+        !strcmp(field_name, op->input_fields[i]->field_name)) {
+      op_field = op->input_fields[i];
+      qf_field = op->qf->input_fields[i];
+    }
+  if (!op_field)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_INCOMPLETE,
+                     "Operator has no input field '%s'", field_name);
+  // LCOV_EXCL_STOP
+  if (op_field->vec == CEED_VECTOR_ACTIVE ||
+      op_field->vec == CEED_VECTOR_NONE ||
+      op_field->basis != CEED_BASIS_COLLOCATED ||
+      qf_field->eval_mode != CEED_EVAL_NONE)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_INCOMPATIBLE,
+                     "Field '%s' must be a passive collocated field "
+                     "with CEED_EVAL_NONE", field_name);
+  // LCOV_EXCL_STOP
+
+  // Quadrature data in E-vector layout
+  CeedElemRestriction rstr = op_field->elem_restr;
+  CeedInt num_elem, num_qpts, num_comp, layout[3];
+  CeedVector e_vec;
+  const CeedScalar *e_array;
+  ierr = CeedElemRestrictionGetNumElements(rstr, &num_elem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &num_qpts); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &num_comp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetELayout(rstr, &layout); CeedChk(ierr);
+  ierr = CeedElemRestrictionCreateVector(rstr, NULL, &e_vec); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstr, CEED_NOTRANSPOSE, op_field->vec, e_vec,
+                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(e_vec, CEED_MEM_HOST, &e_array); CeedChk(ierr);
+
+  // Stored components, packing the upper triangle of symmetric tensors
+  CeedQDataCompressed qdata;
+  CeedInt *comp_a, *comp_b;
+  ierr = CeedCalloc(1, &qdata); CeedChk(ierr);
+  ierr = CeedMalloc(num_comp, &qdata->comp_map); CeedChk(ierr);
+  qdata->ref_count = 1;
+  qdata->storage = storage;
+  qdata->num_elem = num_elem;
+  qdata->num_qpts = num_qpts;
+  qdata->num_comp = num_comp;
+  if (qf_field->is_symmetric) {
+    CeedInt n = 1;
+    while (n*n < num_comp) n++;
+    for (CeedInt i=0; i<n; i++)
+      for (CeedInt j=0; j<n; j++) {
+        const CeedInt r = CeedIntMin(i, j), c = CeedIntMax(i, j);
+        qdata->comp_map[i*n + j] = r*n - r*(r-1)/2 + c - r;
+      }
+    qdata->num_comp_stored = n*(n+1)/2;
+  } else {
+    for (CeedInt c=0; c<num_comp; c++)
+      qdata->comp_map[c] = c;
+    qdata->num_comp_stored = num_comp;
+  }
+  const CeedInt num_comp_stored = qdata->num_comp_stored;
+  // Each stored component is the mean of one or two components
+  ierr = CeedMalloc(num_comp_stored, &comp_a); CeedChk(ierr);
+  ierr = CeedMalloc(num_comp_stored, &comp_b); CeedChk(ierr);
+  for (CeedInt k=0; k<num_comp_stored; k++)
+    comp_a[k] = -1;
+  for (CeedInt c=0; c<num_comp; c++) {
+    const CeedInt k = qdata->comp_map[c];
+    if (comp_a[k] < 0) comp_a[k] = c;
+    comp_b[k] = c;
+  }
+
+  // Quadrature weights of the operator basis, as setup QFunctions often fold
+  //   them into the data
+  if (detect_constant) {
+    CeedBasis basis = NULL;
+    for (CeedInt i=0; i<op->qf->num_input_fields && !basis; i++)
+      if (op->input_fields[i] &&
+          op->input_fields[i]->basis != CEED_BASIS_COLLOCATED)
+        basis = op->input_fields[i]->basis;
+    CeedInt num_qpts_basis = 0;
+    if (basis) {
+      ierr = CeedBasisGetNumQuadraturePoints(basis, &num_qpts_basis);
+      CeedChk(ierr);
+    }
+    if (num_qpts_basis == num_qpts) {
+      CeedVector q_weights;
+      const CeedScalar *w;
+      ierr = CeedVectorCreate(ceed, num_qpts, &q_weights); CeedChk(ierr);
+      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+                            CEED_VECTOR_NONE, q_weights); CeedChk(ierr);
+      ierr = CeedVectorGetArrayRead(q_weights, CEED_MEM_HOST, &w); CeedChk(ierr);
+      ierr = CeedMalloc(num_qpts, &qdata->q_weights); CeedChk(ierr);
+      memcpy(qdata->q_weights, w, num_qpts*sizeof(w[0]));
+      ierr = CeedVectorRestoreArrayRead(q_weights, &w); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&q_weights); CeedChk(ierr);
+    }
+  }
+  const CeedScalar *q_weights = qdata->q_weights;
+
+  // Detect elements with constant data, either as stored or with the
+  //   quadrature weights divided out
+  CeedInt num_values = num_elem*num_comp_stored*num_qpts;
+  if (detect_constant) {
+    ierr = CeedMalloc(num_elem, &qdata->elem_is_constant); CeedChk(ierr);
+    ierr = CeedCalloc(num_elem*num_comp_stored, &qdata->comp_is_weighted);
+    CeedChk(ierr);
+    ierr = CeedMalloc(num_elem, &qdata->elem_offsets); CeedChk(ierr);
+    for (CeedInt e=0; e<num_elem; e++) {
+      bool is_constant = true;
+      for (CeedInt k=0; k<num_comp_stored && is_constant; k++) {
+        const CeedScalar *a = &e_array[comp_a[k]*layout[1] + e*layout[2]],
+                          *b = &e_array[comp_b[k]*layout[1] + e*layout[2]];
+        for (CeedInt weighted=0; weighted<=(q_weights != NULL); weighted++) {
+          const CeedScalar value_0 = 0.5*(a[0] + b[0]) /
+                                     (weighted ? q_weights[0] : 1.0);
+          is_constant = true;
+          for (CeedInt q=1; q<num_qpts && is_constant; q++)
+            is_constant = fabs(0.5*(a[q*layout[0]] + b[q*layout[0]]) /
+                               (weighted ? q_weights[q] : 1.0) - value_0) <=
+                          tol*fabs(value_0);
+          if (is_constant) {
+            qdata->comp_is_weighted[e*num_comp_stored + k] = weighted;
+            break;
+          }
+        }
+      }
+      qdata->elem_is_constant[e] = is_constant;
+      if (is_constant) num_values -= num_comp_stored*(num_qpts - 1);
+    }
+  }
+
+  // Encode values
+  const size_t value_size = storage == CEED_QDATA_SCALAR ? sizeof(CeedScalar) :
+                            (storage == CEED_QDATA_FP32 ? sizeof(float) :
+                             sizeof(uint16_t));
+  CeedInt offset = 0, last_constant = -1;
+  ierr = CeedMallocArray(num_values, value_size, &qdata->values); CeedChk(ierr);
+  if (storage != CEED_QDATA_SCALAR) {
+    ierr = CeedMalloc(num_elem*num_comp_stored, &qdata->scales); CeedChk(ierr);
+  }
+  for (CeedInt e=0; e<num_elem; e++) {
+    const bool is_constant = qdata->elem_is_constant &&
+                             qdata->elem_is_constant[e];
+    const CeedInt num_qpts_stored = is_constant ? 1 : num_qpts;
+    for (CeedInt k=0; k<num_comp_stored; k++) {
+      const CeedInt ek = e*num_comp_stored + k;
+      const CeedScalar *a = &e_array[comp_a[k]*layout[1] + e*layout[2]],
+                        *b = &e_array[comp_b[k]*layout[1] + e*layout[2]];
+      CeedScalar scale = 0.0;
+      for (CeedInt q=0; q<num_qpts; q++)
+        scale = fmax(scale, fabs(0.5*(a[q*layout[0]] + b[q*layout[0]])));
+      if (scale == 0.0) scale = 1.0;
+      const bool is_weighted = is_constant &&
+                               qdata->comp_is_weighted[ek];
+      for (CeedInt q=0; q<num_qpts_stored; q++) {
+        const CeedInt i = offset + k*num_qpts_stored + q;
+        const CeedScalar value = 0.5*(a[q*layout[0]] + b[q*layout[0]]) /
+                                 (is_weighted ? q_weights[q] : 1.0);
+        switch (storage) {
+        case CEED_QDATA_SCALAR:
+          ((CeedScalar *)qdata->values)[i] = value;
+          break;
+        case CEED_QDATA_FP32:
+          ((float *)qdata->values)[i] = value / scale;
+          break;
+        case CEED_QDATA_BF16:
+          ((uint16_t *)qdata->values)[i] = CeedFloatToBF16(value / scale);
+          break;
+        }
+      }
+      if (qdata->scales) qdata->scales[ek] = scale;
+    }
+    if (!qdata->elem_offsets) {
+      offset += num_comp_stored*num_qpts;
+      continue;
+    }
+    // Share the values of the previous constant element if they are identical
+    const char *values = qdata->values;
+    if (is_constant && last_constant >= 0 &&
+        !memcmp(&values[offset*value_size],
+                &values[qdata->elem_offsets[last_constant]*value_size],
+                num_comp_stored*value_size) &&
+        !memcmp(&qdata->comp_is_weighted[e*num_comp_stored],
+                &qdata->comp_is_weighted[last_constant*num_comp_stored],
+                num_comp_stored*sizeof(bool)) &&
+        (!qdata->scales ||
+         !memcmp(&qdata->scales[e*num_comp_stored],
+                 &qdata->scales[last_constant*num_comp_stored],
+                 num_comp_stored*sizeof(CeedScalar)))) {
+      qdata->elem_offsets[e] = qdata->elem_offsets[last_constant];
+    } else {
+      qdata->elem_offsets[e] = offset;
+      offset += num_comp_stored*num_qpts_stored;
+      if (is_constant) last_constant = e;
+    }
+  }
+  if (offset < num_values) {
+    ierr = CeedReallocArray(offset, value_size, &qdata->values); CeedChk(ierr);
+  }
+  ierr = CeedFree(&comp_a); CeedChk(ierr);
+  ierr = CeedFree(&comp_b); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(e_vec, &e_array); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&e_vec); CeedChk(ierr);
+
+  // Replace field data
+  ierr = CeedVectorDestroy(&op_field->vec); CeedChk(ierr);
+  op_field->vec = CEED_VECTOR_NONE;
+  op_field->qdata = qdata;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check if a CeedOperator, or any of its sub-operators, has outputs
+           that are not active
+
+  @param op                 CeedOperator
+  @param[out] has_passive  Variable to store whether a passive output was found
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorHasPassiveOutputs(CeedOperator op, bool *has_passive) {
+  int ierr;
+
+  *has_passive = false;
+  if (op->is_composite) {
+    for (CeedInt i=0; i<op->num_suboperators && !*has_passive; i++) {
+      ierr = CeedOperatorHasPassiveOutputs(op->sub_operators[i], has_passive);
+      CeedChk(ierr);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+  for (CeedInt i=0; i<op->qf->num_output_fields; i++) {
+    CeedVector vec = op->output_fields[i]->vec;
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE)
+      *has_passive = true;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply a non-composite CeedOperator to a set of vectors and add results
+           to the output vectors
+
+  @param op        CeedOperator to apply
+  @param num_vecs  Number of input/output vector pairs
+  @param[in] in    Array of @a num_vecs CeedVectors containing input states
+  @param[out] out  Array of @a num_vecs CeedVectors to sum in results
+  @param request   Address of CeedRequest for non-blocking completion
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorApplyAddMulti(CeedOperator op, CeedInt num_vecs,
+    CeedVector *in, CeedVector *out, CeedRequest *request) {
+  int ierr;
+
+  // Passive outputs accumulate once per vector, so apply each vector in turn
+  bool has_passive;
+  ierr = CeedOperatorHasPassiveOutputs(op, &has_passive); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (!has_passive && op->ApplyAddMulti) {
+    ierr = op->ApplyAddMulti(op, num_vecs, in, out, request); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Check for valid fallback resource
+  const char *resource, *fallback_resource;
+  ierr = CeedGetResource(op->ceed, &resource); CeedChk(ierr);
+  ierr = CeedGetOperatorFallbackResource(op->ceed, &fallback_resource);
+  CeedChk(ierr);
+  if (has_passive || !strcmp(fallback_resource, "") ||
+      !strcmp(resource, fallback_resource)) {
+    for (CeedInt v=0; v<num_vecs; v++) {
+      ierr = op->ApplyAdd(op, in[v], out[v], request); CeedChk(ierr);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Fallback to reference Ceed
+  if (!op->op_fallback) {
+    ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+  }
+  ierr = CeedSingleOperatorApplyAddMulti(op->op_fallback, num_vecs, in, out,
+                                         request); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add scaled contributions of a subset of elements of a CeedOperator
+
+  @param op             CeedOperator to apply
+  @param num_elem_list  Number of elements in @a elem_list
+  @param elem_list      Indices of the elements to apply
+  @param alpha          Scaling factor for the element contributions
+  @param[in] in         CeedVector containing input state
+  @param[out] out       CeedVector to sum in result
+  @param request        Address of CeedRequest for non-blocking completion
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAddElementsCore(CeedOperator op,
+    CeedInt num_elem_list, const CeedInt *elem_list, CeedScalar alpha,
+    CeedVector in, CeedVector out, CeedRequest *request) {
+  int ierr;
+
+  // Use backend version, if available
+  if (op->ApplyAddElements) {
+    ierr = op->ApplyAddElements(op, num_elem_list, elem_list, alpha, in, out,
+                                request); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Check for valid fallback resource
+  const char *resource, *fallback_resource;
+  ierr = CeedGetResource(op->ceed, &resource); CeedChk(ierr);
+  ierr = CeedGetOperatorFallbackResource(op->ceed, &fallback_resource);
+  CeedChk(ierr);
+  if (!strcmp(fallback_resource, "") || !strcmp(resource, fallback_resource))
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Backend does not support OperatorApplyAddElements");
+  // LCOV_EXCL_STOP
+
+  // Fallback to reference Ceed
+  if (!op->op_fallback) {
+    ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+  }
+  ierr = CeedOperatorApplyAddElementsCore(op->op_fallback, num_elem_list,
+                                          elem_list, alpha, in, out, request);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the values of a named QFunctionContext field in the context of
+           a CeedOperator QFunction, or of every sub-operator QFunction for a
+           composite CeedOperator, that registers this field
+
+  @param op            CeedOperator
+  @param field_name    Name of field to set
+  @param field_type    Data type of values
+  @param values        Values to set
+  @param[out] num_set  Variable to accumulate the number of contexts set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorContextSetGeneric(CeedOperator op,
+    const char *field_name, CeedContextFieldType field_type,
+    const void *values, CeedInt *num_set) {
+  int ierr;
+
+  if (op->is_composite) {
+    for (CeedInt i=0; i<op->num_suboperators; i++) {
+      ierr = CeedOperatorContextSetGeneric(op->sub_operators[i], field_name,
+                                           field_type, values, num_set);
+      CeedChk(ierr);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedQFunctionContext ctx = NULL;
+  CeedContextFieldLabel field_label = NULL;
+  ierr = CeedQFunctionGetInnerContext(op->qf, &ctx); CeedChk(ierr);
+  if (!ctx)
+    return CEED_ERROR_SUCCESS;
+  ierr = CeedQFunctionContextGetFieldLabel(ctx, field_name, &field_label);
+  CeedChk(ierr);
+  if (!field_label)
+    return CEED_ERROR_SUCCESS;
+
+  switch (field_type) {
+  case CEED_CONTEXT_FIELD_DOUBLE:
+    ierr = CeedQFunctionContextSetDouble(ctx, field_label,
+                                         (const double *)values);
+    CeedChk(ierr);
+    break;
+  case CEED_CONTEXT_FIELD_INT32:
+    ierr = CeedQFunctionContextSetInt32(ctx, field_label, (const int *)values);
+    CeedChk(ierr);
+    break;
+  }
+  (*num_set)++;
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -433,7 +931,7 @@ int CeedOperatorSetData(CeedOperator op, void *data) {
   @ref Backend
 **/
 int CeedOperatorReference(CeedOperator op) {
-  op->ref_count++;
+  CeedAtomicAdd(op->ref_count, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -452,6 +950,121 @@ int CeedOperatorSetSetupDone(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the E-vector the parent of a fallback CeedOperator holds for a
+           passive input field
+
+  The parent restricts the input CeedVector first if it changed since the last
+    restriction. The E-vector stores elements in blocks of @a blk_size, with
+    the element index fastest within each block. @a e_vec is NULL if @a op is
+    not a fallback or the parent backend does not share this field.
+
+  @param op                Fallback CeedOperator
+  @param input_field       Index of the passive input field
+  @param[out] e_vec        Variable to store the parent E-vector, not referenced
+  @param[out] blk_size     Variable to store the element block size
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetFallbackPassiveEVector(CeedOperator op, CeedInt input_field,
+    CeedVector *e_vec, CeedInt *blk_size) {
+  int ierr;
+  CeedOperator parent = op->op_fallback_parent;
+
+  *e_vec = NULL;
+  *blk_size = 1;
+  if (!parent || !parent->GetPassiveEVector)
+    return CEED_ERROR_SUCCESS;
+  ierr = parent->GetPassiveEVector(parent, input_field, e_vec, blk_size);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check if a CeedOperatorField holds compressed quadrature data
+
+  Compressed fields have no CeedVector. Backends read their values with
+    CeedOperatorFieldDecompressQData() instead of restricting the field.
+
+  @param op_field            CeedOperatorField
+  @param[out] is_compressed  Variable to store compression status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorFieldIsQDataCompressed(CeedOperatorField op_field,
+                                       bool *is_compressed) {
+  *is_compressed = op_field->qdata != NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Decode compressed quadrature data for a block of elements
+
+  Values for element first_elem + j, component c, and quadrature point q are
+    written to values[(c*Q + q)*blk_size + j], which is the layout of a
+    QFunction input for a block of blk_size elements. Use blk_size = 1 for a
+    single element. Elements past the end of the operator repeat the last
+    element, as in blocked CeedElemRestrictions.
+
+  @param op_field    CeedOperatorField with compressed quadrature data
+  @param first_elem  First element to decode
+  @param blk_size    Number of elements to decode
+  @param[out] values Array of Q*size*blk_size values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorFieldDecompressQData(CeedOperatorField op_field,
+                                     CeedInt first_elem, CeedInt blk_size,
+                                     CeedScalar *values) {
+  const CeedQDataCompressed qdata = op_field->qdata;
+  const CeedInt Q = qdata->num_qpts, num_comp_stored = qdata->num_comp_stored;
+
+  for (CeedInt j=0; j<blk_size; j++) {
+    const CeedInt e = CeedIntMin(first_elem + j, qdata->num_elem - 1);
+    const bool is_constant = qdata->elem_is_constant &&
+                             qdata->elem_is_constant[e];
+    const CeedInt num_qpts_stored = is_constant ? 1 : Q,
+                  q_stride = is_constant ? 0 : 1,
+                  offset = qdata->elem_offsets ? qdata->elem_offsets[e] :
+                           e*num_comp_stored*Q;
+    for (CeedInt c=0; c<qdata->num_comp; c++) {
+      const CeedInt k = qdata->comp_map[c],
+                    i = offset + k*num_qpts_stored;
+      CeedScalar *out = &values[c*Q*blk_size + j];
+      switch (qdata->storage) {
+      case CEED_QDATA_SCALAR: {
+        const CeedScalar *in = &((const CeedScalar *)qdata->values)[i];
+        if (is_constant && qdata->comp_is_weighted[e*num_comp_stored + k])
+          for (CeedInt q=0; q<Q; q++)
+            out[q*blk_size] = qdata->q_weights[q]*in[0];
+        else
+          for (CeedInt q=0; q<Q; q++)
+            out[q*blk_size] = in[q*q_stride];
+      } break;
+      case CEED_QDATA_FP32: {
+        const float *in = &((const float *)qdata->values)[i];
+        const CeedScalar scale = qdata->scales[e*num_comp_stored + k];
+        for (CeedInt q=0; q<Q; q++)
+          out[q*blk_size] = scale*in[q*q_stride];
+      } break;
+      case CEED_QDATA_BF16: {
+        const uint16_t *in = &((const uint16_t *)qdata->values)[i];
+        const CeedScalar scale = qdata->scales[e*num_comp_stored + k];
+        for (CeedInt q=0; q<Q; q++)
+          out[q*blk_size] = scale*CeedBF16ToFloat(in[q*q_stride]);
+      } break;
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -944,6 +1557,141 @@ int CeedOperatorSetNumQuadraturePoints(CeedOperator op, CeedInt num_qpts) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Store passive quadrature data once per element where it is constant
+
+  On affine elements, geometric factors derived from the Jacobian are the same
+    at every quadrature point. This function inspects the passive input field
+    @a field_name, which must use @ref CEED_BASIS_COLLOCATED and
+    @ref CEED_EVAL_NONE, and replaces its CeedVector with compressed
+    quadrature data that stores a single set of values for each element
+    where all quadrature points agree to within @a tol. Elements with varying
+    data, such as curved elements, keep one set of values per quadrature
+    point. Consecutive constant elements with identical values share storage,
+    and an element map locates the values of each element.
+
+  As with CeedOperatorCompressQData(), the backend decodes the values of each
+    element or block of elements in the QFunction input stage, so no
+    quadrature data is expanded to all quadrature points outside of the
+    QFunction input buffers.
+
+  Setup QFunctions such as the gallery Poisson3DBuild often fold quadrature
+    weights into the data, which then varies between quadrature points even on
+    affine elements. Components that are only constant with the quadrature
+    weights of the operator basis divided out are stored without the weights,
+    which are applied again when the values are decoded.
+
+  This function must be called before the CeedOperator is first applied.
+
+  @param op          CeedOperator
+  @param field_name  Name of the passive input field with quadrature data
+  @param tol         Relative tolerance for values to be considered constant
+                       over an element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorCompressElementQData(CeedOperator op, const char *field_name,
+                                     CeedScalar tol) {
+  return CeedOperatorCompressQData_Core(op, field_name, CEED_QDATA_SCALAR, true,
+                                        tol);
+}
+
+/**
+  @brief Store passive quadrature data in a compressed format
+
+  Stored quadrature data is often the largest persistent array of an operator.
+    This function replaces the CeedVector of the passive input field
+    @a field_name, which must use @ref CEED_BASIS_COLLOCATED and
+    @ref CEED_EVAL_NONE, with values stored in the format @a storage. With
+    @ref CEED_QDATA_FP32 and @ref CEED_QDATA_BF16, the values of each element
+    and component are divided by their largest magnitude before rounding, so
+    the relative error is bounded by the precision of the format. If the
+    QFunction field was declared with CeedQFunctionSetFieldSymmetric(), only
+    the upper triangle of each tensor is stored, holding the mean of each pair
+    of off-diagonal entries.
+
+  The QFunction still receives full precision CeedScalar values, which the
+    backend decodes for each element or block of elements in the QFunction
+    input stage. The operator releases its reference to the original
+    CeedVector, so its memory is freed once the user destroys it.
+
+  This function must be called before the CeedOperator is first applied.
+
+  @param op          CeedOperator
+  @param field_name  Name of the passive input field with quadrature data
+  @param storage     Storage format for the values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorCompressQData(CeedOperator op, const char *field_name,
+                              CeedQDataStorage storage) {
+  return CeedOperatorCompressQData_Core(op, field_name, storage, false, 0.0);
+}
+
+/**
+  @brief Set the values of a double precision QFunctionContext field
+           registered by the QFunction context of a CeedOperator.
+           For a composite CeedOperator, the field is set in every
+           sub-operator that registers it.
+
+  @param op          CeedOperator
+  @param field_name  Name of field to set
+  @param values      Values to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorContextSetDouble(CeedOperator op, const char *field_name,
+                                 const double *values) {
+  int ierr;
+  CeedInt num_set = 0;
+
+  ierr = CeedOperatorContextSetGeneric(op, field_name,
+                                       CEED_CONTEXT_FIELD_DOUBLE, values,
+                                       &num_set); CeedChk(ierr);
+  if (!num_set)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_INCOMPLETE,
+                     "No QFunctionContext field named \"%s\"", field_name);
+  // LCOV_EXCL_STOP
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the values of a 32 bit integer QFunctionContext field
+           registered by the QFunction context of a CeedOperator.
+           For a composite CeedOperator, the field is set in every
+           sub-operator that registers it.
+
+  @param op          CeedOperator
+  @param field_name  Name of field to set
+  @param values      Values to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorContextSetInt32(CeedOperator op, const char *field_name,
+                                const int *values) {
+  int ierr;
+  CeedInt num_set = 0;
+
+  ierr = CeedOperatorContextSetGeneric(op, field_name,
+                                       CEED_CONTEXT_FIELD_INT32, values,
+                                       &num_set); CeedChk(ierr);
+  if (!num_set)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_INCOMPLETE,
+                     "No QFunctionContext field named \"%s\"", field_name);
+  // LCOV_EXCL_STOP
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a CeedOperator
 
@@ -1153,6 +1901,221 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply CeedOperator to a set of vectors
+
+  This computes the action of the operator on each of @a num_vecs (active)
+  inputs, yielding the corresponding (active) outputs. This is equivalent to
+  calling CeedOperatorApply() once per input vector. Backends may apply the
+  operator to all vectors element by element, so each element reads its
+  passive inputs once for the whole set.
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+  @param op        CeedOperator to apply
+  @param num_vecs  Number of input/output vector pairs
+  @param[in] in    Array of @a num_vecs CeedVectors containing input states
+  @param[out] out  Array of @a num_vecs distinct CeedVectors to store results
+                     of applying operator (each must be distinct from all of
+                     @a in)
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyMulti(CeedOperator op, CeedInt num_vecs, CeedVector *in,
+                           CeedVector *out, CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  // Passive outputs hold the result of the last vector only
+  bool has_passive;
+  ierr = CeedOperatorHasPassiveOutputs(op, &has_passive); CeedChk(ierr);
+  if (has_passive) {
+    for (CeedInt v=0; v<num_vecs; v++) {
+      ierr = CeedOperatorApply(op, in[v], out[v], request); CeedChk(ierr);
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Zero all output vectors
+  for (CeedInt v=0; v<num_vecs; v++)
+    if (out[v] != CEED_VECTOR_NONE) {
+      ierr = CeedVectorSetValue(out[v], 0.0); CeedChk(ierr);
+    }
+
+  // Apply
+  ierr = CeedOperatorApplyAddMulti(op, num_vecs, in, out, request);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply CeedOperator on a subset of elements and add result to output
+           vector
+
+  This computes the contributions of the listed elements only, reusing the
+  element restrictions and layouts of the operator, so the cost is proportional
+  to @a num_elem_list rather than the number of elements in the operator.
+  Passive inputs that changed since the last application are restricted in
+  full. An element listed more than once contributes once per occurrence.
+
+  Note: Backends without native support use the reference backend operator as
+          a fallback, which allocates and restricts into full E-vectors on
+          first use, so the fallback memory cost is that of CeedOperatorApply().
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+  @param op             CeedOperator to apply
+  @param num_elem_list  Number of elements in @a elem_list
+  @param elem_list      Indices of the elements to apply, each in the range
+                          [0, num_elem)
+  @param[in] in         CeedVector containing input state or
+                          @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out       CeedVector to sum in result of applying operator (must
+                          be distinct from @a in) or @ref CEED_VECTOR_NONE if
+                          there are no active outputs
+  @param request        Address of CeedRequest for non-blocking completion,
+                          else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddElements(CeedOperator op, CeedInt num_elem_list,
+                                 const CeedInt *elem_list, CeedVector in,
+                                 CeedVector out, CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  if (op->is_composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Element subsets not supported for composite operator");
+  // LCOV_EXCL_STOP
+  for (CeedInt k=0; k<num_elem_list; k++)
+    if (elem_list[k] < 0 || elem_list[k] >= op->num_elem)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, CEED_ERROR_DIMENSION,
+                       "Element %d out of range for operator with %d elements",
+                       elem_list[k], op->num_elem);
+  // LCOV_EXCL_STOP
+
+  ierr = CeedOperatorApplyAddElementsCore(op, num_elem_list, elem_list, 1.0, in,
+                                          out, request); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Replace the contributions of a subset of elements in a previously
+           computed output vector
+
+  This adds the contributions of the listed elements evaluated at @a in and
+  subtracts their contributions evaluated at @a in_prev, so that @a out holds
+  the result of CeedOperatorApply() with @a in when it previously held the
+  result with @a in_prev and the two inputs differ only on the listed elements.
+  This is valid for nonlinear operators, as each element contribution is
+  evaluated separately.
+
+  Note: Backends without native support use the reference backend operator as
+          a fallback, which allocates and restricts into full E-vectors on
+          first use, so the fallback memory cost is that of CeedOperatorApply().
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+  @param op             CeedOperator to apply
+  @param num_elem_list  Number of elements in @a elem_list
+  @param elem_list      Indices of the elements to update, each in the range
+                          [0, num_elem)
+  @param[in] in_prev    CeedVector containing the previous input state
+  @param[in] in         CeedVector containing the new input state
+  @param[in,out] out    CeedVector to update (must be distinct from @a in and
+                          @a in_prev)
+  @param request        Address of CeedRequest for non-blocking completion,
+                          else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorUpdateElements(CeedOperator op, CeedInt num_elem_list,
+                               const CeedInt *elem_list, CeedVector in_prev,
+                               CeedVector in, CeedVector out,
+                               CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  if (op->is_composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Element subsets not supported for composite operator");
+  // LCOV_EXCL_STOP
+  for (CeedInt k=0; k<num_elem_list; k++)
+    if (elem_list[k] < 0 || elem_list[k] >= op->num_elem)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, CEED_ERROR_DIMENSION,
+                       "Element %d out of range for operator with %d elements",
+                       elem_list[k], op->num_elem);
+  // LCOV_EXCL_STOP
+
+  ierr = CeedOperatorApplyAddElementsCore(op, num_elem_list, elem_list, -1.0,
+                                          in_prev, out, request); CeedChk(ierr);
+  ierr = CeedOperatorApplyAddElementsCore(op, num_elem_list, elem_list, 1.0, in,
+                                          out, request); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply CeedOperator to a set of vectors and add results to the output
+           vectors
+
+  This is equivalent to calling CeedOperatorApplyAdd() once per input vector.
+  See CeedOperatorApplyMulti() for details.
+
+  @param op        CeedOperator to apply
+  @param num_vecs  Number of input/output vector pairs
+  @param[in] in    Array of @a num_vecs CeedVectors containing input states
+  @param[out] out  Array of @a num_vecs distinct CeedVectors to sum in results
+                     of applying operator (each must be distinct from all of
+                     @a in)
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddMulti(CeedOperator op, CeedInt num_vecs,
+                              CeedVector *in, CeedVector *out,
+                              CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  if (num_vecs < 0)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_DIMENSION,
+                     "Number of vectors must be non-negative");
+  // LCOV_EXCL_STOP
+
+  if (op->num_elem) {
+    // Standard Operator
+    ierr = CeedSingleOperatorApplyAddMulti(op, num_vecs, in, out, request);
+    CeedChk(ierr);
+  } else if (op->is_composite) {
+    // Composite Operator
+    for (CeedInt i=0; i<op->num_suboperators; i++) {
+      ierr = CeedSingleOperatorApplyAddMulti(op->sub_operators[i], num_vecs, in,
+                                             out, request); CeedChk(ierr);
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Destroy a CeedOperator
 
@@ -1165,7 +2128,8 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
 int CeedOperatorDestroy(CeedOperator *op) {
   int ierr;
 
-  if (!*op || --(*op)->ref_count > 0) return CEED_ERROR_SUCCESS;
+  if (!*op || CeedAtomicAdd((*op)->ref_count, -1) > 0)
+    return CEED_ERROR_SUCCESS;
   if ((*op)->Destroy) {
     ierr = (*op)->Destroy(*op); CeedChk(ierr);
   }
@@ -1184,6 +2148,8 @@ int CeedOperatorDestroy(CeedOperator *op) {
           (*op)->input_fields[i]->vec != CEED_VECTOR_NONE ) {
         ierr = CeedVectorDestroy(&(*op)->input_fields[i]->vec); CeedChk(ierr);
       }
+      ierr = CeedQDataCompressedDestroy(&(*op)->input_fields[i]->qdata);
+      CeedChk(ierr);
       ierr = CeedFree(&(*op)->input_fields[i]->field_name); CeedChk(ierr);
       ierr = CeedFree(&(*op)->input_fields[i]); CeedChk(ierr);
     }
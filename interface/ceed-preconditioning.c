@@ -74,6 +74,8 @@ int CeedOperatorCreateFallback(CeedOperator op) {
   op_ref->is_interface_setup = false;
   op_ref->is_backend_setup = false;
   op_ref->ceed = ceed_ref;
+  op_ref->op_fallback_parent = op;
+  op_ref->GetPassiveEVector = NULL;
   ierr = ceed_ref->OperatorCreate(op_ref); CeedChk(ierr);
   op->op_fallback = op_ref;
 
@@ -173,6 +175,282 @@ static int CeedOperatorCreateActivePointBlockRestriction(
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Apply a 1D matrix along each dimension of a tensor-product array
+
+  @param[in] dim     Topological dimension
+  @param[in] Q_in    Number of input points in one dimension
+  @param[in] Q_out   Number of output points in one dimension
+  @param[in] mat_1d  Row-major matrix of size Q_out * Q_in
+  @param[in] in      Input array of size Q_in^dim
+  @param[out] out    Output array of size Q_out^dim
+  @param[in] buffer  Scratch array of size max(Q_in, Q_out)^dim
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedTensorContractHost(CeedInt dim, CeedInt Q_in, CeedInt Q_out,
+                                  const CeedScalar *mat_1d, const CeedScalar *in,
+                                  CeedScalar *out, CeedScalar *buffer) {
+  CeedInt pre = 1, post = 1;
+  for (CeedInt d=0; d<dim; d++)
+    post *= Q_in;
+
+  const CeedScalar *u = in;
+  CeedScalar *v = dim % 2 ? out : buffer;
+  for (CeedInt d=0; d<dim; d++) {
+    post /= Q_in;
+    for (CeedInt a=0; a<pre; a++)
+      for (CeedInt j=0; j<Q_out; j++)
+        for (CeedInt b=0; b<post; b++) {
+          CeedScalar sum = 0.0;
+          for (CeedInt i=0; i<Q_in; i++)
+            sum += mat_1d[j*Q_in + i] * u[(a*Q_in + i)*post + b];
+          v[(a*Q_out + j)*post + b] = sum;
+        }
+    pre *= Q_out;
+    u = v;
+    v = (v == out) ? buffer : out;
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the active fields of a mass-type CeedOperator, with a single
+           interpolated active input and output
+
+  @param[in] op          CeedOperator to query
+  @param[out] is_mass    Boolean flag indicating a mass-type operator
+  @param[out] basis_in   Active input CeedBasis
+  @param[out] basis_out  Active output CeedBasis
+  @param[out] rstr_out   Active output CeedElemRestriction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorGetMassFields(CeedOperator op, bool *is_mass,
+    CeedBasis *basis_in, CeedBasis *basis_out, CeedElemRestriction *rstr_out) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt num_input_fields, num_output_fields, num_active_in = 0,
+                                               num_active_out = 0;
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_input_fields,
+                               &num_output_fields, &op_output_fields);
+  CeedChk(ierr);
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields); CeedChk(ierr);
+
+  *is_mass = true;
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(op_input_fields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedEvalMode eval_mode;
+      ierr = CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode);
+      CeedChk(ierr);
+      *is_mass = *is_mass && eval_mode == CEED_EVAL_INTERP;
+      ierr = CeedOperatorFieldGetBasis(op_input_fields[i], basis_in);
+      CeedChk(ierr);
+      num_active_in++;
+    }
+  }
+  for (CeedInt i=0; i<num_output_fields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(op_output_fields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedEvalMode eval_mode;
+      ierr = CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode);
+      CeedChk(ierr);
+      *is_mass = *is_mass && eval_mode == CEED_EVAL_INTERP;
+      ierr = CeedOperatorFieldGetBasis(op_output_fields[i], basis_out);
+      CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(op_output_fields[i], rstr_out);
+      CeedChk(ierr);
+      num_active_out++;
+    }
+  }
+  *is_mass = *is_mass && num_active_in == 1 && num_active_out == 1;
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Core logic for assembling the diagonal or the row-sum lumped diagonal
+           of a mass-type operator with sum factorization
+
+  For the element matrix B_out^T D B_in, the diagonal is B_sq^T d, where d
+    holds the diagonal blocks of D at each quadrature point and B_sq is the
+    entrywise product of B_out and B_in. For tensor bases B_sq is the tensor
+    product of the entrywise products of the 1D interpolation matrices. The row
+    sums are B_out^T D (B_in 1). Both are accumulated into the L-vector with a
+    single transpose restriction.
+
+  @param[in] op          CeedOperator to assemble diagonal
+  @param[in] request     Address of CeedRequest for non-blocking completion, else
+                           CEED_REQUEST_IMMEDIATE
+  @param[in] is_lumped   Boolean flag to assemble row sums or the diagonal
+  @param[out] assembled  CeedVector to store assembled diagonal
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleAddMassDiagonal(CeedOperator op,
+    CeedRequest *request, const bool is_lumped, CeedVector assembled) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+
+  // Active fields
+  bool is_mass, is_tensor_in, is_tensor_out;
+  CeedBasis basis_in = NULL, basis_out = NULL;
+  CeedElemRestriction rstr_out = NULL;
+  ierr = CeedSingleOperatorGetMassFields(op, &is_mass, &basis_in, &basis_out,
+                                         &rstr_out); CeedChk(ierr);
+  if (!is_mass)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Mass diagonal assembly requires a single interpolated "
+                     "active input and output");
+  // LCOV_EXCL_STOP
+  ierr = CeedBasisIsTensor(basis_in, &is_tensor_in); CeedChk(ierr);
+  ierr = CeedBasisIsTensor(basis_out, &is_tensor_out); CeedChk(ierr);
+  const bool is_tensor = is_tensor_in && is_tensor_out;
+  CeedInt num_elem, num_comp, dim, num_qpts, num_nodes_in, num_nodes_out, P_in,
+          P_out, Q;
+  const CeedScalar *interp_in, *interp_out;
+  ierr = CeedElemRestrictionGetNumElements(rstr_out, &num_elem); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis_out, &num_comp); CeedChk(ierr);
+  ierr = CeedBasisGetDimension(basis_out, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis_out, &num_qpts); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis_in, &num_nodes_in); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis_out, &num_nodes_out); CeedChk(ierr);
+  if (is_tensor) {
+    ierr = CeedBasisGetNumNodes1D(basis_in, &P_in); CeedChk(ierr);
+    ierr = CeedBasisGetNumNodes1D(basis_out, &P_out); CeedChk(ierr);
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis_out, &Q); CeedChk(ierr);
+    ierr = CeedBasisGetInterp1D(basis_in, &interp_in); CeedChk(ierr);
+    ierr = CeedBasisGetInterp1D(basis_out, &interp_out); CeedChk(ierr);
+  } else {
+    P_in = num_nodes_in;
+    P_out = num_nodes_out;
+    Q = num_qpts;
+    ierr = CeedBasisGetInterp(basis_in, &interp_in); CeedChk(ierr);
+    ierr = CeedBasisGetInterp(basis_out, &interp_out); CeedChk(ierr);
+  }
+  if (!is_lumped && P_in != P_out)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Mass diagonal assembly requires matching active input "
+                     "and output bases");
+  // LCOV_EXCL_STOP
+
+  // Assemble QFunction
+  CeedVector assembled_qf;
+  CeedElemRestriction rstr_qf;
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf,
+         &rstr_qf, request); CeedChk(ierr);
+  CeedInt layout[3];
+  ierr = CeedElemRestrictionGetELayout(rstr_qf, &layout); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_qf); CeedChk(ierr);
+
+  // Transposed output interpolation, squared entrywise for the diagonal
+  CeedScalar *interp_t, *interp_ones, *q_values, *buffer = NULL;
+  ierr = CeedMalloc(P_out*Q, &interp_t); CeedChk(ierr);
+  for (CeedInt n=0; n<P_out; n++)
+    for (CeedInt q=0; q<Q; q++)
+      interp_t[n*Q+q] = interp_out[q*P_out+n] *
+                        (is_lumped ? 1.0 : interp_in[q*P_in+n]);
+
+  // Interpolated ones for row sums
+  ierr = CeedCalloc(num_qpts, &interp_ones); CeedChk(ierr);
+  ierr = CeedCalloc(num_qpts, &q_values); CeedChk(ierr);
+  if (is_tensor) {
+    CeedInt buffer_size = 1;
+    for (CeedInt d=0; d<dim; d++)
+      buffer_size *= CeedIntMax(CeedIntMax(P_in, P_out), Q);
+    ierr = CeedCalloc(buffer_size, &buffer); CeedChk(ierr);
+  }
+  if (is_lumped) {
+    if (is_tensor) {
+      CeedScalar *ones;
+      ierr = CeedMalloc(num_nodes_in, &ones); CeedChk(ierr);
+      for (CeedInt n=0; n<num_nodes_in; n++)
+        ones[n] = 1.0;
+      ierr = CeedTensorContractHost(dim, P_in, Q, interp_in, ones, interp_ones,
+                                    buffer); CeedChk(ierr);
+      ierr = CeedFree(&ones); CeedChk(ierr);
+    } else {
+      for (CeedInt q=0; q<num_qpts; q++)
+        for (CeedInt n=0; n<num_nodes_in; n++)
+          interp_ones[q] += interp_in[q*num_nodes_in+n];
+    }
+  }
+
+  // Element diagonals, [elem, comp, node]
+  CeedVector elem_diag;
+  const CeedScalar *assembled_qf_array;
+  CeedScalar *elem_diag_array;
+  ierr = CeedElemRestrictionCreateVector(rstr_out, NULL, &elem_diag);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST,
+                                &assembled_qf_array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(elem_diag, CEED_MEM_HOST, &elem_diag_array);
+  CeedChk(ierr);
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt c_out=0; c_out<num_comp; c_out++) {
+      // Quadrature point row sums or diagonal of D
+      for (CeedInt q=0; q<num_qpts; q++) {
+        CeedScalar value = 0.0;
+        if (is_lumped) {
+          for (CeedInt c_in=0; c_in<num_comp; c_in++)
+            value += assembled_qf_array[q*layout[0] + (c_in*num_comp+c_out)*
+                                        layout[1] + e*layout[2]] *
+                     interp_ones[q];
+        } else {
+          value = assembled_qf_array[q*layout[0] + (c_out*num_comp+c_out)*
+                                     layout[1] + e*layout[2]];
+        }
+        q_values[q] = value;
+      }
+      // Transpose interpolation to nodes
+      CeedScalar *out = &elem_diag_array[(e*num_comp+c_out)*num_nodes_out];
+      if (is_tensor) {
+        ierr = CeedTensorContractHost(dim, Q, P_out, interp_t, q_values, out,
+                                      buffer); CeedChk(ierr);
+      } else {
+        for (CeedInt n=0; n<num_nodes_out; n++) {
+          out[n] = 0.0;
+          for (CeedInt q=0; q<num_qpts; q++)
+            out[n] += interp_t[n*num_qpts+q] * q_values[q];
+        }
+      }
+    }
+  ierr = CeedVectorRestoreArray(elem_diag, &elem_diag_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
+  CeedChk(ierr);
+
+  // Local accumulation
+  ierr = CeedElemRestrictionApply(rstr_out, CEED_TRANSPOSE, elem_diag,
+                                  assembled, request); CeedChk(ierr);
+
+  // Cleanup
+  ierr = CeedFree(&interp_t); CeedChk(ierr);
+  ierr = CeedFree(&interp_ones); CeedChk(ierr);
+  ierr = CeedFree(&q_values); CeedChk(ierr);
+  ierr = CeedFree(&buffer); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&elem_diag); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled_qf); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Core logic for assembling operator diagonal or point block diagonal
 
@@ -192,6 +470,24 @@ static inline int CeedSingleOperatorAssembleAddDiagonal(CeedOperator op,
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
 
+  // Sum factorization for mass matrices with tensor bases
+  if (!is_pointblock) {
+    bool is_mass, is_tensor_in = false, is_tensor_out = false;
+    CeedBasis basis_in, basis_out;
+    CeedElemRestriction rstr_out;
+    ierr = CeedSingleOperatorGetMassFields(op, &is_mass, &basis_in, &basis_out,
+                                           &rstr_out); CeedChk(ierr);
+    if (is_mass) {
+      ierr = CeedBasisIsTensor(basis_in, &is_tensor_in); CeedChk(ierr);
+      ierr = CeedBasisIsTensor(basis_out, &is_tensor_out); CeedChk(ierr);
+    }
+    if (is_tensor_in && is_tensor_out) {
+      ierr = CeedSingleOperatorAssembleAddMassDiagonal(op, request, false,
+             assembled); CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
   // Assemble QFunction
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
@@ -434,78 +730,127 @@ static inline int CeedCompositeOperatorLinearAssembleAddDiagonal(
 }
 
 /**
-  @brief Build nonzero pattern for non-composite operator
+  @brief Compute the L-vector index of each E-vector entry of a restriction
 
-  Users should generally use CeedOperatorLinearAssembleSymbolic()
+  @param[in] rstr       CeedElemRestriction to query
+  @param[out] elem_dof  E-vector holding the L-vector index of each entry
 
-  @param[in] op      CeedOperator to assemble nonzero pattern
-  @param[in] offset  Offset for number of entries
-  @param[out] rows   Row number for each entry
-  @param[out] cols   Column number for each entry
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionGetElemDof(CeedElemRestriction rstr,
+    CeedVector *elem_dof) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+  CeedVector index_vec;
+  ierr = CeedElemRestrictionCreateVector(rstr, &index_vec, elem_dof);
+  CeedChk(ierr);
+  CeedInt num_nodes;
+  ierr = CeedVectorGetLength(index_vec, &num_nodes); CeedChk(ierr);
+  CeedScalar *array;
+  ierr = CeedVectorGetArray(index_vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  for (CeedInt i = 0; i < num_nodes; ++i) {
+    array[i] = i;
+  }
+  ierr = CeedVectorRestoreArray(index_vec, &array); CeedChk(ierr);
+  ierr = CeedVectorSetValue(*elem_dof, 0.0); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstr, CEED_NOTRANSPOSE, index_vec, *elem_dof,
+                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&index_vec); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the L-vector index of each E-vector entry for a range of
+           elements, directly from the offsets or strides of a restriction
+
+  @param[in] rstr        CeedElemRestriction to query
+  @param[in] offsets     Offsets of @a rstr on the host, or NULL if @a rstr is
+                           strided
+  @param[in] elem_start  First element
+  @param[in] elem_end    One past the last element
+  @param[out] elem_dof   L-vector index of node i of component c of element e,
+                           at ((e - elem_start)*num_comp + c)*elem_size + i
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset,
+static int CeedElemRestrictionGetElemDofRange(CeedElemRestriction rstr,
+    const CeedInt *offsets, CeedInt elem_start, CeedInt elem_end,
+    CeedInt *elem_dof) {
+  int ierr;
+  CeedInt elem_size, num_comp, comp_stride = 0, strides[3] = {0, 0, 0};
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elem_size); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &num_comp); CeedChk(ierr);
+  if (offsets) {
+    ierr = CeedElemRestrictionGetCompStride(rstr, &comp_stride); CeedChk(ierr);
+  } else {
+    bool has_backend_strides;
+    ierr = CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides);
+    CeedChk(ierr);
+    if (has_backend_strides) {
+      ierr = CeedElemRestrictionGetELayout(rstr, &strides); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionGetStrides(rstr, &strides); CeedChk(ierr);
+    }
+  }
+
+  for (CeedInt e = elem_start; e < elem_end; e++)
+    for (CeedInt c = 0; c < num_comp; c++)
+      for (CeedInt i = 0; i < elem_size; i++)
+        elem_dof[((e - elem_start)*num_comp + c)*elem_size + i] = offsets ?
+            offsets[e*elem_size + i] + c*comp_stride :
+            i*strides[0] + c*strides[1] + e*strides[2];
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build nonzero pattern for a range of elements of a non-composite
+           operator
+
+  @param[in] op          CeedOperator to assemble nonzero pattern
+  @param[in] elem_dof    L-vector index of each active E-vector entry of the
+                           range, from CeedElemRestrictionGetElemDofRange()
+  @param[in] elem_start  First element to assemble
+  @param[in] elem_end    One past the last element to assemble
+  @param[out] rows       Row number for each entry
+  @param[out] cols       Column number for each entry
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleSymbolicElements(CeedOperator op,
+    const CeedInt *elem_dof, CeedInt elem_start, CeedInt elem_end,
     CeedInt *rows, CeedInt *cols) {
   int ierr;
   Ceed ceed = op->ceed;
-  if (op->is_composite)
-    // LCOV_EXCL_START
-    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
-                     "Composite operator not supported");
-  // LCOV_EXCL_STOP
 
   CeedElemRestriction rstr_in;
   ierr = CeedOperatorGetActiveElemRestriction(op, &rstr_in); CeedChk(ierr);
-  CeedInt num_elem, elem_size, num_nodes, num_comp;
-  ierr = CeedElemRestrictionGetNumElements(rstr_in, &num_elem); CeedChk(ierr);
+  CeedInt elem_size, num_comp;
   ierr = CeedElemRestrictionGetElementSize(rstr_in, &elem_size); CeedChk(ierr);
-  ierr = CeedElemRestrictionGetLVectorSize(rstr_in, &num_nodes); CeedChk(ierr);
   ierr = CeedElemRestrictionGetNumComponents(rstr_in, &num_comp); CeedChk(ierr);
-  CeedInt layout_er[3];
-  ierr = CeedElemRestrictionGetELayout(rstr_in, &layout_er); CeedChk(ierr);
-
-  CeedInt local_num_entries = elem_size*num_comp * elem_size*num_comp * num_elem;
 
-  // Determine elem_dof relation
-  CeedVector index_vec;
-  ierr = CeedVectorCreate(ceed, num_nodes, &index_vec); CeedChk(ierr);
-  CeedScalar *array;
-  ierr = CeedVectorGetArray(index_vec, CEED_MEM_HOST, &array); CeedChk(ierr);
-  for (CeedInt i = 0; i < num_nodes; ++i) {
-    array[i] = i;
-  }
-  ierr = CeedVectorRestoreArray(index_vec, &array); CeedChk(ierr);
-  CeedVector elem_dof;
-  ierr = CeedVectorCreate(ceed, num_elem * elem_size * num_comp, &elem_dof);
-  CeedChk(ierr);
-  ierr = CeedVectorSetValue(elem_dof, 0.0); CeedChk(ierr);
-  CeedElemRestrictionApply(rstr_in, CEED_NOTRANSPOSE, index_vec,
-                           elem_dof, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
-  const CeedScalar *elem_dof_a;
-  ierr = CeedVectorGetArrayRead(elem_dof, CEED_MEM_HOST, &elem_dof_a);
-  CeedChk(ierr);
-  ierr = CeedVectorDestroy(&index_vec); CeedChk(ierr);
+  CeedInt local_num_entries = elem_size*num_comp * elem_size*num_comp *
+                              (elem_end - elem_start);
 
   // Determine i, j locations for element matrices
   CeedInt count = 0;
-  for (int e = 0; e < num_elem; ++e) {
+  for (int e = 0; e < elem_end - elem_start; ++e) {
     for (int comp_in = 0; comp_in < num_comp; ++comp_in) {
       for (int comp_out = 0; comp_out < num_comp; ++comp_out) {
         for (int i = 0; i < elem_size; ++i) {
           for (int j = 0; j < elem_size; ++j) {
-            const CeedInt elem_dof_index_row = (i)*layout_er[0] +
-                                               (comp_out)*layout_er[1] + e*layout_er[2];
-            const CeedInt elem_dof_index_col = (j)*layout_er[0] +
-                                               (comp_in)*layout_er[1] + e*layout_er[2];
+            const CeedInt row = elem_dof[(e*num_comp + comp_out)*elem_size + i];
+            const CeedInt col = elem_dof[(e*num_comp + comp_in)*elem_size + j];
 
-            const CeedInt row = elem_dof_a[elem_dof_index_row];
-            const CeedInt col = elem_dof_a[elem_dof_index_col];
-
-            rows[offset + count] = row;
-            cols[offset + count] = col;
+            rows[count] = row;
+            cols[count] = col;
             count++;
           }
         }
@@ -516,27 +861,26 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset,
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_MAJOR, "Error computing assembled entries");
   // LCOV_EXCL_STOP
-  ierr = CeedVectorRestoreArrayRead(elem_dof, &elem_dof_a); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&elem_dof); CeedChk(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief Assemble nonzero entries for non-composite operator
+  @brief Build nonzero pattern for non-composite operator
 
-  Users should generally use CeedOperatorLinearAssemble()
+  Users should generally use CeedOperatorLinearAssembleSymbolic()
 
-  @param[in] op       CeedOperator to assemble
-  @param[out] offset  Offest for number of entries
-  @param[out] values  Values to assemble into matrix
+  @param[in] op      CeedOperator to assemble nonzero pattern
+  @param[in] offset  Offset for number of entries
+  @param[out] rows   Row number for each entry
+  @param[out] cols   Column number for each entry
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
-                                      CeedVector values) {
+static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset,
+    CeedInt *rows, CeedInt *cols) {
   int ierr;
   Ceed ceed = op->ceed;
   if (op->is_composite)
@@ -545,16 +889,60 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
                      "Composite operator not supported");
   // LCOV_EXCL_STOP
 
-  // Assemble QFunction
+  CeedElemRestriction rstr_in;
+  ierr = CeedOperatorGetActiveElemRestriction(op, &rstr_in); CeedChk(ierr);
+  CeedInt num_elem, elem_size, num_comp;
+  ierr = CeedElemRestrictionGetNumElements(rstr_in, &num_elem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr_in, &elem_size); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr_in, &num_comp); CeedChk(ierr);
+
+  // Determine elem_dof relation
+  bool is_strided;
+  const CeedInt *offsets = NULL;
+  CeedInt *elem_dof;
+  ierr = CeedElemRestrictionIsStrided(rstr_in, &is_strided); CeedChk(ierr);
+  if (!is_strided) {
+    ierr = CeedElemRestrictionGetOffsets(rstr_in, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+  }
+  ierr = CeedMalloc(num_elem*elem_size*num_comp, &elem_dof); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElemDofRange(rstr_in, offsets, 0, num_elem,
+         elem_dof); CeedChk(ierr);
+  if (!is_strided) {
+    ierr = CeedElemRestrictionRestoreOffsets(rstr_in, &offsets); CeedChk(ierr);
+  }
+
+  ierr = CeedSingleOperatorAssembleSymbolicElements(op, elem_dof, 0, num_elem,
+         &rows[offset], &cols[offset]); CeedChk(ierr);
+  ierr = CeedFree(&elem_dof); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Assemble nonzero entries for a range of elements of a non-composite
+           operator
+
+  @param[in] op                  CeedOperator to assemble
+  @param[in] assembled_qf_array  Linearized QFunction data for @a op
+  @param[in] layout_qf           E-vector layout of the linearized QFunction
+  @param[in] qf_elem_start       First element in @a assembled_qf_array
+  @param[in] elem_start          First element to assemble
+  @param[in] elem_end            One past the last element to assemble
+  @param[out] vals               Values to assemble into matrix
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleElements(CeedOperator op,
+    const CeedScalar *assembled_qf_array, const CeedInt layout_qf[3],
+    CeedInt qf_elem_start, CeedInt elem_start, CeedInt elem_end,
+    CeedScalar *vals) {
+  int ierr;
+  Ceed ceed = op->ceed;
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedVector assembled_qf;
-  CeedElemRestriction rstr_q;
-  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(
-           op, &assembled_qf, &rstr_q, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
-
-  CeedInt qf_length;
-  ierr = CeedVectorGetLength(assembled_qf, &qf_length); CeedChk(ierr);
 
   CeedInt num_input_fields, num_output_fields;
   CeedOperatorField *input_fields;
@@ -648,27 +1036,19 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
                      "Cannot assemble operator with out inputs/outputs");
   // LCOV_EXCL_STOP
 
-  CeedInt num_elem, elem_size, num_qpts, num_comp;
-  ierr = CeedElemRestrictionGetNumElements(rstr_in, &num_elem); CeedChk(ierr);
+  CeedInt elem_size, num_qpts, num_comp;
   ierr = CeedElemRestrictionGetElementSize(rstr_in, &elem_size); CeedChk(ierr);
   ierr = CeedElemRestrictionGetNumComponents(rstr_in, &num_comp); CeedChk(ierr);
   ierr = CeedBasisGetNumQuadraturePoints(basis_in, &num_qpts); CeedChk(ierr);
 
-  CeedInt local_num_entries = elem_size*num_comp * elem_size*num_comp * num_elem;
+  CeedInt local_num_entries = elem_size*num_comp * elem_size*num_comp *
+                              (elem_end - elem_start);
 
   // loop over elements and put in data structure
   const CeedScalar *interp_in, *grad_in;
   ierr = CeedBasisGetInterp(basis_in, &interp_in); CeedChk(ierr);
   ierr = CeedBasisGetGrad(basis_in, &grad_in); CeedChk(ierr);
 
-  const CeedScalar *assembled_qf_array;
-  ierr = CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array);
-  CeedChk(ierr);
-
-  CeedInt layout_qf[3];
-  ierr = CeedElemRestrictionGetELayout(rstr_q, &layout_qf); CeedChk(ierr);
-  ierr = CeedElemRestrictionDestroy(&rstr_q); CeedChk(ierr);
-
   // we store B_mat_in, B_mat_out, BTD, elem_mat in row-major order
   CeedScalar B_mat_in[(num_qpts * num_eval_mode_in) * elem_size];
   CeedScalar B_mat_out[(num_qpts * num_eval_mode_out) * elem_size];
@@ -677,9 +1057,7 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
   CeedScalar BTD[elem_size * num_qpts*num_eval_mode_in];
   CeedScalar elem_mat[elem_size * elem_size];
   int count = 0;
-  CeedScalar *vals;
-  ierr = CeedVectorGetArray(values, CEED_MEM_HOST, &vals); CeedChk(ierr);
-  for (int e = 0; e < num_elem; ++e) {
+  for (int e = elem_start; e < elem_end; ++e) {
     for (int comp_in = 0; comp_in < num_comp; ++comp_in) {
       for (int comp_out = 0; comp_out < num_comp; ++comp_out) {
         for (int ell = 0; ell < (num_qpts * num_eval_mode_in) * elem_size; ++ell) {
@@ -734,7 +1112,7 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
               const int eval_mode_index = ((ei*num_comp+comp_in)*num_eval_mode_in+ej)*num_comp
                                           +comp_out;
               const int index = q*layout_qf[0] + eval_mode_index*layout_qf[1] +
-                                e*layout_qf[2];
+                                (e - qf_elem_start)*layout_qf[2];
               D_mat[(ei*num_eval_mode_in+ej)*num_qpts + q] += assembled_qf_array[index];
             }
           }
@@ -761,7 +1139,7 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
         // put element matrix in coordinate data structure
         for (int i = 0; i < elem_size; ++i) {
           for (int j = 0; j < elem_size; ++j) {
-            vals[offset + count] = elem_mat[i*elem_size + j];
+            vals[count] = elem_mat[i*elem_size + j];
             count++;
           }
         }
@@ -772,11 +1150,6 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_MAJOR, "Error computing entries");
   // LCOV_EXCL_STOP
-  ierr = CeedVectorRestoreArray(values, &vals); CeedChk(ierr);
-
-  ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
-  CeedChk(ierr);
-  ierr = CeedVectorDestroy(&assembled_qf); CeedChk(ierr);
   ierr = CeedFree(&eval_mode_in); CeedChk(ierr);
   ierr = CeedFree(&eval_mode_out); CeedChk(ierr);
 
@@ -784,20 +1157,140 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
 }
 
 /**
-  @brief Count number of entries for assembled CeedOperator
+  @brief Count the active input and output components of the QFunction of a
+           non-composite CeedOperator, the dimensions of its linearization
 
-  @param[in] op            CeedOperator to assemble
-  @param[out] num_entries  Number of entries in assembled representation
+  @param[in] op               CeedOperator
+  @param[out] num_active_in   Number of active input components
+  @param[out] num_active_out  Number of active output components
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Utility
+  @ref Developer
 **/
-static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op,
-    CeedInt *num_entries) {
+static int CeedOperatorGetNumActiveQFunctionComponents(CeedOperator op,
+    CeedInt *num_active_in, CeedInt *num_active_out) {
   int ierr;
-  CeedElemRestriction rstr;
-  CeedInt num_elem, elem_size, num_comp;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  ierr = CeedQFunctionGetFields(op->qf, NULL, &qf_input_fields, NULL,
+                                &qf_output_fields); CeedChk(ierr);
+
+  *num_active_in = 0;
+  for (CeedInt i = 0; i < op->qf->num_input_fields; i++)
+    if (op->input_fields[i]->vec == CEED_VECTOR_ACTIVE)
+      *num_active_in += qf_input_fields[i]->size;
+  *num_active_out = 0;
+  for (CeedInt i = 0; i < op->qf->num_output_fields; i++)
+    if (op->output_fields[i]->vec == CEED_VECTOR_ACTIVE)
+      *num_active_out += qf_output_fields[i]->size;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the CeedOperator that linearizes the QFunction of a non-composite
+           CeedOperator on a range of elements, the CeedOperator itself or its
+           fallback
+
+  @param[in] op         CeedOperator
+  @param[out] op_elems  CeedOperator implementing
+                          LinearAssembleQFunctionElements, or NULL if neither
+                          the backend nor its fallback resource supports it
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetQFunctionElementsAssembler(CeedOperator op,
+    CeedOperator *op_elems) {
+  int ierr;
+
+  *op_elems = NULL;
+  if (op->LinearAssembleQFunctionElements) {
+    *op_elems = op;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Check for valid fallback resource
+  const char *resource, *fallback_resource;
+  ierr = CeedGetResource(op->ceed, &resource); CeedChk(ierr);
+  ierr = CeedGetOperatorFallbackResource(op->ceed, &fallback_resource);
+  CeedChk(ierr);
+  if (!strcmp(fallback_resource, "") || !strcmp(resource, fallback_resource))
+    return CEED_ERROR_SUCCESS;
+
+  // Fallback to reference Ceed
+  if (!op->op_fallback) {
+    ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+  }
+  ierr = CeedOperatorGetQFunctionElementsAssembler(op->op_fallback, op_elems);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Assemble nonzero entries for non-composite operator
+
+  Users should generally use CeedOperatorLinearAssemble()
+
+  @param[in] op       CeedOperator to assemble
+  @param[out] offset  Offest for number of entries
+  @param[out] values  Values to assemble into matrix
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset,
+                                      CeedVector values) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  if (op->is_composite)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Composite operator not supported");
+  // LCOV_EXCL_STOP
+
+  // Assemble QFunction
+  CeedVector assembled_qf;
+  CeedElemRestriction rstr_q;
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(
+           op, &assembled_qf, &rstr_q, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  CeedInt layout_qf[3], num_elem;
+  ierr = CeedElemRestrictionGetELayout(rstr_q, &layout_qf); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumElements(rstr_q, &num_elem); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_q); CeedChk(ierr);
+
+  // Assemble all elements
+  const CeedScalar *assembled_qf_array;
+  CeedScalar *vals;
+  ierr = CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArray(values, CEED_MEM_HOST, &vals); CeedChk(ierr);
+  ierr = CeedSingleOperatorAssembleElements(op, assembled_qf_array, layout_qf,
+         0, 0, num_elem, &vals[offset]); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(values, &vals); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
+  CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled_qf); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Count number of entries for assembled CeedOperator
+
+  @param[in] op            CeedOperator to assemble
+  @param[out] num_entries  Number of entries in assembled representation
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op,
+    CeedInt *num_entries) {
+  int ierr;
+  CeedElemRestriction rstr;
+  CeedInt num_elem, elem_size, num_comp;
 
   if (op->is_composite)
     // LCOV_EXCL_START
@@ -863,6 +1356,12 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine,
                                   op_fine->input_fields[i]->elem_restr,
                                   op_fine->input_fields[i]->basis,
                                   op_fine->input_fields[i]->vec); CeedChk(ierr);
+      // Compressed quadrature data is shared with the fine grid operator
+      CeedQDataCompressed qdata = op_fine->input_fields[i]->qdata;
+      if (qdata) {
+        (*op_coarse)->input_fields[i]->qdata = qdata;
+        CeedAtomicAdd(qdata->ref_count, 1);
+      }
     }
   }
   // -- Clone output fields
@@ -960,58 +1459,897 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine,
                               CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
   CeedChk(ierr);
 
-  // Cleanup
-  ierr = CeedVectorDestroy(&mult_vec); CeedChk(ierr);
-  ierr = CeedBasisDestroy(&basis_c_to_f); CeedChk(ierr);
-  ierr = CeedQFunctionDestroy(&qf_restrict); CeedChk(ierr);
-  ierr = CeedQFunctionDestroy(&qf_prolong); CeedChk(ierr);
+  // Cleanup
+  ierr = CeedVectorDestroy(&mult_vec); CeedChk(ierr);
+  ierr = CeedBasisDestroy(&basis_c_to_f); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qf_restrict); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qf_prolong); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build 1D mass matrix and Laplacian with perturbation
+
+  @param[in] interp_1d    Interpolation matrix in one dimension
+  @param[in] grad_1d      Gradient matrix in one dimension
+  @param[in] q_weight_1d  Quadrature weights in one dimension
+  @param[in] P_1d         Number of basis nodes in one dimension
+  @param[in] Q_1d         Number of quadrature points in one dimension
+  @param[in] dim          Dimension of basis
+  @param[out] mass        Assembled mass matrix in one dimension
+  @param[out] laplace     Assembled perturbed Laplacian in one dimension
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+CeedPragmaOptimizeOff
+static int CeedBuildMassLaplace(const CeedScalar *interp_1d,
+                                const CeedScalar *grad_1d,
+                                const CeedScalar *q_weight_1d, CeedInt P_1d,
+                                CeedInt Q_1d, CeedInt dim,
+                                CeedScalar *mass, CeedScalar *laplace) {
+
+  for (CeedInt i=0; i<P_1d; i++)
+    for (CeedInt j=0; j<P_1d; j++) {
+      CeedScalar sum = 0.0;
+      for (CeedInt k=0; k<Q_1d; k++)
+        sum += interp_1d[k*P_1d+i]*q_weight_1d[k]*interp_1d[k*P_1d+j];
+      mass[i+j*P_1d] = sum;
+    }
+  // -- Laplacian
+  for (CeedInt i=0; i<P_1d; i++)
+    for (CeedInt j=0; j<P_1d; j++) {
+      CeedScalar sum = 0.0;
+      for (CeedInt k=0; k<Q_1d; k++)
+        sum += grad_1d[k*P_1d+i]*q_weight_1d[k]*grad_1d[k*P_1d+j];
+      laplace[i+j*P_1d] = sum;
+    }
+  CeedScalar perturbation = dim>2 ? 1e-6 : 1e-4;
+  for (CeedInt i=0; i<P_1d; i++)
+    laplace[i+P_1d*i] += perturbation;
+  return CEED_ERROR_SUCCESS;
+}
+CeedPragmaOptimizeOn
+
+/**
+  @brief Get the active field of a non-composite operator for fast
+           diagonalization method based inverses
+
+  @param[in] op       CeedOperator
+  @param[out] basis   Active CeedBasis
+  @param[out] rstr    Active CeedElemRestriction
+  @param[out] interp  Boolean flag indicating an active interpolated input
+  @param[out] grad    Boolean flag indicating an active gradient input
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetFDMActiveField(CeedOperator op, CeedBasis *basis,
+    CeedElemRestriction *rstr, bool *interp, bool *grad) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+
+  // Determine active input basis
+  *interp = false; *grad = false;
+  *basis = NULL;
+  *rstr = NULL;
+  CeedOperatorField *op_fields;
+  CeedQFunctionField *qf_fields;
+  CeedInt num_input_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_fields, NULL, NULL);
+  CeedChk(ierr);
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_fields, NULL, NULL); CeedChk(ierr);
+  for (CeedInt i=0; i<num_input_fields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(op_fields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedEvalMode eval_mode;
+      ierr = CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode); CeedChk(ierr);
+      *interp = *interp || eval_mode == CEED_EVAL_INTERP;
+      *grad = *grad || eval_mode == CEED_EVAL_GRAD;
+      ierr = CeedOperatorFieldGetBasis(op_fields[i], basis); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(op_fields[i], rstr); CeedChk(ierr);
+    }
+  }
+  if (!*basis)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "No active field set");
+  // LCOV_EXCL_STOP
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the average of the assembled QFunction in each element for
+           fast diagonalization method based inverses
+
+  @param[in] op         CeedOperator
+  @param[in] basis      Active CeedBasis
+  @param[in] interp     Boolean flag indicating an active interpolated input
+  @param[in] grad       Boolean flag indicating an active gradient input
+  @param[in] num_elem   Number of elements
+  @param[out] elem_avg  Array of size num_elem holding the element averages
+  @param request        Address of CeedRequest for non-blocking completion, else
+                          @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetFDMElemAvg(CeedOperator op, CeedBasis basis,
+                                     bool interp, bool grad, CeedInt num_elem,
+                                     CeedScalar **elem_avg,
+                                     CeedRequest *request) {
+  int ierr;
+  Ceed ceed, ceed_parent;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceed_parent); CeedChk(ierr);
+  ceed_parent = ceed_parent ? ceed_parent : ceed;
+  CeedInt num_qpts, dim, num_comp;
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &num_qpts); CeedChk(ierr);
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChk(ierr);
+
+  // Assemble QFunction
+  CeedVector assembled;
+  CeedElemRestriction rstr_qf;
+  ierr =  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled,
+          &rstr_qf, request); CeedChk(ierr);
+  CeedInt layout[3];
+  ierr = CeedElemRestrictionGetELayout(rstr_qf, &layout); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_qf); CeedChk(ierr);
+  CeedScalar max_norm = 0;
+  ierr = CeedVectorNorm(assembled, CEED_NORM_MAX, &max_norm); CeedChk(ierr);
+
+  // Calculate element averages
+  CeedInt num_modes = (interp?1:0) + (grad?dim:0);
+  const CeedScalar *assembled_array, *q_weight_array;
+  CeedVector q_weight;
+  ierr = CeedVectorCreate(ceed_parent, num_qpts, &q_weight); CeedChk(ierr);
+  ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+                        CEED_VECTOR_NONE, q_weight); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array);
+  CeedChk(ierr);
+  ierr = CeedCalloc(num_elem, elem_avg); CeedChk(ierr);
+  const CeedScalar qf_value_bound = max_norm*100*CEED_EPSILON;
+  for (CeedInt e=0; e<num_elem; e++) {
+    CeedInt count = 0;
+    for (CeedInt q=0; q<num_qpts; q++)
+      for (CeedInt i=0; i<num_comp*num_comp*num_modes*num_modes; i++)
+        if (fabs(assembled_array[q*layout[0] + i*layout[1] + e*layout[2]]) >
+            qf_value_bound) {
+          (*elem_avg)[e] += assembled_array[q*layout[0] + i*layout[1] + e*layout[2]] /
+                            q_weight_array[q];
+          count++;
+        }
+    if (count) {
+      (*elem_avg)[e] /= count;
+    } else {
+      (*elem_avg)[e] = 1.0;
+    }
+  }
+  ierr = CeedVectorRestoreArrayRead(assembled, &assembled_array); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(q_weight, &q_weight_array); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&q_weight); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the reference coordinates of the nodes of a 1D basis
+
+  The coordinates are the L^2 projection of the linear function onto the
+    basis, which reproduces the node locations of a Lagrange basis.
+
+  @param[in] interp_1d    Interpolation matrix in one dimension
+  @param[in] q_ref_1d     Quadrature points in one dimension
+  @param[in] q_weight_1d  Quadrature weights in one dimension
+  @param[in] P_1d         Number of basis nodes in one dimension
+  @param[in] Q_1d         Number of quadrature points in one dimension
+  @param[out] x_node      Reference coordinate of each node
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBuildNodeCoordinates1D(const CeedScalar *interp_1d,
+                                      const CeedScalar *q_ref_1d,
+                                      const CeedScalar *q_weight_1d,
+                                      CeedInt P_1d, CeedInt Q_1d,
+                                      CeedScalar *x_node) {
+  int ierr;
+  CeedScalar *mass;
+  ierr = CeedCalloc(P_1d*P_1d, &mass); CeedChk(ierr);
+  for (CeedInt i=0; i<P_1d; i++) {
+    x_node[i] = 0.0;
+    for (CeedInt k=0; k<Q_1d; k++) {
+      x_node[i] += interp_1d[k*P_1d+i]*q_weight_1d[k]*q_ref_1d[k];
+      for (CeedInt j=0; j<P_1d; j++)
+        mass[i*P_1d+j] += interp_1d[k*P_1d+i]*q_weight_1d[k]*interp_1d[k*P_1d+j];
+    }
+  }
+
+  // Solve with Gaussian elimination, the mass matrix is SPD
+  for (CeedInt k=0; k<P_1d; k++)
+    for (CeedInt i=k+1; i<P_1d; i++) {
+      const CeedScalar factor = mass[i*P_1d+k] / mass[k*P_1d+k];
+      for (CeedInt j=k; j<P_1d; j++)
+        mass[i*P_1d+j] -= factor*mass[k*P_1d+j];
+      x_node[i] -= factor*x_node[k];
+    }
+  for (CeedInt i=P_1d-1; i>=0; i--) {
+    for (CeedInt j=i+1; j<P_1d; j++)
+      x_node[i] -= mass[i*P_1d+j]*x_node[j];
+    x_node[i] /= mass[i*P_1d+i];
+  }
+  ierr = CeedFree(&mass); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build the fast diagonalization of a 1D vertex patch
+
+  The patch consists of the element to the left of the vertex, the element to
+    the right of the vertex, or both. Nodes on the far side of each element
+    carry homogeneous Dirichlet conditions and are removed. The interpolation
+    matrix applies the partition of unity weight of the vertex hat function,
+    split symmetrically between the input and output.
+
+  @param ceed             A Ceed context for error handling
+  @param[in] mass         1D element mass matrix
+  @param[in] laplace      1D element Laplacian
+  @param[in] x_node       Reference coordinate of each element node
+  @param[in] P_1d         Number of element nodes in one dimension
+  @param[in] patch_type   0 for both elements, 1 for left element only, 2 for
+                            right element only
+  @param[out] n           Number of patch nodes
+  @param[out] fdm_interp  Row-major n x n matrix mapping nodes to modes
+  @param[out] lambda      Generalized eigenvalue for each mode
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBuildPatchFDM1D(Ceed ceed, const CeedScalar *mass,
+                               const CeedScalar *laplace,
+                               const CeedScalar *x_node, CeedInt P_1d,
+                               CeedInt patch_type, CeedInt *n,
+                               CeedScalar *fdm_interp, CeedScalar *lambda) {
+  int ierr;
+  const CeedInt num_cells = patch_type ? 1 : 2,
+                box_size = num_cells*(P_1d - 1) + 1,
+                g_lo = patch_type == 2 ? 0 : 1,
+                g_hi = patch_type == 1 ? P_1d - 1 : box_size - 2;
+  *n = g_hi - g_lo + 1;
+
+  // Assemble patch matrices and hat function weights
+  CeedScalar *box_mass, *box_laplace, *weight;
+  ierr = CeedCalloc(box_size*box_size, &box_mass); CeedChk(ierr);
+  ierr = CeedCalloc(box_size*box_size, &box_laplace); CeedChk(ierr);
+  ierr = CeedCalloc(box_size, &weight); CeedChk(ierr);
+  for (CeedInt cell=0; cell<num_cells; cell++) {
+    // Element to the right of the vertex, hat function decreasing
+    const bool is_right = patch_type == 2 || cell == 1;
+    const CeedInt offset = cell*(P_1d - 1);
+    for (CeedInt i=0; i<P_1d; i++) {
+      weight[offset+i] = is_right ? (1.0 - x_node[i]) / 2 : (1.0 + x_node[i]) / 2;
+      for (CeedInt j=0; j<P_1d; j++) {
+        box_mass[(offset+i)*box_size + offset+j] += mass[i*P_1d+j];
+        box_laplace[(offset+i)*box_size + offset+j] += laplace[i*P_1d+j];
+      }
+    }
+  }
+
+  // Remove Dirichlet nodes and diagonalize
+  CeedScalar *patch_mass, *patch_laplace, *x;
+  ierr = CeedCalloc((*n)*(*n), &patch_mass); CeedChk(ierr);
+  ierr = CeedCalloc((*n)*(*n), &patch_laplace); CeedChk(ierr);
+  ierr = CeedCalloc((*n)*(*n), &x); CeedChk(ierr);
+  for (CeedInt i=0; i<*n; i++)
+    for (CeedInt j=0; j<*n; j++) {
+      patch_mass[i*(*n)+j] = box_mass[(g_lo+i)*box_size + g_lo+j];
+      patch_laplace[i*(*n)+j] = box_laplace[(g_lo+i)*box_size + g_lo+j];
+    }
+  ierr = CeedSimultaneousDiagonalization(ceed, patch_laplace, patch_mass, x,
+                                         lambda, *n); CeedChk(ierr);
+  for (CeedInt i=0; i<*n; i++)
+    for (CeedInt j=0; j<*n; j++)
+      fdm_interp[i+j*(*n)] = x[j+i*(*n)] * sqrt(fabs(weight[g_lo+i]));
+
+  ierr = CeedFree(&box_mass); CeedChk(ierr);
+  ierr = CeedFree(&box_laplace); CeedChk(ierr);
+  ierr = CeedFree(&weight); CeedChk(ierr);
+  ierr = CeedFree(&patch_mass); CeedChk(ierr);
+  ierr = CeedFree(&patch_laplace); CeedChk(ierr);
+  ierr = CeedFree(&x); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build the vertex star patches of a mesh of tensor product elements
+
+  Each vertex star is arranged as a tensor product box of the elements
+    sharing the vertex; this requires conforming elements with aligned local
+    coordinate directions. Patch nodes are ordered with the first dimension
+    fastest and nodes on the far side of the star are excluded.
+
+  @param ceed                A Ceed context for error handling
+  @param[in] dim             Topological dimension
+  @param[in] P_1d            Number of element nodes in one dimension
+  @param[in] num_elem        Number of elements
+  @param[in] elem_dof        L-vector index of the first component of each
+                               element node
+  @param[in] elem_avg        Average QFunction value of each element
+  @param[out] num_patches    Number of patches
+  @param[out] patch_types    Array of size num_patches * dim holding the 1D
+                               patch type in each dimension, see
+                               CeedBuildPatchFDM1D()
+  @param[out] patch_offsets  Array of size num_patches * (2 P_1d - 3)^dim
+                               holding the L-vector index of each patch node
+  @param[out] patch_avg      Array of size num_patches holding the average
+                               QFunction value of each patch
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBuildVertexPatches(Ceed ceed, CeedInt dim, CeedInt P_1d,
+                                  CeedInt num_elem, const CeedInt *elem_dof,
+                                  const CeedScalar *elem_avg,
+                                  CeedInt *num_patches, CeedInt **patch_types,
+                                  CeedInt **patch_offsets,
+                                  CeedScalar **patch_avg) {
+  int ierr;
+  const CeedInt num_corners = 1 << dim, elem_size = CeedIntPow(P_1d, dim),
+                max_patch_size = CeedIntPow(2*P_1d - 3, dim);
+  CeedInt corner_nodes[8];
+  for (CeedInt v=0; v<num_corners; v++) {
+    corner_nodes[v] = 0;
+    for (CeedInt d=0; d<dim; d++)
+      corner_nodes[v] += ((v >> d) & 1)*(P_1d - 1)*CeedIntPow(P_1d, d);
+  }
+
+  // Group element corners by vertex
+  CeedInt num_vertex_dofs = 0;
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt v=0; v<num_corners; v++) {
+      const CeedInt dof = elem_dof[e*elem_size + corner_nodes[v]];
+      num_vertex_dofs = dof >= num_vertex_dofs ? dof + 1 : num_vertex_dofs;
+    }
+  CeedInt *star_ptr, *star_corners;
+  ierr = CeedCalloc(num_vertex_dofs + 1, &star_ptr); CeedChk(ierr);
+  ierr = CeedCalloc(num_elem*num_corners, &star_corners); CeedChk(ierr);
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt v=0; v<num_corners; v++)
+      star_ptr[elem_dof[e*elem_size + corner_nodes[v]] + 1]++;
+  *num_patches = 0;
+  for (CeedInt i=0; i<num_vertex_dofs; i++) {
+    *num_patches += star_ptr[i+1] > 0;
+    star_ptr[i+1] += star_ptr[i];
+  }
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt v=0; v<num_corners; v++) {
+      const CeedInt dof = elem_dof[e*elem_size + corner_nodes[v]];
+      star_corners[star_ptr[dof]++] = e*num_corners + v;
+    }
+  for (CeedInt i=num_vertex_dofs; i>0; i--)
+    star_ptr[i] = star_ptr[i-1];
+  star_ptr[0] = 0;
+
+  // Build patches
+  ierr = CeedCalloc(*num_patches*dim, patch_types); CeedChk(ierr);
+  ierr = CeedMalloc(*num_patches*max_patch_size, patch_offsets); CeedChk(ierr);
+  ierr = CeedCalloc(*num_patches, patch_avg); CeedChk(ierr);
+  CeedInt p = 0;
+  for (CeedInt i=0; i<num_vertex_dofs; i++) {
+    if (star_ptr[i+1] == star_ptr[i]) continue;
+    CeedInt *types = &(*patch_types)[p*dim],
+             *offsets = &(*patch_offsets)[p*max_patch_size];
+
+    // -- Patch extent; corner bit d set means the element is left of the vertex
+    bool has_left[3] = {false, false, false}, has_right[3] = {false, false, false};
+    for (CeedInt k=star_ptr[i]; k<star_ptr[i+1]; k++) {
+      const CeedInt v = star_corners[k] % num_corners;
+      for (CeedInt d=0; d<dim; d++) {
+        has_left[d] = has_left[d] || ((v >> d) & 1);
+        has_right[d] = has_right[d] || !((v >> d) & 1);
+      }
+    }
+    CeedInt g_lo[3], n[3], patch_size = 1;
+    for (CeedInt d=0; d<dim; d++) {
+      types[d] = has_left[d] && has_right[d] ? 0 : (has_left[d] ? 1 : 2);
+      g_lo[d] = has_left[d] ? 1 : 0;
+      n[d] = types[d] ? P_1d - 1 : 2*P_1d - 3;
+      patch_size *= n[d];
+    }
+
+    // -- Patch node indices
+    for (CeedInt j=0; j<max_patch_size; j++)
+      offsets[j] = -1;
+    for (CeedInt k=star_ptr[i]; k<star_ptr[i+1]; k++) {
+      const CeedInt e = star_corners[k] / num_corners,
+                    v = star_corners[k] % num_corners;
+      (*patch_avg)[p] += elem_avg[e] / (star_ptr[i+1] - star_ptr[i]);
+      for (CeedInt node=0; node<elem_size; node++) {
+        CeedInt index = 0, stride = 1;
+        bool in_patch = true;
+        for (CeedInt d=0; d<dim; d++) {
+          const CeedInt g = (node / CeedIntPow(P_1d, d)) % P_1d +
+                            ((v >> d) & 1 || !has_left[d] ? 0 : P_1d - 1);
+          in_patch = in_patch && g >= g_lo[d] && g < g_lo[d] + n[d];
+          index += (g - g_lo[d])*stride;
+          stride *= n[d];
+        }
+        if (!in_patch) continue;
+        const CeedInt dof = elem_dof[e*elem_size + node];
+        if (offsets[index] >= 0 && offsets[index] != dof)
+          // LCOV_EXCL_START
+          return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                           "Vertex patches require conforming elements with "
+                           "aligned local coordinates");
+        // LCOV_EXCL_STOP
+        offsets[index] = dof;
+      }
+    }
+    for (CeedInt j=0; j<patch_size; j++)
+      if (offsets[j] < 0)
+        // LCOV_EXCL_START
+        return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                         "Vertex star does not form a tensor product patch");
+    // LCOV_EXCL_STOP
+    p++;
+  }
+  ierr = CeedFree(&star_ptr); CeedChk(ierr);
+  ierr = CeedFree(&star_corners); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the active basis and restriction of a non-composite operator for
+           low-order-refined assembly
+
+  @param[in] op         CeedOperator to assemble
+  @param[out] basis     Active CeedBasis
+  @param[out] rstr      Active CeedElemRestriction
+  @param[out] dim       Topological dimension of the active basis
+  @param[out] P_1d      Number of nodes in one dimension of the active basis
+  @param[out] num_comp  Number of field components
+  @param[out] num_elem  Number of high-order elements
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorGetLORData(CeedOperator op, CeedBasis *basis,
+                                        CeedElemRestriction *rstr, CeedInt *dim,
+                                        CeedInt *P_1d, CeedInt *num_comp,
+                                        CeedInt *num_elem) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  if (op->is_composite)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Composite operator not supported");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedOperatorGetActiveBasis(op, basis); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveElemRestriction(op, rstr); CeedChk(ierr);
+  bool is_tensor;
+  ierr = CeedBasisIsTensor(*basis, &is_tensor); CeedChk(ierr);
+  if (!is_tensor)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "LOR assembly only supported for tensor bases");
+  // LCOV_EXCL_STOP
+  ierr = CeedBasisGetDimension(*basis, dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes1D(*basis, P_1d); CeedChk(ierr);
+  if (*P_1d < 2)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "LOR assembly requires at least 2 nodes per dimension");
+  // LCOV_EXCL_STOP
+  ierr = CeedElemRestrictionGetNumComponents(*rstr, num_comp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumElements(*rstr, num_elem); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Determine the high-order element node of each vertex of each Q1
+           sub-element
+
+  Sub-element k with multi-index (k_0, ..., k_{dim-1}) spans the nodes
+    k_d and k_d + 1 in each dimension d; vertex v selects k_d + ((v >> d) & 1).
+
+  @param[in] dim         Topological dimension
+  @param[in] P_1d        Number of nodes in one dimension
+  @param[out] sub_nodes  Array of size (P_1d - 1)^dim * 2^dim holding the
+                           element node for each sub-element vertex
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBuildLORSubElementNodes(CeedInt dim, CeedInt P_1d,
+                                       CeedInt *sub_nodes) {
+  CeedInt num_sub = 1, num_vert = 1 << dim;
+  for (CeedInt d=0; d<dim; d++)
+    num_sub *= P_1d - 1;
+
+  for (CeedInt k=0; k<num_sub; k++)
+    for (CeedInt v=0; v<num_vert; v++) {
+      CeedInt node = 0, sub_stride = 1, node_stride = 1;
+      for (CeedInt d=0; d<dim; d++) {
+        node += ((k / sub_stride) % (P_1d - 1) + ((v >> d) & 1)) * node_stride;
+        sub_stride *= P_1d - 1;
+        node_stride *= P_1d;
+      }
+      sub_nodes[k*num_vert + v] = node;
+    }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Count the Q1 sub-elements in low-order-refined assembly of a
+           non-composite CeedOperator
+
+  @param[in] op             CeedOperator to assemble
+  @param[out] num_sub_elem  Number of sub-elements
+  @param[out] sub_elem_size Number of L-vector nodes of each sub-element,
+                              counting each component separately
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorLORCountSubElements(CeedOperator op,
+    CeedInt *num_sub_elem, CeedInt *sub_elem_size) {
+  int ierr;
+  CeedBasis basis;
+  CeedElemRestriction rstr;
+  CeedInt dim, P_1d, num_comp, num_elem;
+  ierr = CeedSingleOperatorGetLORData(op, &basis, &rstr, &dim, &P_1d,
+                                      &num_comp, &num_elem); CeedChk(ierr);
+
+  CeedInt num_sub = 1;
+  for (CeedInt d=0; d<dim; d++)
+    num_sub *= P_1d - 1;
+  *num_sub_elem = num_sub * num_elem;
+  *sub_elem_size = (1 << dim) * num_comp;
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Determine the L-vector nodes of each Q1 sub-element in
+           low-order-refined assembly of a non-composite operator
+
+  Users should generally use CeedOperatorLinearAssembleLORSymbolic()
+
+  @param[in] op         CeedOperator to assemble nonzero pattern
+  @param[out] sub_dofs  L-vector node for each component of each vertex of
+                          each sub-element, [elem][sub][comp][vert]
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorLORSubElementDofs(CeedOperator op,
+    CeedInt *sub_dofs) {
+  int ierr;
+  CeedBasis basis;
+  CeedElemRestriction rstr;
+  CeedInt dim, P_1d, num_comp, num_elem;
+  ierr = CeedSingleOperatorGetLORData(op, &basis, &rstr, &dim, &P_1d,
+                                      &num_comp, &num_elem); CeedChk(ierr);
+  CeedInt layout_er[3];
+  ierr = CeedElemRestrictionGetELayout(rstr, &layout_er); CeedChk(ierr);
+
+  CeedInt num_sub = 1, num_vert = 1 << dim;
+  for (CeedInt d=0; d<dim; d++)
+    num_sub *= P_1d - 1;
+  CeedInt *sub_nodes;
+  ierr = CeedMalloc(num_sub*num_vert, &sub_nodes); CeedChk(ierr);
+  ierr = CeedBuildLORSubElementNodes(dim, P_1d, sub_nodes); CeedChk(ierr);
+
+  // Determine elem_dof relation
+  CeedVector elem_dof;
+  ierr = CeedElemRestrictionGetElemDof(rstr, &elem_dof); CeedChk(ierr);
+  const CeedScalar *elem_dof_a;
+  ierr = CeedVectorGetArrayRead(elem_dof, CEED_MEM_HOST, &elem_dof_a);
+  CeedChk(ierr);
+
+  // Determine L-vector nodes of sub-element vertices
+  CeedInt count = 0;
+  for (CeedInt e = 0; e < num_elem; ++e)
+    for (CeedInt k = 0; k < num_sub; ++k)
+      for (CeedInt comp = 0; comp < num_comp; ++comp)
+        for (CeedInt i = 0; i < num_vert; ++i) {
+          const CeedInt node = sub_nodes[k*num_vert + i];
+          sub_dofs[count++] = elem_dof_a[node*layout_er[0] +
+                                         comp*layout_er[1] + e*layout_er[2]];
+        }
+
+  ierr = CeedVectorRestoreArrayRead(elem_dof, &elem_dof_a); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&elem_dof); CeedChk(ierr);
+  ierr = CeedFree(&sub_nodes); CeedChk(ierr);
+
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief Build 1D mass matrix and Laplacian with perturbation
+  @brief Assemble low-order-refined nonzero entries of a non-composite
+           operator into a CSR matrix
 
-  @param[in] interp_1d    Interpolation matrix in one dimension
-  @param[in] grad_1d      Gradient matrix in one dimension
-  @param[in] q_weight_1d  Quadrature weights in one dimension
-  @param[in] P_1d         Number of basis nodes in one dimension
-  @param[in] Q_1d         Number of quadrature points in one dimension
-  @param[in] dim          Dimension of basis
-  @param[out] mass        Assembled mass matrix in one dimension
-  @param[out] laplace     Assembled perturbed Laplacian in one dimension
+  The pointwise QFunction data is divided by the high-order quadrature weights,
+    interpolated to a 2 point Gauss rule on each Q1 sub-element of the
+    Gauss-Lobatto sub-mesh, and integrated against the sub-element basis. The
+    operator geometry is therefore reused without evaluating the QFunction
+    again.
+
+  Users should generally use CeedOperatorLinearAssembleLOR()
+
+  @param[in] op       CeedOperator to assemble
+  @param[in] row_ptr  CSR row offsets from CeedOperatorLinearAssembleLORSymbolic()
+  @param[in] col_ind  CSR column indices from CeedOperatorLinearAssembleLORSymbolic()
+  @param[out] vals    CSR values to add sub-element contributions to
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-CeedPragmaOptimizeOff
-static int CeedBuildMassLaplace(const CeedScalar *interp_1d,
-                                const CeedScalar *grad_1d,
-                                const CeedScalar *q_weight_1d, CeedInt P_1d,
-                                CeedInt Q_1d, CeedInt dim,
-                                CeedScalar *mass, CeedScalar *laplace) {
+static int CeedSingleOperatorLORAssemble(CeedOperator op,
+    const CeedInt *row_ptr, const CeedInt *col_ind, CeedScalar *vals) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  CeedBasis basis;
+  CeedElemRestriction rstr;
+  CeedInt dim, P_1d, num_comp, num_elem;
+  ierr = CeedSingleOperatorGetLORData(op, &basis, &rstr, &dim, &P_1d,
+                                      &num_comp, &num_elem); CeedChk(ierr);
 
-  for (CeedInt i=0; i<P_1d; i++)
-    for (CeedInt j=0; j<P_1d; j++) {
-      CeedScalar sum = 0.0;
-      for (CeedInt k=0; k<Q_1d; k++)
-        sum += interp_1d[k*P_1d+i]*q_weight_1d[k]*interp_1d[k*P_1d+j];
-      mass[i+j*P_1d] = sum;
+  // Determine active eval modes
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt num_input_fields, num_output_fields;
+  CeedOperatorField *input_fields, *output_fields;
+  ierr = CeedOperatorGetFields(op, &num_input_fields, &input_fields,
+                               &num_output_fields, &output_fields); CeedChk(ierr);
+  CeedQFunctionField *qf_fields_in, *qf_fields_out;
+  ierr = CeedQFunctionGetFields(qf, NULL, &qf_fields_in, NULL, &qf_fields_out);
+  CeedChk(ierr);
+  CeedInt num_eval_mode_in = 0, num_eval_mode_out = 0;
+  CeedEvalMode eval_mode_in[dim + 1], eval_mode_out[dim + 1];
+  for (CeedInt f=0; f<num_input_fields + num_output_fields; f++) {
+    bool is_input = f < num_input_fields;
+    CeedOperatorField op_field = is_input ? input_fields[f] :
+                                 output_fields[f - num_input_fields];
+    CeedQFunctionField qf_field = is_input ? qf_fields_in[f] :
+                                  qf_fields_out[f - num_input_fields];
+    CeedEvalMode *eval_modes = is_input ? eval_mode_in : eval_mode_out;
+    CeedInt *num_eval_modes = is_input ? &num_eval_mode_in : &num_eval_mode_out;
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(op_field, &vec); CeedChk(ierr);
+    if (vec != CEED_VECTOR_ACTIVE)
+      continue;
+    CeedEvalMode eval_mode;
+    ierr = CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode); CeedChk(ierr);
+    switch (eval_mode) {
+    case CEED_EVAL_INTERP:
+      eval_modes[(*num_eval_modes)++] = eval_mode;
+      break;
+    case CEED_EVAL_GRAD:
+      for (CeedInt d=0; d<dim; d++)
+        eval_modes[(*num_eval_modes)++] = eval_mode;
+      break;
+    case CEED_EVAL_NONE:
+    case CEED_EVAL_WEIGHT:
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL:
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                       "LOR assembly only supports active fields with "
+                       "CEED_EVAL_INTERP and CEED_EVAL_GRAD");
+      // LCOV_EXCL_STOP
     }
-  // -- Laplacian
-  for (CeedInt i=0; i<P_1d; i++)
-    for (CeedInt j=0; j<P_1d; j++) {
-      CeedScalar sum = 0.0;
-      for (CeedInt k=0; k<Q_1d; k++)
-        sum += grad_1d[k*P_1d+i]*q_weight_1d[k]*grad_1d[k*P_1d+j];
-      laplace[i+j*P_1d] = sum;
+  }
+  if (num_eval_mode_in == 0 || num_eval_mode_out == 0)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Cannot assemble operator without inputs/outputs");
+  // LCOV_EXCL_STOP
+
+  // Assemble QFunction
+  CeedVector assembled_qf;
+  CeedElemRestriction rstr_q;
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(
+           op, &assembled_qf, &rstr_q, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  CeedInt layout_qf[3];
+  ierr = CeedElemRestrictionGetELayout(rstr_q, &layout_qf); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_q); CeedChk(ierr);
+
+  // Gauss-Lobatto sub-mesh and sub-element quadrature
+  CeedInt Q_1d, num_qpts = 1, num_fine = 1, num_sub = 1, num_vert = 1 << dim;
+  const CeedInt Q_fine = 2*(P_1d - 1);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d); CeedChk(ierr);
+  for (CeedInt d=0; d<dim; d++) {
+    num_qpts *= Q_1d;
+    num_fine *= Q_fine;
+    num_sub *= P_1d - 1;
+  }
+  const CeedScalar *q_ref_1d, *q_weight_1d;
+  ierr = CeedBasisGetQRef(basis, &q_ref_1d); CeedChk(ierr);
+  ierr = CeedBasisGetQWeights(basis, &q_weight_1d); CeedChk(ierr);
+  CeedScalar *x_gll, *x_fine, *interp_fine, *q_weight;
+  ierr = CeedCalloc(P_1d, &x_gll); CeedChk(ierr);
+  ierr = CeedCalloc(Q_fine, &x_fine); CeedChk(ierr);
+  ierr = CeedCalloc(Q_fine*Q_1d, &interp_fine); CeedChk(ierr);
+  ierr = CeedCalloc(num_qpts, &q_weight); CeedChk(ierr);
+  ierr = CeedLobattoQuadrature(P_1d, x_gll, NULL); CeedChk(ierr);
+  const CeedScalar gauss_pt = 1.0 / sqrt(3.0);
+  for (CeedInt k=0; k<P_1d-1; k++) {
+    const CeedScalar mid = (x_gll[k+1] + x_gll[k]) / 2;
+    const CeedScalar half = (x_gll[k+1] - x_gll[k]) / 2;
+    x_fine[2*k+0] = mid - half*gauss_pt;
+    x_fine[2*k+1] = mid + half*gauss_pt;
+  }
+  // -- Lagrange interpolation from high-order to sub-element quadrature points
+  for (CeedInt m=0; m<Q_fine; m++)
+    for (CeedInt i=0; i<Q_1d; i++) {
+      CeedScalar l = 1.0;
+      for (CeedInt j=0; j<Q_1d; j++)
+        if (j != i)
+          l *= (x_fine[m] - q_ref_1d[j]) / (q_ref_1d[i] - q_ref_1d[j]);
+      interp_fine[m*Q_1d + i] = l;
     }
-  CeedScalar perturbation = dim>2 ? 1e-6 : 1e-4;
-  for (CeedInt i=0; i<P_1d; i++)
-    laplace[i+P_1d*i] += perturbation;
+  for (CeedInt q=0; q<num_qpts; q++) {
+    q_weight[q] = 1.0;
+    for (CeedInt d=0, stride=1; d<dim; d++, stride*=Q_1d)
+      q_weight[q] *= q_weight_1d[(q / stride) % Q_1d];
+  }
+
+  CeedInt *sub_nodes;
+  ierr = CeedMalloc(num_sub*num_vert, &sub_nodes); CeedChk(ierr);
+  ierr = CeedBuildLORSubElementNodes(dim, P_1d, sub_nodes); CeedChk(ierr);
+
+  // Determine elem_dof relation
+  CeedVector elem_dof;
+  ierr = CeedElemRestrictionGetElemDof(rstr, &elem_dof); CeedChk(ierr);
+  const CeedScalar *elem_dof_a, *assembled_qf_array;
+  CeedInt layout_er[3];
+  ierr = CeedElemRestrictionGetELayout(rstr, &layout_er); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(elem_dof, CEED_MEM_HOST, &elem_dof_a);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST,
+                                &assembled_qf_array); CeedChk(ierr);
+
+  // Loop over elements and sub-elements
+  const CeedInt num_qf_comp = num_eval_mode_in*num_comp*num_eval_mode_out*
+                              num_comp;
+  const CeedInt buffer_size = num_fine > num_qpts ? num_fine : num_qpts;
+  CeedScalar *D_ho, *D_fine, *buffer;
+  ierr = CeedCalloc(num_qpts, &D_ho); CeedChk(ierr);
+  ierr = CeedCalloc(num_qf_comp*num_fine, &D_fine); CeedChk(ierr);
+  ierr = CeedCalloc(buffer_size, &buffer); CeedChk(ierr);
+  CeedScalar B_in[num_vert][num_eval_mode_in][num_vert],
+             B_out[num_vert][num_eval_mode_out][num_vert],
+             elem_mat[num_vert*num_vert];
+  for (CeedInt e=0; e<num_elem; e++) {
+    // -- Pointwise QFunction data at the sub-element quadrature points
+    for (CeedInt c=0; c<num_qf_comp; c++) {
+      for (CeedInt q=0; q<num_qpts; q++)
+        D_ho[q] = assembled_qf_array[q*layout_qf[0] + c*layout_qf[1] +
+                                     e*layout_qf[2]] / q_weight[q];
+      ierr = CeedTensorContractHost(dim, Q_1d, Q_fine, interp_fine, D_ho,
+                                    &D_fine[c*num_fine], buffer); CeedChk(ierr);
+    }
+
+    for (CeedInt k=0; k<num_sub; k++) {
+      // -- Sub-element basis and quadrature in element reference coordinates
+      CeedInt k_1d[dim], fine_pt[num_vert];
+      CeedScalar h[dim], weight = 1.0;
+      for (CeedInt d=0, stride=1; d<dim; d++, stride*=P_1d-1) {
+        k_1d[d] = (k / stride) % (P_1d - 1);
+        h[d] = x_gll[k_1d[d]+1] - x_gll[k_1d[d]];
+        weight *= h[d] / 2;
+      }
+      for (CeedInt g=0; g<num_vert; g++) {
+        fine_pt[g] = 0;
+        for (CeedInt d=0, stride=1; d<dim; d++, stride*=Q_fine)
+          fine_pt[g] += (2*k_1d[d] + ((g >> d) & 1)) * stride;
+        for (CeedInt v=0; v<num_vert; v++) {
+          CeedScalar interp = 1.0, grad[dim];
+          for (CeedInt d=0; d<dim; d++) {
+            const CeedScalar sign_v = ((v >> d) & 1) ? 1.0 : -1.0;
+            const CeedScalar sign_g = ((g >> d) & 1) ? 1.0 : -1.0;
+            const CeedScalar phi = (1.0 + sign_v*sign_g*gauss_pt) / 2;
+            for (CeedInt dd=0; dd<d; dd++)
+              grad[dd] *= phi;
+            grad[d] = interp * sign_v / h[d];
+            interp *= phi;
+          }
+          for (CeedInt ei=0, d_in=0; ei<num_eval_mode_in; ei++)
+            B_in[g][ei][v] = eval_mode_in[ei] == CEED_EVAL_INTERP ? interp :
+                             grad[d_in++];
+          for (CeedInt eo=0, d_out=0; eo<num_eval_mode_out; eo++)
+            B_out[g][eo][v] = eval_mode_out[eo] == CEED_EVAL_INTERP ? interp :
+                              grad[d_out++];
+        }
+      }
+
+      for (CeedInt comp_in=0; comp_in<num_comp; comp_in++)
+        for (CeedInt comp_out=0; comp_out<num_comp; comp_out++) {
+          // -- Sub-element matrix
+          for (CeedInt i=0; i<num_vert*num_vert; i++)
+            elem_mat[i] = 0.0;
+          for (CeedInt g=0; g<num_vert; g++)
+            for (CeedInt ei=0; ei<num_eval_mode_in; ei++)
+              for (CeedInt eo=0; eo<num_eval_mode_out; eo++) {
+                const CeedInt c = ((ei*num_comp + comp_in)*num_eval_mode_out +
+                                   eo)*num_comp + comp_out;
+                const CeedScalar D = weight * D_fine[c*num_fine + fine_pt[g]];
+                for (CeedInt i=0; i<num_vert; i++)
+                  for (CeedInt j=0; j<num_vert; j++)
+                    elem_mat[i*num_vert + j] += B_out[g][eo][i] * D *
+                                                B_in[g][ei][j];
+              }
+
+          // -- Add into CSR structure
+          for (CeedInt i=0; i<num_vert; i++) {
+            const CeedInt row = elem_dof_a[sub_nodes[k*num_vert + i]*layout_er[0] +
+                                           comp_out*layout_er[1] + e*layout_er[2]];
+            for (CeedInt j=0; j<num_vert; j++) {
+              const CeedInt col = elem_dof_a[sub_nodes[k*num_vert + j]*
+                                             layout_er[0] + comp_in*layout_er[1] +
+                                             e*layout_er[2]];
+              CeedInt lo = row_ptr[row], hi = row_ptr[row+1];
+              while (lo < hi) {
+                const CeedInt mid = (lo + hi) / 2;
+                if (col_ind[mid] < col) lo = mid + 1;
+                else hi = mid;
+              }
+              if (lo == row_ptr[row+1] || col_ind[lo] != col)
+                // LCOV_EXCL_START
+                return CeedError(ceed, CEED_ERROR_MAJOR,
+                                 "Entry (%d, %d) not in CSR nonzero pattern",
+                                 row, col);
+              // LCOV_EXCL_STOP
+              vals[lo] += elem_mat[i*num_vert + j];
+            }
+          }
+        }
+    }
+  }
+
+  // Cleanup
+  ierr = CeedVectorRestoreArrayRead(elem_dof, &elem_dof_a); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&elem_dof); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
+  CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled_qf); CeedChk(ierr);
+  ierr = CeedFree(&x_gll); CeedChk(ierr);
+  ierr = CeedFree(&x_fine); CeedChk(ierr);
+  ierr = CeedFree(&interp_fine); CeedChk(ierr);
+  ierr = CeedFree(&q_weight); CeedChk(ierr);
+  ierr = CeedFree(&sub_nodes); CeedChk(ierr);
+  ierr = CeedFree(&D_ho); CeedChk(ierr);
+  ierr = CeedFree(&D_fine); CeedChk(ierr);
+  ierr = CeedFree(&buffer); CeedChk(ierr);
+
   return CEED_ERROR_SUCCESS;
 }
-CeedPragmaOptimizeOn
 
 /// @}
 
@@ -1379,6 +2717,49 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
   }
 }
 
+/**
+  @brief Assemble the row-sum lumped diagonal of a square mass-type CeedOperator
+
+  This sums into a CeedVector the row sums of a linear CeedOperator with a
+    single interpolated active input and output, such as a mass matrix. The
+    row sums are computed directly from the assembled CeedQFunction and the
+    interpolation matrices, without applying the CeedOperator.
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+  @param op              CeedOperator to assemble lumped diagonal
+  @param[out] assembled  CeedVector to store assembled lumped diagonal
+  @param request         Address of CeedRequest for non-blocking completion, else
+                           @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLinearAssembleAddLumpedDiagonal(CeedOperator op,
+    CeedVector assembled, CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  bool is_composite;
+  ierr = CeedOperatorIsComposite(op, &is_composite); CeedChk(ierr);
+  if (is_composite) {
+    CeedInt num_sub;
+    CeedOperator *sub_operators;
+    ierr = CeedOperatorGetNumSub(op, &num_sub); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &sub_operators); CeedChk(ierr);
+    for (CeedInt i=0; i<num_sub; i++) {
+      ierr = CeedSingleOperatorAssembleAddMassDiagonal(sub_operators[i], request,
+             true, assembled); CeedChk(ierr);
+    }
+  } else {
+    ierr = CeedSingleOperatorAssembleAddMassDiagonal(op, request, true,
+           assembled); CeedChk(ierr);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
    @brief Fully assemble the nonzero pattern of a linear operator.
 
@@ -1465,84 +2846,444 @@ int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedInt *num_entries,
       ierr = CeedSingleOperatorAssemblyCountEntries(sub_operators[k],
              &single_entries);
       CeedChk(ierr);
-      offset += single_entries;
+      offset += single_entries;
+    }
+  } else {
+    ierr = CeedSingleOperatorAssembleSymbolic(op, offset, *rows, *cols);
+    CeedChk(ierr);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Fully assemble the nonzero entries of a linear operator.
+
+   Expected to be used in conjunction with CeedOperatorLinearAssembleSymbolic()
+
+   The assembly routines use coordinate format, with num_entries tuples of the
+   form (i, j, value) which indicate that value should be added to the matrix
+   in entry (i, j). Note that the (i, j) pairs are not unique and may repeat.
+   This function returns the values of the nonzero entries to be added, their
+   (i, j) locations are provided by CeedOperatorLinearAssembleSymbolic()
+
+   This will generally be slow unless your operator is low-order.
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+   @param[in]  op      CeedOperator to assemble
+   @param[out] values  Values to assemble into matrix
+
+   @ref User
+**/
+int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
+  int ierr;
+  CeedInt num_suboperators, single_entries = 0;
+  CeedOperator *sub_operators;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (op->LinearAssemble) {
+    ierr = op->LinearAssemble(op, values); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  } else {
+    // Check for valid fallback resource
+    const char *resource, *fallback_resource;
+    ierr = CeedGetResource(op->ceed, &resource); CeedChk(ierr);
+    ierr = CeedGetOperatorFallbackResource(op->ceed, &fallback_resource);
+    CeedChk(ierr);
+    if (strcmp(fallback_resource, "") && strcmp(resource, fallback_resource)) {
+      // Fallback to reference Ceed
+      if (!op->op_fallback) {
+        ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+      }
+      // Assemble
+      ierr = CeedOperatorLinearAssemble(op->op_fallback, values); CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Default interface implementation
+  bool is_composite;
+  ierr = CeedOperatorIsComposite(op, &is_composite); CeedChk(ierr);
+
+  CeedInt offset = 0;
+  if (is_composite) {
+    ierr = CeedOperatorGetNumSub(op, &num_suboperators); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &sub_operators); CeedChk(ierr);
+    for (int k = 0; k < num_suboperators; ++k) {
+      ierr = CeedSingleOperatorAssemble(sub_operators[k], offset, values);
+      CeedChk(ierr);
+      ierr = CeedSingleOperatorAssemblyCountEntries(sub_operators[k],
+             &single_entries);
+      CeedChk(ierr);
+      offset += single_entries;
+    }
+  } else {
+    ierr = CeedSingleOperatorAssemble(op, offset, values); CeedChk(ierr);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Fully assemble the nonzero entries of a linear operator in chunks of
+            elements, passing each chunk to a user callback.
+
+   The entries are produced in the same order and coordinate format as
+   CeedOperatorLinearAssembleSymbolic() and CeedOperatorLinearAssemble(), but
+   only @a chunk_size elements are assembled at a time, so the buffers for
+   rows, columns, values, and the linearized QFunction are bounded by the
+   chunk size rather than the full coordinate representation. This allows
+   direct insertion into an external, possibly distributed, matrix. Chunks of
+   a composite operator do not span sub-operators.
+
+   The QFunction is linearized on the elements of each chunk only. Backends
+   that cannot linearize it on a range of elements, with no fallback resource
+   that can, assemble the linearized QFunction of each sub-operator for all
+   elements with CeedOperatorLinearAssembleQFunctionBuildOrUpdate() instead.
+
+   A nonzero return value from @a callback aborts assembly and is returned.
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+   @param[in] op               CeedOperator to assemble
+   @param[in] chunk_size       Maximum number of elements per chunk
+   @param[in] include_indices  Boolean flag to pass row and column numbers to
+                                 @a callback in addition to the values
+   @param[in] callback         User callback receiving each chunk
+   @param[in] ctx              User context passed to @a callback
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleChunked(CeedOperator op, CeedInt chunk_size,
+                                      bool include_indices,
+                                      CeedOperatorAssemblyChunkCallback callback,
+                                      void *ctx) {
+  int ierr;
+  CeedInt num_suboperators = 1;
+  CeedOperator *sub_operators = &op;
+  bool is_composite;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+
+  if (chunk_size < 1)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_DIMENSION,
+                     "Chunk size must be positive");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedOperatorIsComposite(op, &is_composite); CeedChk(ierr);
+  if (is_composite) {
+    ierr = CeedOperatorGetNumSub(op, &num_suboperators); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &sub_operators); CeedChk(ierr);
+  }
+
+  CeedInt buffer_size = 0, dof_buffer_size = 0, *rows = NULL, *cols = NULL,
+          *elem_dof = NULL;
+  CeedScalar *vals = NULL;
+  for (CeedInt k = 0; k < num_suboperators; ++k) {
+    CeedOperator sub_op = sub_operators[k];
+    CeedElemRestriction rstr;
+    CeedInt num_elem, elem_size, num_comp;
+    ierr = CeedOperatorGetActiveElemRestriction(sub_op, &rstr); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumElements(rstr, &num_elem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(rstr, &elem_size); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(rstr, &num_comp); CeedChk(ierr);
+    const CeedInt elem_entries = elem_size*num_comp * elem_size*num_comp,
+                  max_chunk = chunk_size < num_elem ? chunk_size : num_elem;
+
+    // Chunk buffers
+    if (elem_entries*max_chunk > buffer_size) {
+      buffer_size = elem_entries*max_chunk;
+      ierr = CeedRealloc(buffer_size, &vals); CeedChk(ierr);
+      if (include_indices) {
+        ierr = CeedRealloc(buffer_size, &rows); CeedChk(ierr);
+        ierr = CeedRealloc(buffer_size, &cols); CeedChk(ierr);
+      }
+    }
+    if (include_indices && elem_size*num_comp*max_chunk > dof_buffer_size) {
+      dof_buffer_size = elem_size*num_comp*max_chunk;
+      ierr = CeedRealloc(dof_buffer_size, &elem_dof); CeedChk(ierr);
+    }
+
+    // Linearized QFunction, per chunk if supported
+    CeedOperator op_qf_elems;
+    CeedVector assembled_qf;
+    CeedInt layout_qf[3];
+    const CeedScalar *assembled_qf_array = NULL;
+    ierr = CeedOperatorGetQFunctionElementsAssembler(sub_op, &op_qf_elems);
+    CeedChk(ierr);
+    if (op_qf_elems) {
+      CeedInt num_qpts, num_active_in, num_active_out;
+      ierr = CeedOperatorGetNumQuadraturePoints(sub_op, &num_qpts); CeedChk(ierr);
+      ierr = CeedOperatorGetNumActiveQFunctionComponents(sub_op, &num_active_in,
+             &num_active_out); CeedChk(ierr);
+      const CeedInt num_qf = num_active_in*num_active_out;
+      layout_qf[0] = 1;
+      layout_qf[1] = num_qpts;
+      layout_qf[2] = num_qf*num_qpts;
+      ierr = CeedVectorCreate(sub_op->ceed, max_chunk*num_qf*num_qpts,
+                              &assembled_qf); CeedChk(ierr);
+    } else {
+      CeedElemRestriction rstr_q;
+      ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(
+               sub_op, &assembled_qf, &rstr_q, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetELayout(rstr_q, &layout_qf); CeedChk(ierr);
+      ierr = CeedElemRestrictionDestroy(&rstr_q); CeedChk(ierr);
+      ierr = CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST,
+                                    &assembled_qf_array); CeedChk(ierr);
+    }
+
+    // Offsets for the element to L-vector map
+    bool is_strided = true;
+    const CeedInt *offsets = NULL;
+    if (include_indices) {
+      ierr = CeedElemRestrictionIsStrided(rstr, &is_strided); CeedChk(ierr);
+      if (!is_strided) {
+        ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+        CeedChk(ierr);
+      }
+    }
+
+    // Assemble and hand off each chunk, releasing all data before returning
+    //   an error from the callback
+    int ierr_chunk = CEED_ERROR_SUCCESS;
+    for (CeedInt elem_start = 0; elem_start < num_elem && !ierr_chunk;
+         elem_start += chunk_size) {
+      const CeedInt elem_end = elem_start + chunk_size < num_elem ?
+                               elem_start + chunk_size : num_elem;
+      CeedInt qf_elem_start = 0;
+      if (include_indices) {
+        ierr_chunk = CeedElemRestrictionGetElemDofRange(rstr, offsets,
+                     elem_start, elem_end, elem_dof);
+        if (!ierr_chunk)
+          ierr_chunk = CeedSingleOperatorAssembleSymbolicElements(sub_op,
+                       elem_dof, elem_start, elem_end, rows, cols);
+      }
+      if (!ierr_chunk && op_qf_elems) {
+        qf_elem_start = elem_start;
+        ierr_chunk = op_qf_elems->LinearAssembleQFunctionElements(op_qf_elems,
+                     elem_start, elem_end, assembled_qf, CEED_REQUEST_IMMEDIATE);
+        if (!ierr_chunk)
+          ierr_chunk = CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST,
+                                              &assembled_qf_array);
+      }
+      if (!ierr_chunk)
+        ierr_chunk = CeedSingleOperatorAssembleElements(sub_op,
+                     assembled_qf_array, layout_qf, qf_elem_start, elem_start,
+                     elem_end, vals);
+      if (op_qf_elems && assembled_qf_array) {
+        ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
+        CeedChk(ierr);
+      }
+      if (!ierr_chunk)
+        ierr_chunk = callback(ctx, (elem_end - elem_start)*elem_entries, rows,
+                              cols, vals);
+    }
+
+    if (assembled_qf_array) {
+      ierr = CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array);
+      CeedChk(ierr);
+    }
+    ierr = CeedVectorDestroy(&assembled_qf); CeedChk(ierr);
+    if (offsets) {
+      ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+    }
+    if (ierr_chunk) {
+      ierr = CeedFree(&vals); CeedChk(ierr);
+      ierr = CeedFree(&rows); CeedChk(ierr);
+      ierr = CeedFree(&cols); CeedChk(ierr);
+      ierr = CeedFree(&elem_dof); CeedChk(ierr);
+      return ierr_chunk;
     }
-  } else {
-    ierr = CeedSingleOperatorAssembleSymbolic(op, offset, *rows, *cols);
-    CeedChk(ierr);
   }
+  ierr = CeedFree(&vals); CeedChk(ierr);
+  ierr = CeedFree(&rows); CeedChk(ierr);
+  ierr = CeedFree(&cols); CeedChk(ierr);
+  ierr = CeedFree(&elem_dof); CeedChk(ierr);
 
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-   @brief Fully assemble the nonzero entries of a linear operator.
+   @brief Build the CSR nonzero pattern of the low-order-refined operator
+            associated with a linear operator.
 
-   Expected to be used in conjunction with CeedOperatorLinearAssembleSymbolic()
+   The low-order-refined (LOR) operator discretizes the same bilinear form with
+   Q1 sub-elements on the Gauss-Lobatto sub-mesh of each high-order element.
+   It is spectrally equivalent to the high-order operator and has
+   (2^dim * num_comp)^2 entries per sub-element, making it suitable for
+   algebraic multigrid preconditioning of high-order matrix-free operators.
 
-   The assembly routines use coordinate format, with num_entries tuples of the
-   form (i, j, value) which indicate that value should be added to the matrix
-   in entry (i, j). Note that the (i, j) pairs are not unique and may repeat.
-   This function returns the values of the nonzero entries to be added, their
-   (i, j) locations are provided by CeedOperatorLinearAssembleSymbolic()
+   The active basis must be a tensor product H1 Lagrange basis with
+   Gauss-Lobatto nodes, as created by CeedBasisCreateTensorH1Lagrange(), and
+   the active fields must use CEED_EVAL_INTERP or CEED_EVAL_GRAD.
 
-   This will generally be slow unless your operator is low-order.
+   Rows and columns are indexed by the active L-vector. Column indices in each
+   row are sorted and unique. The arrays are allocated with CeedCalloc() and
+   should be freed by the caller with CeedFree().
 
   Note: Calling this function asserts that setup is complete
           and sets the CeedOperator as immutable.
 
-   @param[in]  op      CeedOperator to assemble
-   @param[out] values  Values to assemble into matrix
+   @param[in]  op        CeedOperator to assemble
+   @param[out] num_rows  Number of rows in the CSR matrix
+   @param[out] row_ptr   Array of size num_rows + 1 with the offset of each
+                           row in @a col_ind
+   @param[out] col_ind   Column index of each nonzero entry
 
    @ref User
 **/
-int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
+int CeedOperatorLinearAssembleLORSymbolic(CeedOperator op, CeedInt *num_rows,
+    CeedInt **row_ptr, CeedInt **col_ind) {
   int ierr;
-  CeedInt num_suboperators, single_entries = 0;
-  CeedOperator *sub_operators;
+  CeedInt num_suboperators = 1;
+  CeedOperator *sub_operators = &op;
+  bool is_composite;
   ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
 
-  // Use backend version, if available
-  if (op->LinearAssemble) {
-    ierr = op->LinearAssemble(op, values); CeedChk(ierr);
-    return CEED_ERROR_SUCCESS;
-  } else {
-    // Check for valid fallback resource
-    const char *resource, *fallback_resource;
-    ierr = CeedGetResource(op->ceed, &resource); CeedChk(ierr);
-    ierr = CeedGetOperatorFallbackResource(op->ceed, &fallback_resource);
-    CeedChk(ierr);
-    if (strcmp(fallback_resource, "") && strcmp(resource, fallback_resource)) {
-      // Fallback to reference Ceed
-      if (!op->op_fallback) {
-        ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+  ierr = CeedOperatorIsComposite(op, &is_composite); CeedChk(ierr);
+  if (is_composite) {
+    ierr = CeedOperatorGetNumSub(op, &num_suboperators); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &sub_operators); CeedChk(ierr);
+  }
+  CeedElemRestriction rstr;
+  ierr = CeedOperatorGetActiveElemRestriction(sub_operators[0], &rstr);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstr, num_rows); CeedChk(ierr);
+
+  // L-vector nodes of all sub-elements, with the sub-elements of all
+  //   sub-operators numbered consecutively
+  CeedInt num_sub_elem = 0, *sub_elem_ptr, *sub_dofs;
+  for (CeedInt k = 0; k < num_suboperators; ++k) {
+    CeedInt num_single, sub_elem_size;
+    ierr = CeedSingleOperatorLORCountSubElements(sub_operators[k], &num_single,
+           &sub_elem_size); CeedChk(ierr);
+    num_sub_elem += num_single;
+  }
+  ierr = CeedMalloc(num_sub_elem + 1, &sub_elem_ptr); CeedChk(ierr);
+  sub_elem_ptr[0] = 0;
+  for (CeedInt k = 0, g = 0; k < num_suboperators; ++k) {
+    CeedInt num_single, sub_elem_size;
+    ierr = CeedSingleOperatorLORCountSubElements(sub_operators[k], &num_single,
+           &sub_elem_size); CeedChk(ierr);
+    for (CeedInt i = 0; i < num_single; ++i, ++g)
+      sub_elem_ptr[g + 1] = sub_elem_ptr[g] + sub_elem_size;
+  }
+  ierr = CeedMalloc(sub_elem_ptr[num_sub_elem], &sub_dofs); CeedChk(ierr);
+  for (CeedInt k = 0, g = 0; k < num_suboperators; ++k) {
+    CeedInt num_single, sub_elem_size;
+    ierr = CeedSingleOperatorLORSubElementDofs(sub_operators[k],
+           &sub_dofs[sub_elem_ptr[g]]); CeedChk(ierr);
+    ierr = CeedSingleOperatorLORCountSubElements(sub_operators[k], &num_single,
+           &sub_elem_size); CeedChk(ierr);
+    g += num_single;
+  }
+
+  // Sub-elements containing each row
+  CeedInt *row_sub_ptr, *row_sub;
+  ierr = CeedCalloc(*num_rows + 1, &row_sub_ptr); CeedChk(ierr);
+  for (CeedInt i = 0; i < sub_elem_ptr[num_sub_elem]; ++i)
+    row_sub_ptr[sub_dofs[i] + 1]++;
+  for (CeedInt r = 0; r < *num_rows; ++r)
+    row_sub_ptr[r + 1] += row_sub_ptr[r];
+  ierr = CeedMalloc(row_sub_ptr[*num_rows], &row_sub); CeedChk(ierr);
+  for (CeedInt g = 0; g < num_sub_elem; ++g)
+    for (CeedInt i = sub_elem_ptr[g]; i < sub_elem_ptr[g + 1]; ++i)
+      row_sub[row_sub_ptr[sub_dofs[i]]++] = g;
+  for (CeedInt r = *num_rows; r > 0; --r)
+    row_sub_ptr[r] = row_sub_ptr[r - 1];
+  row_sub_ptr[0] = 0;
+
+  // Count the unique columns of each row, then fill each row in sorted order
+  CeedInt *marker;
+  ierr = CeedMalloc(*num_rows, &marker); CeedChk(ierr);
+  ierr = CeedCalloc(*num_rows + 1, row_ptr); CeedChk(ierr);
+  for (CeedInt pass = 0; pass < 2; ++pass) {
+    CeedInt nnz = 0;
+    for (CeedInt r = 0; r < *num_rows; ++r)
+      marker[r] = -1;
+    if (pass == 1) {
+      ierr = CeedCalloc((*row_ptr)[*num_rows], col_ind); CeedChk(ierr);
+    }
+    for (CeedInt r = 0; r < *num_rows; ++r) {
+      const CeedInt row_start = nnz;
+      for (CeedInt s = row_sub_ptr[r]; s < row_sub_ptr[r + 1]; ++s) {
+        const CeedInt g = row_sub[s];
+        for (CeedInt i = sub_elem_ptr[g]; i < sub_elem_ptr[g + 1]; ++i) {
+          const CeedInt col = sub_dofs[i];
+          if (marker[col] == r)
+            continue;
+          marker[col] = r;
+          if (pass == 1) {
+            CeedInt j = nnz;
+            for (; j > row_start && (*col_ind)[j - 1] > col; --j)
+              (*col_ind)[j] = (*col_ind)[j - 1];
+            (*col_ind)[j] = col;
+          }
+          nnz++;
+        }
       }
-      // Assemble
-      ierr = CeedOperatorLinearAssemble(op->op_fallback, values); CeedChk(ierr);
-      return CEED_ERROR_SUCCESS;
+      if (pass == 0) (*row_ptr)[r + 1] = nnz;
     }
   }
+  ierr = CeedFree(&marker); CeedChk(ierr);
+  ierr = CeedFree(&row_sub); CeedChk(ierr);
+  ierr = CeedFree(&row_sub_ptr); CeedChk(ierr);
+  ierr = CeedFree(&sub_dofs); CeedChk(ierr);
+  ierr = CeedFree(&sub_elem_ptr); CeedChk(ierr);
 
-  // Default interface implementation
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Assemble the nonzero entries of the low-order-refined operator
+            associated with a linear operator.
+
+   Expected to be used in conjunction with
+   CeedOperatorLinearAssembleLORSymbolic(). The QFunction is linearized with
+   CeedOperatorLinearAssembleQFunctionBuildOrUpdate() and its pointwise data is
+   interpolated to the quadrature points of the Q1 sub-elements, so the
+   geometry of the high-order operator is reused.
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+   @param[in]  op       CeedOperator to assemble
+   @param[in]  row_ptr  CSR row offsets from
+                          CeedOperatorLinearAssembleLORSymbolic()
+   @param[in]  col_ind  CSR column indices from
+                          CeedOperatorLinearAssembleLORSymbolic()
+   @param[out] values   CeedVector of length row_ptr[num_rows] to hold the
+                          values of the nonzero entries
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleLOR(CeedOperator op, const CeedInt *row_ptr,
+                                  const CeedInt *col_ind, CeedVector values) {
+  int ierr;
+  CeedInt num_suboperators = 1;
+  CeedOperator *sub_operators = &op;
   bool is_composite;
-  ierr = CeedOperatorIsComposite(op, &is_composite); CeedChk(ierr);
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
 
-  CeedInt offset = 0;
+  ierr = CeedOperatorIsComposite(op, &is_composite); CeedChk(ierr);
   if (is_composite) {
     ierr = CeedOperatorGetNumSub(op, &num_suboperators); CeedChk(ierr);
     ierr = CeedOperatorGetSubList(op, &sub_operators); CeedChk(ierr);
-    for (int k = 0; k < num_suboperators; ++k) {
-      ierr = CeedSingleOperatorAssemble(sub_operators[k], offset, values);
-      CeedChk(ierr);
-      ierr = CeedSingleOperatorAssemblyCountEntries(sub_operators[k],
-             &single_entries);
-      CeedChk(ierr);
-      offset += single_entries;
-    }
-  } else {
-    ierr = CeedSingleOperatorAssemble(op, offset, values); CeedChk(ierr);
   }
 
+  CeedScalar *vals;
+  ierr = CeedVectorSetValue(values, 0.0); CeedChk(ierr);
+  ierr = CeedVectorGetArray(values, CEED_MEM_HOST, &vals); CeedChk(ierr);
+  for (CeedInt k = 0; k < num_suboperators; ++k) {
+    ierr = CeedSingleOperatorLORAssemble(sub_operators[k], row_ptr, col_ind,
+                                         vals); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(values, &vals); CeedChk(ierr);
+
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1861,35 +3602,13 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
   ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceed_parent); CeedChk(ierr);
   ceed_parent = ceed_parent ? ceed_parent : ceed;
-  CeedQFunction qf;
-  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
 
   // Determine active input basis
-  bool interp = false, grad = false;
-  CeedBasis basis = NULL;
-  CeedElemRestriction rstr = NULL;
-  CeedOperatorField *op_fields;
-  CeedQFunctionField *qf_fields;
-  CeedInt num_input_fields;
-  ierr = CeedOperatorGetFields(op, &num_input_fields, &op_fields, NULL, NULL);
+  bool interp, grad;
+  CeedBasis basis;
+  CeedElemRestriction rstr;
+  ierr = CeedOperatorGetFDMActiveField(op, &basis, &rstr, &interp, &grad);
   CeedChk(ierr);
-  ierr = CeedQFunctionGetFields(qf, NULL, &qf_fields, NULL, NULL); CeedChk(ierr);
-  for (CeedInt i=0; i<num_input_fields; i++) {
-    CeedVector vec;
-    ierr = CeedOperatorFieldGetVector(op_fields[i], &vec); CeedChk(ierr);
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedEvalMode eval_mode;
-      ierr = CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode); CeedChk(ierr);
-      interp = interp || eval_mode == CEED_EVAL_INTERP;
-      grad = grad || eval_mode == CEED_EVAL_GRAD;
-      ierr = CeedOperatorFieldGetBasis(op_fields[i], &basis); CeedChk(ierr);
-      ierr = CeedOperatorFieldGetElemRestriction(op_fields[i], &rstr); CeedChk(ierr);
-    }
-  }
-  if (!basis)
-    // LCOV_EXCL_START
-    return CeedError(ceed, CEED_ERROR_BACKEND, "No active field set");
-  // LCOV_EXCL_STOP
   CeedInt P_1d, Q_1d, elem_size, num_qpts, dim, num_comp = 1, num_elem = 1,
                                                 l_size = 1;
   ierr = CeedBasisGetNumNodes1D(basis, &P_1d); CeedChk(ierr);
@@ -1934,51 +3653,10 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
       fdm_interp[i+j*P_1d] = x[j+i*P_1d];
   ierr = CeedFree(&x); CeedChk(ierr);
 
-  // Assemble QFunction
-  CeedVector assembled;
-  CeedElemRestriction rstr_qf;
-  ierr =  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled,
-          &rstr_qf, request); CeedChk(ierr);
-  CeedInt layout[3];
-  ierr = CeedElemRestrictionGetELayout(rstr_qf, &layout); CeedChk(ierr);
-  ierr = CeedElemRestrictionDestroy(&rstr_qf); CeedChk(ierr);
-  CeedScalar max_norm = 0;
-  ierr = CeedVectorNorm(assembled, CEED_NORM_MAX, &max_norm); CeedChk(ierr);
-
   // Calculate element averages
-  CeedInt num_modes = (interp?1:0) + (grad?dim:0);
   CeedScalar *elem_avg;
-  const CeedScalar *assembled_array, *q_weight_array;
-  CeedVector q_weight;
-  ierr = CeedVectorCreate(ceed_parent, num_qpts, &q_weight); CeedChk(ierr);
-  ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
-                        CEED_VECTOR_NONE, q_weight); CeedChk(ierr);
-  ierr = CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
-  CeedChk(ierr);
-  ierr = CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array);
-  CeedChk(ierr);
-  ierr = CeedCalloc(num_elem, &elem_avg); CeedChk(ierr);
-  const CeedScalar qf_value_bound = max_norm*100*CEED_EPSILON;
-  for (CeedInt e=0; e<num_elem; e++) {
-    CeedInt count = 0;
-    for (CeedInt q=0; q<num_qpts; q++)
-      for (CeedInt i=0; i<num_comp*num_comp*num_modes*num_modes; i++)
-        if (fabs(assembled_array[q*layout[0] + i*layout[1] + e*layout[2]]) >
-            qf_value_bound) {
-          elem_avg[e] += assembled_array[q*layout[0] + i*layout[1] + e*layout[2]] /
-                         q_weight_array[q];
-          count++;
-        }
-    if (count) {
-      elem_avg[e] /= count;
-    } else {
-      elem_avg[e] = 1.0;
-    }
-  }
-  ierr = CeedVectorRestoreArrayRead(assembled, &assembled_array); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&assembled); CeedChk(ierr);
-  ierr = CeedVectorRestoreArrayRead(q_weight, &q_weight_array); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&q_weight); CeedChk(ierr);
+  ierr = CeedOperatorGetFDMElemAvg(op, basis, interp, grad, num_elem, &elem_avg,
+                                   request); CeedChk(ierr);
 
   // Build FDM diagonal
   CeedVector q_data;
@@ -2072,4 +3750,298 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create an overlapping Schwarz smoother built from fast
+           diagonalization method inverses on vertex star patches
+
+  This returns a CeedOperator applying the additive Schwarz approximate
+    inverse
+      sum_p R_p^T W_p^1/2 A_p^-1 W_p^1/2 R_p,
+    where R_p restricts to the nodes of the tensor product patch formed by the
+    elements sharing vertex p, excluding the nodes on the far side of the
+    patch, and W_p holds the values of the vertex hat function, forming a
+    partition of unity over the patches. As in
+    @ref CeedOperatorCreateFDMElementInverse, each patch inverse A_p^-1 is
+    applied through the simultaneous diagonalization of the 1D patch mass and
+    Laplacian, scaled by the average of the assembled QFunction over the
+    elements of the patch.
+
+  The active field must use a tensor H1 basis with nodes at the element
+    vertices and the elements must be conforming with aligned local coordinate
+    directions. Patches are grouped by their extent at the domain boundary;
+    patches with the same extent in every dimension use a tensor product
+    basis. The CeedOperator must be linear and non-composite.
+
+  Note: Calling this function asserts that setup is complete
+          and sets the CeedOperator as immutable.
+
+  @param op              CeedOperator to create patch inverses
+  @param[out] patch_inv  Composite CeedOperator to apply the action of the
+                           overlapping Schwarz smoother
+  @param request         Address of CeedRequest for non-blocking completion,
+                           else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorCreateFDMPatchInverse(CeedOperator op, CeedOperator *patch_inv,
+                                      CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op); CeedChk(ierr);
+  Ceed ceed, ceed_parent;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceed_parent); CeedChk(ierr);
+  ceed_parent = ceed_parent ? ceed_parent : ceed;
+  if (op->is_composite)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "Composite operator not supported");
+  // LCOV_EXCL_STOP
+
+  // Determine active input basis
+  bool interp, grad, is_tensor, is_strided;
+  CeedBasis basis;
+  CeedElemRestriction rstr;
+  ierr = CeedOperatorGetFDMActiveField(op, &basis, &rstr, &interp, &grad);
+  CeedChk(ierr);
+  ierr = CeedBasisIsTensor(basis, &is_tensor); CeedChk(ierr);
+  ierr = CeedElemRestrictionIsStrided(rstr, &is_strided); CeedChk(ierr);
+  if (!is_tensor || is_strided)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "FDMPatchInverse only supported for tensor bases "
+                     "with offset restrictions");
+  // LCOV_EXCL_STOP
+  CeedInt P_1d, Q_1d, dim, num_comp, num_elem, comp_stride, l_size;
+  ierr = CeedBasisGetNumNodes1D(basis, &P_1d); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d); CeedChk(ierr);
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &num_comp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumElements(rstr, &num_elem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(rstr, &comp_stride); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstr, &l_size); CeedChk(ierr);
+  if (P_1d < 2)
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED,
+                     "FDMPatchInverse requires at least 2 nodes per dimension");
+  // LCOV_EXCL_STOP
+
+  // Build and diagonalize 1D patch mass and Laplacian for each patch type
+  const CeedInt max_n = 2*P_1d - 3 > P_1d - 1 ? 2*P_1d - 3 : P_1d - 1;
+  CeedInt n[3];
+  CeedScalar *mass, *laplace, *x_node, *fdm_interp_1d, *lambda;
+  ierr = CeedCalloc(P_1d*P_1d, &mass); CeedChk(ierr);
+  ierr = CeedCalloc(P_1d*P_1d, &laplace); CeedChk(ierr);
+  ierr = CeedCalloc(P_1d, &x_node); CeedChk(ierr);
+  ierr = CeedCalloc(3*max_n*max_n, &fdm_interp_1d); CeedChk(ierr);
+  ierr = CeedCalloc(3*max_n, &lambda); CeedChk(ierr);
+  const CeedScalar *interp_1d, *grad_1d, *q_ref_1d, *q_weight_1d;
+  ierr = CeedBasisGetInterp1D(basis, &interp_1d); CeedChk(ierr);
+  ierr = CeedBasisGetGrad1D(basis, &grad_1d); CeedChk(ierr);
+  ierr = CeedBasisGetQRef(basis, &q_ref_1d); CeedChk(ierr);
+  ierr = CeedBasisGetQWeights(basis, &q_weight_1d); CeedChk(ierr);
+  ierr = CeedBuildMassLaplace(interp_1d, grad_1d, q_weight_1d, P_1d, Q_1d, dim,
+                              mass, laplace); CeedChk(ierr);
+  ierr = CeedBuildNodeCoordinates1D(interp_1d, q_ref_1d, q_weight_1d, P_1d,
+                                    Q_1d, x_node); CeedChk(ierr);
+  for (CeedInt t=0; t<3; t++) {
+    ierr = CeedBuildPatchFDM1D(ceed, mass, laplace, x_node, P_1d, t, &n[t],
+                               &fdm_interp_1d[t*max_n*max_n], &lambda[t*max_n]);
+    CeedChk(ierr);
+  }
+  ierr = CeedFree(&mass); CeedChk(ierr);
+  ierr = CeedFree(&laplace); CeedChk(ierr);
+  ierr = CeedFree(&x_node); CeedChk(ierr);
+
+  // Calculate element averages
+  CeedScalar *elem_avg;
+  ierr = CeedOperatorGetFDMElemAvg(op, basis, interp, grad, num_elem, &elem_avg,
+                                   request); CeedChk(ierr);
+
+  // Build vertex patches from the first component of each element node
+  CeedVector elem_dof;
+  const CeedScalar *elem_dof_a;
+  CeedInt layout_er[3], *elem_dof_0, elem_size = CeedIntPow(P_1d, dim);
+  ierr = CeedElemRestrictionGetElemDof(rstr, &elem_dof); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetELayout(rstr, &layout_er); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(elem_dof, CEED_MEM_HOST, &elem_dof_a);
+  CeedChk(ierr);
+  ierr = CeedMalloc(num_elem*elem_size, &elem_dof_0); CeedChk(ierr);
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt i=0; i<elem_size; i++)
+      elem_dof_0[e*elem_size + i] = elem_dof_a[i*layout_er[0] + e*layout_er[2]];
+  ierr = CeedVectorRestoreArrayRead(elem_dof, &elem_dof_a); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&elem_dof); CeedChk(ierr);
+  CeedInt num_patches, *patch_types, *patch_offsets;
+  CeedScalar *patch_avg;
+  ierr = CeedBuildVertexPatches(ceed, dim, P_1d, num_elem, elem_dof_0, elem_avg,
+                                &num_patches, &patch_types, &patch_offsets,
+                                &patch_avg); CeedChk(ierr);
+  ierr = CeedFree(&elem_dof_0); CeedChk(ierr);
+  ierr = CeedFree(&elem_avg); CeedChk(ierr);
+
+  // Setup patch operators
+  // -- QFunction
+  CeedQFunction qf_fdm;
+  ierr = CeedQFunctionCreateInteriorByName(ceed_parent, "Scale", &qf_fdm);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf_fdm, "input", num_comp, CEED_EVAL_INTERP);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf_fdm, "scale", num_comp, CEED_EVAL_NONE);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddOutput(qf_fdm, "output", num_comp, CEED_EVAL_INTERP);
+  CeedChk(ierr);
+  // -- QFunction context
+  CeedInt *num_comp_data;
+  ierr = CeedCalloc(1, &num_comp_data); CeedChk(ierr);
+  num_comp_data[0] = num_comp;
+  CeedQFunctionContext ctx_fdm;
+  ierr = CeedQFunctionContextCreate(ceed, &ctx_fdm); CeedChk(ierr);
+  ierr = CeedQFunctionContextSetData(ctx_fdm, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                     sizeof(*num_comp_data), num_comp_data);
+  CeedChk(ierr);
+  ierr = CeedQFunctionSetContext(qf_fdm, ctx_fdm); CeedChk(ierr);
+  ierr = CeedQFunctionContextDestroy(&ctx_fdm); CeedChk(ierr);
+  // -- Composite operator
+  ierr = CeedCompositeOperatorCreate(ceed_parent, patch_inv); CeedChk(ierr);
+
+  // -- One sub-operator for each combination of patch types
+  const CeedInt max_patch_size = CeedIntPow(2*P_1d - 3, dim),
+                num_classes = CeedIntPow(3, dim);
+  for (CeedInt c=0; c<num_classes; c++) {
+    CeedInt types[3], patch_size = 1, num_class_patches = 0;
+    bool is_uniform = true;
+    for (CeedInt d=0; d<dim; d++) {
+      types[d] = (c / CeedIntPow(3, d)) % 3;
+      is_uniform = is_uniform && types[d] == types[0];
+      patch_size *= n[types[d]];
+    }
+    for (CeedInt p=0; p<num_patches; p++) {
+      bool in_class = true;
+      for (CeedInt d=0; d<dim; d++)
+        in_class = in_class && patch_types[p*dim + d] == types[d];
+      num_class_patches += in_class;
+    }
+    if (!num_class_patches) continue;
+
+    // ---- Restriction and FDM scaling
+    CeedInt *offsets;
+    CeedScalar *q_data_array, *fdm_diagonal;
+    CeedVector q_data;
+    ierr = CeedMalloc(num_class_patches*patch_size, &offsets); CeedChk(ierr);
+    ierr = CeedCalloc(patch_size, &fdm_diagonal); CeedChk(ierr);
+    const CeedScalar fdm_diagonal_bound = patch_size*CEED_EPSILON;
+    for (CeedInt i=0; i<patch_size; i++) {
+      if (interp)
+        fdm_diagonal[i] = 1.0;
+      if (grad)
+        for (CeedInt d=0, stride=1; d<dim; stride *= n[types[d]], d++)
+          fdm_diagonal[i] += lambda[types[d]*max_n + (i / stride) % n[types[d]]];
+      if (fabs(fdm_diagonal[i]) < fdm_diagonal_bound)
+        fdm_diagonal[i] = fdm_diagonal_bound;
+    }
+    ierr = CeedVectorCreate(ceed_parent, num_class_patches*num_comp*patch_size,
+                            &q_data); CeedChk(ierr);
+    ierr = CeedVectorSetValue(q_data, 0.0); CeedChk(ierr);
+    ierr = CeedVectorGetArray(q_data, CEED_MEM_HOST, &q_data_array); CeedChk(ierr);
+    for (CeedInt p=0, k=0; p<num_patches; p++) {
+      bool in_class = true;
+      for (CeedInt d=0; d<dim; d++)
+        in_class = in_class && patch_types[p*dim + d] == types[d];
+      if (!in_class) continue;
+      for (CeedInt i=0; i<patch_size; i++)
+        offsets[k*patch_size + i] = patch_offsets[p*max_patch_size + i];
+      for (CeedInt j=0; j<num_comp; j++)
+        for (CeedInt i=0; i<patch_size; i++)
+          q_data_array[(k*num_comp+j)*patch_size+i] = 1. / (patch_avg[p] *
+              fdm_diagonal[i]);
+      k++;
+    }
+    ierr = CeedFree(&fdm_diagonal); CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(q_data, &q_data_array); CeedChk(ierr);
+    CeedElemRestriction rstr_patch, rstr_qd_i;
+    ierr = CeedElemRestrictionCreate(ceed_parent, num_class_patches, patch_size,
+                                     num_comp, comp_stride, l_size,
+                                     CEED_MEM_HOST, CEED_OWN_POINTER, offsets,
+                                     &rstr_patch); CeedChk(ierr);
+    CeedInt strides[3] = {1, patch_size, patch_size*num_comp};
+    ierr = CeedElemRestrictionCreateStrided(ceed_parent, num_class_patches,
+                                            patch_size, num_comp,
+                                            num_class_patches*num_comp*patch_size,
+                                            strides, &rstr_qd_i); CeedChk(ierr);
+
+    // ---- Basis
+    CeedBasis fdm_basis;
+    CeedScalar *grad_dummy, *q_ref_dummy, *q_weight_dummy;
+    ierr = CeedCalloc(dim*patch_size*patch_size, &grad_dummy); CeedChk(ierr);
+    ierr = CeedCalloc(dim*patch_size, &q_ref_dummy); CeedChk(ierr);
+    ierr = CeedCalloc(patch_size, &q_weight_dummy); CeedChk(ierr);
+    if (is_uniform) {
+      const CeedInt n_1d = n[types[0]];
+      CeedScalar *fdm_interp;
+      ierr = CeedCalloc(n_1d*n_1d, &fdm_interp); CeedChk(ierr);
+      for (CeedInt i=0; i<n_1d; i++)
+        for (CeedInt j=0; j<n_1d; j++)
+          fdm_interp[i*n_1d + j] = fdm_interp_1d[types[0]*max_n*max_n + i*n_1d + j];
+      ierr = CeedBasisCreateTensorH1(ceed_parent, dim, num_comp, n_1d, n_1d,
+                                     fdm_interp, grad_dummy, q_ref_dummy,
+                                     q_weight_dummy, &fdm_basis); CeedChk(ierr);
+      ierr = CeedFree(&fdm_interp); CeedChk(ierr);
+    } else {
+      // Kronecker product of the 1D matrices, first dimension fastest
+      CeedScalar *fdm_interp;
+      ierr = CeedCalloc(patch_size*patch_size, &fdm_interp); CeedChk(ierr);
+      for (CeedInt q=0; q<patch_size; q++)
+        for (CeedInt i=0; i<patch_size; i++) {
+          CeedScalar value = 1.0;
+          for (CeedInt d=0, stride=1; d<dim; stride *= n[types[d]], d++) {
+            const CeedInt n_1d = n[types[d]];
+            value *= fdm_interp_1d[types[d]*max_n*max_n +
+                                   ((q / stride) % n_1d)*n_1d + (i / stride) % n_1d];
+          }
+          fdm_interp[q*patch_size + i] = value;
+        }
+      const CeedElemTopology topo = dim == 1 ? CEED_LINE :
+                                    (dim == 2 ? CEED_QUAD : CEED_HEX);
+      ierr = CeedBasisCreateH1(ceed_parent, topo, num_comp, patch_size,
+                               patch_size, fdm_interp, grad_dummy, q_ref_dummy,
+                               q_weight_dummy, &fdm_basis); CeedChk(ierr);
+      ierr = CeedFree(&fdm_interp); CeedChk(ierr);
+    }
+    ierr = CeedFree(&grad_dummy); CeedChk(ierr);
+    ierr = CeedFree(&q_ref_dummy); CeedChk(ierr);
+    ierr = CeedFree(&q_weight_dummy); CeedChk(ierr);
+
+    // ---- Operator
+    CeedOperator op_patch;
+    ierr = CeedOperatorCreate(ceed_parent, qf_fdm, NULL, NULL, &op_patch);
+    CeedChk(ierr);
+    ierr = CeedOperatorSetField(op_patch, "input", rstr_patch, fdm_basis,
+                                CEED_VECTOR_ACTIVE); CeedChk(ierr);
+    ierr = CeedOperatorSetField(op_patch, "scale", rstr_qd_i,
+                                CEED_BASIS_COLLOCATED, q_data); CeedChk(ierr);
+    ierr = CeedOperatorSetField(op_patch, "output", rstr_patch, fdm_basis,
+                                CEED_VECTOR_ACTIVE); CeedChk(ierr);
+    ierr = CeedCompositeOperatorAddSub(*patch_inv, op_patch); CeedChk(ierr);
+
+    // ---- Cleanup
+    ierr = CeedVectorDestroy(&q_data); CeedChk(ierr);
+    ierr = CeedBasisDestroy(&fdm_basis); CeedChk(ierr);
+    ierr = CeedElemRestrictionDestroy(&rstr_patch); CeedChk(ierr);
+    ierr = CeedElemRestrictionDestroy(&rstr_qd_i); CeedChk(ierr);
+    ierr = CeedOperatorDestroy(&op_patch); CeedChk(ierr);
+  }
+
+  // Cleanup
+  ierr = CeedQFunctionDestroy(&qf_fdm); CeedChk(ierr);
+  ierr = CeedFree(&fdm_interp_1d); CeedChk(ierr);
+  ierr = CeedFree(&lambda); CeedChk(ierr);
+  ierr = CeedFree(&patch_types); CeedChk(ierr);
+  ierr = CeedFree(&patch_offsets); CeedChk(ierr);
+  ierr = CeedFree(&patch_avg); CeedChk(ierr);
+
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
@@ -151,6 +151,8 @@ static int CeedQFunctionFieldView(CeedQFunctionField field,
           "      Size: %d\n"
           "      EvalMode: \"%s\"\n",
           inout, field_number, field_name, size, CeedEvalModes[eval_mode]);
+  if (field->is_symmetric)
+    fprintf(stream, "      Symmetric tensor\n");
   return CEED_ERROR_SUCCESS;
 }
 
@@ -340,7 +342,7 @@ int CeedQFunctionSetData(CeedQFunction qf, void *data) {
   @ref Backend
 **/
 int CeedQFunctionReference(CeedQFunction qf) {
-  qf->ref_count++;
+  CeedAtomicAdd(qf->ref_count, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -602,6 +604,57 @@ int CeedQFunctionAddOutput(CeedQFunction qf, const char *field_name,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Declare a CeedQFunction field as a symmetric tensor
+
+  The field must use @ref CEED_EVAL_NONE and have size n*n, with component
+    i*n + j holding entry (i, j) of an n by n symmetric tensor. The QFunction
+    still reads and writes all n*n components, but quadrature data passed to
+    this field as an input can be stored with only the n*(n+1)/2 independent
+    entries by CeedOperatorCompressQData().
+
+  @param qf          CeedQFunction
+  @param field_name  Name of QFunction field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionSetFieldSymmetric(CeedQFunction qf, const char *field_name) {
+  if (qf->is_immutable)
+    // LCOV_EXCL_START
+    return CeedError(qf->ceed, CEED_ERROR_MAJOR,
+                     "QFunction cannot be changed after set as immutable");
+  // LCOV_EXCL_STOP
+
+  // Find field
+  CeedQFunctionField qf_field = NULL;
+  for (CeedInt i=0; i<qf->num_input_fields; i++)
+    if (!strcmp(field_name, qf->input_fields[i]->field_name))
+      qf_field = qf->input_fields[i];
+  for (CeedInt i=0; i<qf->num_output_fields; i++)
+    if (!strcmp(field_name, qf->output_fields[i]->field_name))
+      qf_field = qf->output_fields[i];
+  if (!qf_field)
+    // LCOV_EXCL_START
+    return CeedError(qf->ceed, CEED_ERROR_INCOMPLETE,
+                     "QFunction has no knowledge of field '%s'", field_name);
+  // LCOV_EXCL_STOP
+
+  // Check shape
+  CeedInt n = 1;
+  while (n*n < qf_field->size) n++;
+  if (qf_field->eval_mode != CEED_EVAL_NONE || n*n != qf_field->size)
+    // LCOV_EXCL_START
+    return CeedError(qf->ceed, CEED_ERROR_INCOMPATIBLE,
+                     "Symmetric field '%s' must use CEED_EVAL_NONE and have "
+                     "a square size", field_name);
+  // LCOV_EXCL_STOP
+
+  qf_field->is_symmetric = true;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the CeedQFunctionFields of a CeedQFunction
 
@@ -674,6 +727,22 @@ int CeedQFunctionFieldGetEvalMode(CeedQFunctionField qf_field,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Check if a CeedQFunctionField is a symmetric tensor
+
+  @param qf_field           CeedQFunctionField
+  @param[out] is_symmetric  Variable to store symmetry status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedQFunctionFieldIsSymmetric(CeedQFunctionField qf_field,
+                                  bool *is_symmetric) {
+  *is_symmetric = qf_field->is_symmetric;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Set global context for a CeedQFunction
 
@@ -784,7 +853,8 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q,
 int CeedQFunctionDestroy(CeedQFunction *qf) {
   int ierr;
 
-  if (!*qf || --(*qf)->ref_count > 0) return CEED_ERROR_SUCCESS;
+  if (!*qf || CeedAtomicAdd((*qf)->ref_count, -1) > 0)
+    return CEED_ERROR_SUCCESS;
   // Backend destroy
   if ((*qf)->Destroy) {
     ierr = (*qf)->Destroy(*qf); CeedChk(ierr);
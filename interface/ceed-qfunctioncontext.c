@@ -19,10 +19,180 @@
 #include <ceed-impl.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 /// @file
 /// Implementation of public CeedQFunctionContext interfaces
 
+/// ----------------------------------------------------------------------------
+/// CeedQFunctionContext Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedQFunctionDeveloper
+/// @{
+
+/**
+  @brief Extend the range of context bytes modified since the backend last
+           cleared the dirty range
+
+  @param ctx    CeedQFunctionContext
+  @param begin  First modified byte
+  @param end    One past the last modified byte
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionContextMarkDirty(CeedQFunctionContext ctx, size_t begin,
+    size_t end) {
+  if (ctx->dirty_end <= ctx->dirty_begin) {
+    ctx->dirty_begin = begin;
+    ctx->dirty_end = end;
+  } else {
+    ctx->dirty_begin = begin < ctx->dirty_begin ? begin : ctx->dirty_begin;
+    ctx->dirty_end = end > ctx->dirty_end ? end : ctx->dirty_end;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Register a named field in CeedQFunctionContext data
+
+  @param ctx                CeedQFunctionContext
+  @param field_name         Name of field to register
+  @param field_offset       Offset of field in bytes
+  @param field_description  Description of field, or NULL for none
+  @param field_type         Data type of field
+  @param field_size         Size of field in bytes
+  @param num_values         Number of values in field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionContextRegisterGeneric(CeedQFunctionContext ctx,
+    const char *field_name, size_t field_offset, const char *field_description,
+    CeedContextFieldType field_type, size_t field_size, size_t num_values) {
+  int ierr;
+
+  // Check for duplicate names and out of range fields
+  CeedContextFieldLabel field_label = NULL;
+  ierr = CeedQFunctionContextGetFieldLabel(ctx, field_name, &field_label);
+  CeedChk(ierr);
+  if (field_label)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_UNSUPPORTED,
+                     "QFunctionContext field with name \"%s\" already "
+                     "registered", field_name);
+  // LCOV_EXCL_STOP
+  if (field_offset + field_size > ctx->ctx_size)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_DIMENSION,
+                     "QFunctionContext field \"%s\" extends past the end of "
+                     "the context data, %ld > %ld", field_name,
+                     field_offset + field_size, ctx->ctx_size);
+  // LCOV_EXCL_STOP
+
+  // Allocate space for field data
+  if (ctx->num_fields == ctx->max_fields) {
+    ctx->max_fields = ctx->max_fields ? 2*ctx->max_fields : 4;
+    ierr = CeedRealloc(ctx->max_fields, &ctx->field_labels); CeedChk(ierr);
+  }
+  ierr = CeedCalloc(1, &ctx->field_labels[ctx->num_fields]); CeedChk(ierr);
+  field_label = ctx->field_labels[ctx->num_fields];
+
+  // Copy field data
+  {
+    size_t len = strlen(field_name);
+    char *tmp;
+    ierr = CeedCalloc(len+1, &tmp); CeedChk(ierr);
+    memcpy(tmp, field_name, len+1);
+    field_label->name = tmp;
+  }
+  {
+    const char *description = field_description ? field_description : "";
+    size_t len = strlen(description);
+    char *tmp;
+    ierr = CeedCalloc(len+1, &tmp); CeedChk(ierr);
+    memcpy(tmp, description, len+1);
+    field_label->description = tmp;
+  }
+  field_label->type = field_type;
+  field_label->size = field_size;
+  field_label->num_values = num_values;
+  field_label->offset = field_offset;
+  ctx->num_fields++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write the values of a registered field in CeedQFunctionContext data,
+           recording the modified byte range
+
+  @param ctx          CeedQFunctionContext
+  @param field_label  Label of field to set
+  @param field_type   Data type of values
+  @param values       Values to write
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionContextSetGeneric(CeedQFunctionContext ctx,
+    CeedContextFieldLabel field_label, CeedContextFieldType field_type,
+    const void *values) {
+  int ierr;
+  bool is_registered = false;
+
+  if (!field_label)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_INCOMPLETE,
+                     "Invalid QFunctionContext field label");
+  // LCOV_EXCL_STOP
+  for (CeedInt i=0; i<ctx->num_fields; i++)
+    is_registered = is_registered || ctx->field_labels[i] == field_label;
+  if (!is_registered)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_INCOMPATIBLE,
+                     "QFunctionContext field \"%s\" is not registered with "
+                     "this context", field_label->name);
+  // LCOV_EXCL_STOP
+  if (field_label->type != field_type)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_INCOMPATIBLE,
+                     "QFunctionContext field \"%s\" registered as %s, "
+                     "not registered as %s", field_label->name,
+                     CeedContextFieldTypes[field_label->type],
+                     CeedContextFieldTypes[field_type]);
+  // LCOV_EXCL_STOP
+
+  if (ctx->state % 2 == 1)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_ACCESS,
+                     "Cannot set CeedQFunctionContext field, the access lock "
+                     "is already in use");
+  // LCOV_EXCL_STOP
+
+  if (ctx->num_readers > 0)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_ACCESS,
+                     "Cannot set CeedQFunctionContext field, a process has "
+                     "read access");
+  // LCOV_EXCL_STOP
+
+  // Write through the backend directly, only this byte range changes
+  char *data;
+  ierr = ctx->GetData(ctx, CEED_MEM_HOST, &data); CeedChk(ierr);
+  memcpy(&data[field_label->offset], values, field_label->size);
+  ierr = ctx->RestoreData(ctx); CeedChk(ierr);
+  ctx->state += 2;
+  ierr = CeedQFunctionContextMarkDirty(ctx, field_label->offset,
+                                       field_label->offset + field_label->size);
+  CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedQFunctionContext Backend API
 /// ----------------------------------------------------------------------------
@@ -89,6 +259,44 @@ int CeedQFunctionContextSetBackendData(CeedQFunctionContext ctx, void *data) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the range of context bytes modified since the last call to
+           @ref CeedQFunctionContextClearDirtyRange().
+
+  Backends that mirror the context data in another memory space may copy only
+    this range when synchronizing. The range is empty when `*end <= *begin`.
+
+  @param ctx         CeedQFunctionContext
+  @param[out] begin  Variable to store first modified byte
+  @param[out] end    Variable to store one past the last modified byte
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionContextGetDirtyRange(CeedQFunctionContext ctx, size_t *begin,
+                                      size_t *end) {
+  *begin = ctx->dirty_begin;
+  *end = ctx->dirty_end;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Clear the range of modified context bytes, after the backend has
+           synchronized its copies of the context data
+
+  @param ctx  CeedQFunctionContext
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionContextClearDirtyRange(CeedQFunctionContext ctx) {
+  ctx->dirty_begin = 0;
+  ctx->dirty_end = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Increment the reference counter for a CeedQFunctionContext
 
@@ -99,7 +307,7 @@ int CeedQFunctionContextSetBackendData(CeedQFunctionContext ctx, void *data) {
   @ref Backend
 **/
 int CeedQFunctionContextReference(CeedQFunctionContext ctx) {
-  ctx->ref_count++;
+  CeedAtomicAdd(ctx->ref_count, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -209,6 +417,7 @@ int CeedQFunctionContextSetData(CeedQFunctionContext ctx, CeedMemType mem_type,
   ctx->ctx_size = size;
   ierr = ctx->SetData(ctx, mem_type, copy_mode, data); CeedChk(ierr);
   ctx->state += 2;
+  ierr = CeedQFunctionContextMarkDirty(ctx, 0, size); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -275,15 +484,35 @@ int CeedQFunctionContextGetData(CeedQFunctionContext ctx, CeedMemType mem_type,
                      "Backend does not support GetData");
   // LCOV_EXCL_STOP
 
-  if (ctx->state % 2 == 1)
+  // Take the access lock before checking for readers; readers register
+  //   before checking the lock, so one of the two checks fails
+  uint64_t state = CeedAtomicLoad(ctx->state);
+  if (state % 2 == 1 ||
+      !CeedAtomicCompareExchange(ctx->state, state, state + 1))
     // LCOV_EXCL_START
     return CeedError(ctx->ceed, 1,
                      "Cannot grant CeedQFunctionContext data access, the "
                      "access lock is already in use");
   // LCOV_EXCL_STOP
 
-  ierr = ctx->GetData(ctx, mem_type, data); CeedChk(ierr);
-  ctx->state += 1;
+  if (CeedAtomicLoad(ctx->num_readers) > 0) {
+    // LCOV_EXCL_START
+    CeedAtomicAdd(ctx->state, -1);
+    return CeedError(ctx->ceed, CEED_ERROR_ACCESS,
+                     "Cannot grant CeedQFunctionContext data access, a "
+                     "process has read access");
+    // LCOV_EXCL_STOP
+  }
+
+  ierr = ctx->GetData(ctx, mem_type, data);
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedAtomicAdd(ctx->state, -1);
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+  // Any byte may be written through the returned pointer
+  ierr = CeedQFunctionContextMarkDirty(ctx, 0, ctx->ctx_size); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -315,7 +544,71 @@ int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx, void *data) {
 
   ierr = ctx->RestoreData(ctx); CeedChk(ierr);
   *(void **)data = NULL;
-  ctx->state += 1;
+  CeedAtomicAdd(ctx->state, 1);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get read-only access to a CeedQFunctionContext via the specified memory
+           type. Restore access with @ref CeedQFunctionContextRestoreDataRead().
+
+  Any number of readers, possibly on different threads, may hold read-only
+    access at the same time.
+
+  @param ctx        CeedQFunctionContext to access
+  @param mem_type   Memory type on which to access the data. If the backend
+                      uses a different memory type, this will perform a copy.
+  @param[out] data  Data on memory type mem_type
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextGetDataRead(CeedQFunctionContext ctx,
+                                    CeedMemType mem_type, void *data) {
+  int ierr;
+
+  if (!ctx->GetData)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Backend does not support GetData");
+  // LCOV_EXCL_STOP
+
+  // Register as a reader before checking the access lock, see
+  //   CeedQFunctionContextGetData()
+  CeedAtomicAdd(ctx->num_readers, 1);
+  if (CeedAtomicLoad(ctx->state) % 2 == 1) {
+    // LCOV_EXCL_START
+    CeedAtomicAdd(ctx->num_readers, -1);
+    return CeedError(ctx->ceed, CEED_ERROR_ACCESS,
+                     "Cannot grant CeedQFunctionContext read-only data "
+                     "access, the access lock is already in use");
+    // LCOV_EXCL_STOP
+  }
+
+  ierr = ctx->GetData(ctx, mem_type, data);
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedAtomicAdd(ctx->num_readers, -1);
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Restore data obtained using @ref CeedQFunctionContextGetDataRead()
+
+  @param ctx   CeedQFunctionContext to restore
+  @param data  Data to restore
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextRestoreDataRead(CeedQFunctionContext ctx, void *data) {
+  *(void **)data = NULL;
+  CeedAtomicAdd(ctx->num_readers, -1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -335,6 +628,145 @@ int CeedQFunctionContextGetContextSize(CeedQFunctionContext ctx,
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Register a named field of double precision values in
+           CeedQFunctionContext data
+
+  Registered fields may be updated with @ref CeedQFunctionContextSetDouble(),
+    which records the modified bytes so backends need not synchronize the
+    entire context data.
+
+  @param ctx                CeedQFunctionContext
+  @param field_name         Name of field to register
+  @param field_offset       Offset of field in the context data, in bytes
+  @param num_values         Number of values in field
+  @param field_description  Description of field, or NULL for none
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextRegisterDouble(CeedQFunctionContext ctx,
+                                       const char *field_name, size_t field_offset,
+                                       size_t num_values,
+                                       const char *field_description) {
+  return CeedQFunctionContextRegisterGeneric(ctx, field_name, field_offset,
+         field_description, CEED_CONTEXT_FIELD_DOUBLE,
+         num_values*sizeof(double), num_values);
+}
+
+/**
+  @brief Register a named field of 32 bit integer values in
+           CeedQFunctionContext data
+
+  @param ctx                CeedQFunctionContext
+  @param field_name         Name of field to register
+  @param field_offset       Offset of field in the context data, in bytes
+  @param num_values         Number of values in field
+  @param field_description  Description of field, or NULL for none
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextRegisterInt32(CeedQFunctionContext ctx,
+                                      const char *field_name, size_t field_offset,
+                                      size_t num_values,
+                                      const char *field_description) {
+  return CeedQFunctionContextRegisterGeneric(ctx, field_name, field_offset,
+         field_description, CEED_CONTEXT_FIELD_INT32,
+         num_values*sizeof(int), num_values);
+}
+
+/**
+  @brief Get the label for a registered field in CeedQFunctionContext data
+
+  @param ctx               CeedQFunctionContext
+  @param field_name        Name of field to retrieve label
+  @param[out] field_label  Variable to store field label, or NULL if no field
+                             with this name is registered
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextGetFieldLabel(CeedQFunctionContext ctx,
+                                      const char *field_name,
+                                      CeedContextFieldLabel *field_label) {
+  *field_label = NULL;
+  for (CeedInt i=0; i<ctx->num_fields; i++)
+    if (!strcmp(ctx->field_labels[i]->name, field_name)) {
+      *field_label = ctx->field_labels[i];
+      break;
+    }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the values of a registered double precision field in
+           CeedQFunctionContext data
+
+  Only the bytes of this field are marked as modified, so this is a cheap way
+    to update values such as the current time between operator applications.
+
+  @param ctx          CeedQFunctionContext
+  @param field_label  Label of field to set
+  @param values       Values to set, of length given at registration
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextSetDouble(CeedQFunctionContext ctx,
+                                  CeedContextFieldLabel field_label,
+                                  const double *values) {
+  return CeedQFunctionContextSetGeneric(ctx, field_label,
+                                        CEED_CONTEXT_FIELD_DOUBLE, values);
+}
+
+/**
+  @brief Set the values of a registered 32 bit integer field in
+           CeedQFunctionContext data
+
+  @param ctx          CeedQFunctionContext
+  @param field_label  Label of field to set
+  @param values       Values to set, of length given at registration
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextSetInt32(CeedQFunctionContext ctx,
+                                 CeedContextFieldLabel field_label,
+                                 const int *values) {
+  return CeedQFunctionContextSetGeneric(ctx, field_label,
+                                        CEED_CONTEXT_FIELD_INT32, values);
+}
+
+/**
+  @brief Get the description of a registered CeedQFunctionContext field
+
+  @param label                   CeedContextFieldLabel
+  @param[out] field_name         Variable to store field name, or NULL
+  @param[out] field_description  Variable to store field description, or NULL
+  @param[out] num_values         Variable to store number of values, or NULL
+  @param[out] field_type         Variable to store field data type, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedContextFieldLabelGetDescription(CeedContextFieldLabel label,
+                                        const char **field_name,
+                                        const char **field_description,
+                                        size_t *num_values,
+                                        CeedContextFieldType *field_type) {
+  if (field_name) *field_name = label->name;
+  if (field_description) *field_description = label->description;
+  if (num_values) *num_values = label->num_values;
+  if (field_type) *field_type = label->type;
+  return CEED_ERROR_SUCCESS;
+}
 
 /**
   @brief View a CeedQFunctionContext
@@ -349,6 +781,11 @@ int CeedQFunctionContextGetContextSize(CeedQFunctionContext ctx,
 int CeedQFunctionContextView(CeedQFunctionContext ctx, FILE *stream) {
   fprintf(stream, "CeedQFunctionContext\n");
   fprintf(stream, "  Context Data Size: %ld\n", ctx->ctx_size);
+  for (CeedInt i=0; i<ctx->num_fields; i++)
+    fprintf(stream, "  Labeled %s field: %s (%ld values at offset %ld)\n",
+            CeedContextFieldTypes[ctx->field_labels[i]->type],
+            ctx->field_labels[i]->name, ctx->field_labels[i]->num_values,
+            ctx->field_labels[i]->offset);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -364,7 +801,7 @@ int CeedQFunctionContextView(CeedQFunctionContext ctx, FILE *stream) {
 int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
   int ierr;
 
-  if (!*ctx || --(*ctx)->ref_count > 0)
+  if (!*ctx || CeedAtomicAdd((*ctx)->ref_count, -1) > 0)
     return CEED_ERROR_SUCCESS;
 
   if ((*ctx) && ((*ctx)->state % 2) == 1)
@@ -377,6 +814,12 @@ int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
   if ((*ctx)->Destroy) {
     ierr = (*ctx)->Destroy(*ctx); CeedChk(ierr);
   }
+  for (CeedInt i=0; i<(*ctx)->num_fields; i++) {
+    ierr = CeedFree(&(*ctx)->field_labels[i]->name); CeedChk(ierr);
+    ierr = CeedFree(&(*ctx)->field_labels[i]->description); CeedChk(ierr);
+    ierr = CeedFree(&(*ctx)->field_labels[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&(*ctx)->field_labels); CeedChk(ierr);
   ierr = CeedDestroy(&(*ctx)->ceed); CeedChk(ierr);
   ierr = CeedFree(ctx); CeedChk(ierr);
   return CEED_ERROR_SUCCESS;
@@ -159,7 +159,7 @@ int CeedTensorContractSetData(CeedTensorContract contract, void *data) {
   @ref Backend
 **/
 int CeedTensorContractReference(CeedTensorContract contract) {
-  contract->ref_count++;
+  CeedAtomicAdd(contract->ref_count, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -175,7 +175,8 @@ int CeedTensorContractReference(CeedTensorContract contract) {
 int CeedTensorContractDestroy(CeedTensorContract *contract) {
   int ierr;
 
-  if (!*contract || --(*contract)->ref_count > 0) return CEED_ERROR_SUCCESS;
+  if (!*contract || CeedAtomicAdd((*contract)->ref_count, -1) > 0)
+    return CEED_ERROR_SUCCESS;
   if ((*contract)->Destroy) {
     ierr = (*contract)->Destroy(*contract); CeedChk(ierr);
   }
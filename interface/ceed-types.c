@@ -60,6 +60,17 @@ const char *const CeedQuadModes[] = {
   [CEED_GAUSS_LOBATTO] = "Gauss Lobatto",
 };
 
+const char *const CeedQDataStorages[] = {
+  [CEED_QDATA_SCALAR] = "scalar",
+  [CEED_QDATA_FP32] = "fp32",
+  [CEED_QDATA_BF16] = "bf16",
+};
+
+const char *const CeedContextFieldTypes[] = {
+  [CEED_CONTEXT_FIELD_DOUBLE] = "double",
+  [CEED_CONTEXT_FIELD_INT32] = "int32",
+};
+
 const char *const CeedElemTopologies[] = {
   [CEED_LINE] = "line",
   [CEED_TRIANGLE] = "triangle",
@@ -41,6 +41,156 @@ const CeedVector CEED_VECTOR_NONE = &ceed_vector_none;
 
 /// @}
 
+/// ----------------------------------------------------------------------------
+/// CeedVector Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedVectorDeveloper
+/// @{
+
+/// Reductions computed by the host reduction engine
+typedef enum {
+  CEED_REDUCE_SUM_ABS,
+  CEED_REDUCE_SUM_SQUARES,
+  CEED_REDUCE_MAX_ABS,
+  CEED_REDUCE_DOT,
+} CeedReduceType;
+
+/// Number of independent accumulators in a block reduction
+#define CEED_REDUCE_LANES 8
+/// Number of entries reduced by one block; blocks are combined pairwise
+#define CEED_REDUCE_BLOCK_SIZE 2048
+
+/**
+  @brief Combine two partial reductions
+
+  @param[in] type  Reduction type
+  @param[in] a     First partial reduction
+  @param[in] b     Second partial reduction
+
+  @return Combined reduction
+
+  @ref Developer
+**/
+static inline CeedScalar CeedReduceCombine(CeedReduceType type, CeedScalar a,
+    CeedScalar b) {
+  if (type == CEED_REDUCE_MAX_ABS) return a > b ? a : b;
+  return a + b;
+}
+
+/**
+  @brief Reduce one block of entries with independent SIMD accumulators
+
+  @param[in] type  Reduction type
+  @param[in] n     Number of entries, at most @ref CEED_REDUCE_BLOCK_SIZE
+  @param[in] x     First array
+  @param[in] y     Second array for @ref CEED_REDUCE_DOT, otherwise unused
+
+  @return Block reduction
+
+  @ref Developer
+**/
+static CeedScalar CeedReduceBlock(CeedReduceType type, CeedInt n,
+                                  const CeedScalar *x, const CeedScalar *y) {
+  CeedScalar acc[CEED_REDUCE_LANES] = {0.};
+  const CeedInt n_lanes = n - n % CEED_REDUCE_LANES;
+
+  switch (type) {
+  case CEED_REDUCE_SUM_ABS:
+    for (CeedInt i=0; i<n_lanes; i+=CEED_REDUCE_LANES)
+      CeedPragmaSIMD
+      for (CeedInt l=0; l<CEED_REDUCE_LANES; l++)
+        acc[l] += fabs(x[i+l]);
+    for (CeedInt i=n_lanes; i<n; i++)
+      acc[i-n_lanes] += fabs(x[i]);
+    break;
+  case CEED_REDUCE_SUM_SQUARES:
+    for (CeedInt i=0; i<n_lanes; i+=CEED_REDUCE_LANES)
+      CeedPragmaSIMD
+      for (CeedInt l=0; l<CEED_REDUCE_LANES; l++)
+        acc[l] += x[i+l]*x[i+l];
+    for (CeedInt i=n_lanes; i<n; i++)
+      acc[i-n_lanes] += x[i]*x[i];
+    break;
+  case CEED_REDUCE_MAX_ABS:
+    for (CeedInt i=0; i<n_lanes; i+=CEED_REDUCE_LANES)
+      CeedPragmaSIMD
+      for (CeedInt l=0; l<CEED_REDUCE_LANES; l++)
+        acc[l] = acc[l] > fabs(x[i+l]) ? acc[l] : fabs(x[i+l]);
+    for (CeedInt i=n_lanes; i<n; i++)
+      acc[i-n_lanes] = acc[i-n_lanes] > fabs(x[i]) ? acc[i-n_lanes] : fabs(x[i]);
+    break;
+  case CEED_REDUCE_DOT:
+    for (CeedInt i=0; i<n_lanes; i+=CEED_REDUCE_LANES)
+      CeedPragmaSIMD
+      for (CeedInt l=0; l<CEED_REDUCE_LANES; l++)
+        acc[l] += x[i+l]*y[i+l];
+    for (CeedInt i=n_lanes; i<n; i++)
+      acc[i-n_lanes] += x[i]*y[i];
+    break;
+  }
+
+  // Pairwise combination of accumulators
+  for (CeedInt width=CEED_REDUCE_LANES/2; width>0; width/=2)
+    for (CeedInt l=0; l<width; l++)
+      acc[l] = CeedReduceCombine(type, acc[l], acc[l+width]);
+  return acc[0];
+}
+
+/**
+  @brief Reduce a host array with the host reduction engine
+
+  The array is divided into fixed blocks of @ref CEED_REDUCE_BLOCK_SIZE entries,
+    each reduced with independent SIMD accumulators, and the block results are
+    combined pairwise. The order of operations depends only on the length of
+    the array, so the result is bitwise reproducible, including when blocks
+    are reduced by several OpenMP threads. Pairwise combination bounds the
+    rounding error growth by the logarithm of the length.
+
+  @param[in] type     Reduction type
+  @param[in] n        Length of arrays
+  @param[in] x        First array
+  @param[in] y        Second array for @ref CEED_REDUCE_DOT, otherwise NULL
+  @param[out] result  Variable to store reduction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedReduce_Host(CeedReduceType type, CeedInt n,
+                           const CeedScalar *x, const CeedScalar *y,
+                           CeedScalar *result) {
+  int ierr;
+  const CeedInt num_blocks = (n + CEED_REDUCE_BLOCK_SIZE - 1) /
+                             CEED_REDUCE_BLOCK_SIZE;
+
+  if (num_blocks <= 1) {
+    *result = CeedReduceBlock(type, n, x, y);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedScalar *block_results;
+  ierr = CeedMalloc(num_blocks, &block_results); CeedChk(ierr);
+#ifdef _OPENMP
+  #pragma omp parallel for if (num_blocks > 16)
+#endif
+  for (CeedInt b=0; b<num_blocks; b++) {
+    const CeedInt start = b*CEED_REDUCE_BLOCK_SIZE;
+    const CeedInt size = CeedIntMin(CEED_REDUCE_BLOCK_SIZE, n - start);
+    block_results[b] = CeedReduceBlock(type, size, &x[start],
+                                       y ? &y[start] : NULL);
+  }
+  // Pairwise combination of blocks
+  for (CeedInt width=1; width<num_blocks; width*=2)
+    for (CeedInt b=0; b+width<num_blocks; b+=2*width)
+      block_results[b] = CeedReduceCombine(type, block_results[b],
+                                           block_results[b+width]);
+  *result = block_results[0];
+  ierr = CeedFree(&block_results); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedVector Backend API
 /// ----------------------------------------------------------------------------
@@ -72,7 +222,7 @@ int CeedVectorGetState(CeedVector vec, uint64_t *state) {
   @ref Backend
 **/
 int CeedVectorAddReference(CeedVector vec) {
-  vec->ref_count++;
+  CeedAtomicAdd(vec->ref_count, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -116,7 +266,76 @@ int CeedVectorSetData(CeedVector vec, void *data) {
   @ref Backend
 **/
 int CeedVectorReference(CeedVector vec) {
-  vec->ref_count++;
+  CeedAtomicAdd(vec->ref_count, 1);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Check if a CeedVector holds a uniform value that has not yet been
+           written to its array by @ref CeedVectorSetValue()
+
+  @param vec              CeedVector to check
+  @param[out] is_uniform  Variable to store uniform status
+  @param[out] value       Variable to store uniform value, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedVectorIsUniform(CeedVector vec, bool *is_uniform, CeedScalar *value) {
+  *is_uniform = CeedAtomicLoad(vec->is_uniform);
+  if (value && *is_uniform) *value = vec->uniform_value;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write the pending uniform value of a CeedVector to its array.
+           Backends that access the data of a CeedVector without
+           @ref CeedVectorGetArray() or @ref CeedVectorGetArrayRead() must call
+           this first.
+
+  Readers on several threads may call this concurrently. One of them writes
+    the array while the others wait, and the vector is only marked as
+    materialized once the array holds the value.
+
+  @param vec  CeedVector to materialize
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedVectorMaterialize(CeedVector vec) {
+  int ierr;
+
+  while (CeedAtomicLoad(vec->is_uniform)) {
+    bool is_materializing = false;
+    if (CeedAtomicCompareExchange(vec->is_materializing, is_materializing,
+                                  true)) {
+      // The array is written through the backend only, so the vector stays
+      //   marked uniform until it holds the value
+      ierr = CEED_ERROR_SUCCESS;
+      if (CeedAtomicLoad(vec->is_uniform)) {
+        if (vec->SetValue) {
+          ierr = vec->SetValue(vec, vec->uniform_value);
+        } else {
+          CeedScalar *array;
+          ierr = vec->GetArray(vec, CEED_MEM_HOST, &array);
+          if (!ierr) {
+            for (CeedInt i=0; i<vec->length; i++) array[i] = vec->uniform_value;
+            ierr = vec->RestoreArray(vec);
+          }
+        }
+        if (!ierr) CeedAtomicStore(vec->is_uniform, false);
+      }
+      CeedAtomicStore(vec->is_materializing, false);
+      CeedChk(ierr);
+      return CEED_ERROR_SUCCESS;
+    }
+    // Another reader is writing the array
+    while (CeedAtomicLoad(vec->is_materializing)) {}
+  }
+  // Return only once no reader is writing the array
+  while (CeedAtomicLoad(vec->is_materializing)) {}
   return CEED_ERROR_SUCCESS;
 }
 
@@ -228,6 +447,8 @@ int CeedVectorSetArray(CeedVector vec, CeedMemType mem_type,
                      "Cannot grant CeedVector array access, a "
                      "process has read access");
 
+  CeedAtomicStore(vec->is_uniform, false);
+  vec->is_borrowed = copy_mode == CEED_USE_POINTER;
   ierr = vec->SetArray(vec, mem_type, copy_mode, array); CeedChk(ierr);
   vec->state += 2;
   return CEED_ERROR_SUCCESS;
@@ -236,6 +457,11 @@ int CeedVectorSetArray(CeedVector vec, CeedMemType mem_type,
 /**
   @brief Set the CeedVector to a constant value
 
+  Unless the CeedVector uses an array provided with @ref CEED_USE_POINTER, the
+    value is only written to the array on the next array access. Element
+    restriction and interpolation of such a CeedVector produce uniform
+    values without reading it.
+
   @param vec        CeedVector
   @param[in] value  Value to be used
 
@@ -251,7 +477,10 @@ int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
                      "Cannot grant CeedVector array access, the "
                      "access lock is already in use");
 
-  if (vec->SetValue) {
+  if (!vec->is_borrowed) {
+    vec->is_uniform = true;
+    vec->uniform_value = value;
+  } else if (vec->SetValue) {
     ierr = vec->SetValue(vec, value); CeedChk(ierr);
   } else {
     CeedScalar *array;
@@ -284,6 +513,7 @@ int CeedVectorSyncArray(CeedVector vec, CeedMemType mem_type) {
                      "Cannot sync CeedVector, the access lock is "
                      "already in use");
 
+  ierr = CeedVectorMaterialize(vec); CeedChk(ierr);
   if (vec->SyncArray) {
     ierr = vec->SyncArray(vec, mem_type); CeedChk(ierr);
   } else {
@@ -326,8 +556,10 @@ int CeedVectorTakeArray(CeedVector vec, CeedMemType mem_type,
                      "has read access");
   // LCOV_EXCL_STOP
 
+  ierr = CeedVectorMaterialize(vec); CeedChk(ierr);
   CeedScalar *temp_array = NULL;
   ierr = vec->TakeArray(vec, mem_type, &temp_array); CeedChk(ierr);
+  vec->is_borrowed = false;
   if (array) (*array) = temp_array;
   return CEED_ERROR_SUCCESS;
 }
@@ -370,6 +602,7 @@ int CeedVectorGetArray(CeedVector vec, CeedMemType mem_type,
                      "Cannot grant CeedVector array access, a "
                      "process has read access");
 
+  ierr = CeedVectorMaterialize(vec); CeedChk(ierr);
   ierr = vec->GetArray(vec, mem_type, array); CeedChk(ierr);
   vec->state += 1;
   return CEED_ERROR_SUCCESS;
@@ -404,8 +637,9 @@ int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mem_type,
                      "Cannot grant CeedVector read-only array "
                      "access, the access lock is already in use");
 
+  ierr = CeedVectorMaterialize(vec); CeedChk(ierr);
   ierr = vec->GetArrayRead(vec, mem_type, array); CeedChk(ierr);
-  vec->num_readers++;
+  CeedAtomicAdd(vec->num_readers, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -460,7 +694,7 @@ int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
 
   ierr = vec->RestoreArrayRead(vec); CeedChk(ierr);
   *array = NULL;
-  vec->num_readers--;
+  CeedAtomicAdd(vec->num_readers, -1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -482,6 +716,28 @@ int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
 int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   int ierr;
 
+  // Uniform vector
+  if (vec->is_uniform) {
+    if (vec->state % 2 == 1)
+      // LCOV_EXCL_START
+      return CeedError(vec->ceed, CEED_ERROR_ACCESS,
+                       "Cannot grant CeedVector read-only array "
+                       "access, the access lock is already in use");
+    // LCOV_EXCL_STOP
+    const CeedScalar abs_value = fabs(vec->uniform_value);
+    switch (norm_type) {
+    case CEED_NORM_1:
+      *norm = vec->length*abs_value;
+      break;
+    case CEED_NORM_2:
+      *norm = sqrt((CeedScalar)vec->length)*abs_value;
+      break;
+    case CEED_NORM_MAX:
+      *norm = vec->length ? abs_value : 0.;
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+
   // Backend impl for GPU, if added
   if (vec->Norm) {
     ierr = vec->Norm(vec, norm_type, norm); CeedChk(ierr);
@@ -491,24 +747,19 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   const CeedScalar *array;
   ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
 
-  *norm = 0.;
+  CeedReduceType reduce_type = CEED_REDUCE_SUM_ABS;
   switch (norm_type) {
   case CEED_NORM_1:
-    for (int i=0; i<vec->length; i++) {
-      *norm += fabs(array[i]);
-    }
+    reduce_type = CEED_REDUCE_SUM_ABS;
     break;
   case CEED_NORM_2:
-    for (int i=0; i<vec->length; i++) {
-      *norm += fabs(array[i])*fabs(array[i]);
-    }
+    reduce_type = CEED_REDUCE_SUM_SQUARES;
     break;
   case CEED_NORM_MAX:
-    for (int i=0; i<vec->length; i++) {
-      const CeedScalar abs_v_i = fabs(array[i]);
-      *norm = *norm > abs_v_i ? *norm : abs_v_i;
-    }
+    reduce_type = CEED_REDUCE_MAX_ABS;
   }
+  ierr = CeedReduce_Host(reduce_type, vec->length, array, NULL, norm);
+  CeedChk(ierr);
   if (norm_type == CEED_NORM_2)
     *norm = sqrt(*norm);
 
@@ -516,6 +767,71 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute the dot product of two CeedVectors
+
+  Note: This operation is local to the CeedVectors, as for @ref CeedVectorNorm().
+          The host computation is bitwise reproducible for a given length.
+
+  @param[in] x        First vector
+  @param[in] y        Second vector, may be the same as x
+  @param[out] result  Variable to store dot product
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result) {
+  int ierr;
+  CeedInt n_x, n_y;
+
+  ierr = CeedVectorGetLength(x, &n_x); CeedChk(ierr);
+  ierr = CeedVectorGetLength(y, &n_y); CeedChk(ierr);
+  if (n_x != n_y)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, CEED_ERROR_UNSUPPORTED,
+                     "Cannot compute dot product of vectors of different "
+                     "lengths");
+  // LCOV_EXCL_STOP
+
+  Ceed ceed_parent_x, ceed_parent_y;
+  ierr = CeedGetParent(x->ceed, &ceed_parent_x); CeedChk(ierr);
+  ierr = CeedGetParent(y->ceed, &ceed_parent_y); CeedChk(ierr);
+  if (ceed_parent_x != ceed_parent_y)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, CEED_ERROR_INCOMPATIBLE,
+                     "Vectors x and y must be created by the same Ceed context");
+  // LCOV_EXCL_STOP
+
+  // Uniform vectors
+  if (x->is_uniform && y->is_uniform) {
+    if (x->state % 2 == 1 || y->state % 2 == 1)
+      // LCOV_EXCL_START
+      return CeedError(x->ceed, CEED_ERROR_ACCESS,
+                       "Cannot grant CeedVector read-only array "
+                       "access, the access lock is already in use");
+    // LCOV_EXCL_STOP
+    *result = n_x * x->uniform_value * y->uniform_value;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Backend implementation
+  if (x->Dot) {
+    ierr = x->Dot(x, y, result); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Default implementation
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array); CeedChk(ierr);
+  ierr = CeedReduce_Host(CEED_REDUCE_DOT, n_x, x_array, y_array, result);
+  CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute x = alpha x
 
@@ -533,6 +849,19 @@ int CeedVectorScale(CeedVector x, CeedScalar alpha) {
 
   ierr = CeedVectorGetLength(x, &n_x); CeedChk(ierr);
 
+  // Uniform vector
+  if (x->is_uniform) {
+    if (x->state % 2 == 1)
+      // LCOV_EXCL_START
+      return CeedError(x->ceed, CEED_ERROR_ACCESS,
+                       "Cannot grant CeedVector array access, the "
+                       "access lock is already in use");
+    // LCOV_EXCL_STOP
+    x->uniform_value *= alpha;
+    x->state += 2;
+    return CEED_ERROR_SUCCESS;
+  }
+
   // Backend implementation
   if (x->Scale)
     return x->Scale(x, alpha);
@@ -585,6 +914,15 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
                      "Vectors x and y must be created by the same Ceed context");
   // LCOV_EXCL_STOP
 
+  // Uniform vectors
+  if (x->is_uniform && y->is_uniform && y->state % 2 == 0) {
+    y->uniform_value += alpha * x->uniform_value;
+    y->state += 2;
+    return CEED_ERROR_SUCCESS;
+  }
+  ierr = CeedVectorMaterialize(x); CeedChk(ierr);
+  ierr = CeedVectorMaterialize(y); CeedChk(ierr);
+
   // Backend implementation
   if (y->AXPY) {
     ierr = y->AXPY(y, alpha, x); CeedChk(ierr);
@@ -642,6 +980,16 @@ int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
                      "Vectors w, x, and y must be created by the same Ceed context");
   // LCOV_EXCL_STOP
 
+  // Uniform vectors
+  if (x->is_uniform && y->is_uniform && !w->is_borrowed && w->state % 2 == 0) {
+    const CeedScalar value = x->uniform_value * y->uniform_value;
+    ierr = CeedVectorSetValue(w, value); CeedChk(ierr);
+    return CEED_ERROR_SUCCESS;
+  }
+  ierr = CeedVectorMaterialize(x); CeedChk(ierr);
+  ierr = CeedVectorMaterialize(y); CeedChk(ierr);
+  ierr = CeedVectorMaterialize(w); CeedChk(ierr);
+
   // Backend implementation
   if (w->PointwiseMult) {
     ierr = w->PointwiseMult(w, x, y); CeedChk(ierr);
@@ -695,6 +1043,14 @@ int CeedVectorReciprocal(CeedVector vec) {
                      "CeedVector must have data set to take reciprocal");
   // LCOV_EXCL_STOP
 
+  // Uniform vector
+  if (vec->is_uniform && vec->state % 2 == 0) {
+    if (fabs(vec->uniform_value) > CEED_EPSILON)
+      vec->uniform_value = 1./vec->uniform_value;
+    vec->state += 2;
+    return CEED_ERROR_SUCCESS;
+  }
+
   // Backend impl for GPU, if added
   if (vec->Reciprocal) {
     ierr = vec->Reciprocal(vec); CeedChk(ierr);
@@ -781,7 +1137,8 @@ int CeedVectorGetLength(CeedVector vec, CeedInt *length) {
 int CeedVectorDestroy(CeedVector *vec) {
   int ierr;
 
-  if (!*vec || --(*vec)->ref_count > 0) return CEED_ERROR_SUCCESS;
+  if (!*vec || CeedAtomicAdd((*vec)->ref_count, -1) > 0)
+    return CEED_ERROR_SUCCESS;
 
   if (((*vec)->state % 2) == 1)
     return CeedError((*vec)->ceed, CEED_ERROR_ACCESS,
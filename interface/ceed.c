@@ -510,6 +510,25 @@ int CeedSetDeterministic(Ceed ceed, bool is_deterministic) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Flag Ceed context as able to apply operators with compressed
+           quadrature data
+
+  Backends that set this flag decode compressed fields with
+    CeedOperatorFieldDecompressQData() in the QFunction input stage.
+
+  @param ceed         Ceed to flag
+  @param has_support  Support status to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedSetCompressedQDataSupport(Ceed ceed, bool has_support) {
+  ceed->has_compressed_qdata = has_support;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Set a backend function
 
@@ -597,7 +616,7 @@ int CeedSetData(Ceed ceed, void *data) {
   @ref Backend
 **/
 int CeedReference(Ceed ceed) {
-  ceed->ref_count++;
+  CeedAtomicAdd(ceed->ref_count, 1);
   return CEED_ERROR_SUCCESS;
 }
 
@@ -756,6 +775,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(Ceed, VectorCreate),
     CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate),
     CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked),
+    CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateStructured),
     CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
     CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
     CEED_FTABLE_ENTRY(Ceed, TensorContractCreate),
@@ -771,6 +791,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedVector, RestoreArray),
     CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
     CEED_FTABLE_ENTRY(CeedVector, Norm),
+    CEED_FTABLE_ENTRY(CeedVector, Dot),
     CEED_FTABLE_ENTRY(CeedVector, Scale),
     CEED_FTABLE_ENTRY(CeedVector, AXPY),
     CEED_FTABLE_ENTRY(CeedVector, PointwiseMult),
@@ -778,9 +799,13 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedVector, Destroy),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Apply),
     CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyTransposeOverwrite),
     CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, RestoreOffsets),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, GetCompressedOffsets),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
     CEED_FTABLE_ENTRY(CeedBasis, Apply),
+    CEED_FTABLE_ENTRY(CeedBasis, ApplyAtPoints),
     CEED_FTABLE_ENTRY(CeedBasis, Destroy),
     CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
     CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
@@ -795,6 +820,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedQFunctionContext, Destroy),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunction),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunctionUpdate),
+    CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunctionElements),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleDiagonal),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddDiagonal),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssemblePointBlockDiagonal),
@@ -806,6 +832,9 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+    CEED_FTABLE_ENTRY(CeedOperator, ApplyAddMulti),
+    CEED_FTABLE_ENTRY(CeedOperator, ApplyAddElements),
+    CEED_FTABLE_ENTRY(CeedOperator, GetPassiveEVector),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
     CEED_FTABLE_ENTRY(CeedOperator, Destroy),
     {NULL, 0} // End of lookup table - used in SetBackendFunction loop
@@ -950,7 +979,8 @@ int CeedView(Ceed ceed, FILE *stream) {
 **/
 int CeedDestroy(Ceed *ceed) {
   int ierr;
-  if (!*ceed || --(*ceed)->ref_count > 0) return CEED_ERROR_SUCCESS;
+  if (!*ceed || CeedAtomicAdd((*ceed)->ref_count, -1) > 0)
+    return CEED_ERROR_SUCCESS;
   if ((*ceed)->delegate) {
     ierr = CeedDestroy(&(*ceed)->delegate); CeedChk(ierr);
   }
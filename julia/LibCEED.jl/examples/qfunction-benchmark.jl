@@ -0,0 +1,73 @@
+using LibCEED, Printf
+
+# Compare the throughput of Julia user Q-functions defined with @interior_qf
+# against the equivalent C gallery Q-functions, for the apply Q-functions of the
+# CEED bake-off problems BP1 (mass) and BP3 (diffusion).
+
+function time_qf(qf, Q, vin, vout; nrep)
+    # Warm up (JIT compilation of the user Q-function)
+    apply!(qf, Q, vin, vout)
+    allocs = @allocated apply!(qf, Q, vin, vout)
+    t = @elapsed for _ = 1:nrep
+        apply!(qf, Q, vin, vout)
+    end
+    return t/(nrep*Q), allocs
+end
+
+function report(name, (t_c, a_c), (t_jl, a_jl))
+    @printf(
+        "%-4s C: %8.3f ns/point (%d bytes)    Julia: %8.3f ns/point (%d bytes)    ratio: %.2f\n",
+        name,
+        1e9*t_c,
+        a_c,
+        1e9*t_jl,
+        a_jl,
+        t_jl/t_c,
+    )
+end
+
+function run_qfunction_benchmark(; ceed_spec, Q, nrep)
+    ceed = Ceed(ceed_spec)
+    dim = 3
+    nqd = dim*(dim + 1)÷2
+
+    # BP1: v = qdata*u
+    u = CeedVector(ceed, rand(CeedScalar, Q))
+    qdata = CeedVector(ceed, rand(CeedScalar, Q))
+    v = CeedVector(ceed, Q)
+    @interior_qf bp1_jl = (
+        ceed,
+        (u, :in, EVAL_INTERP),
+        (qdata, :in, EVAL_NONE),
+        (v, :out, EVAL_INTERP),
+        v[] = qdata*u,
+    )
+    bp1_c = create_interior_qfunction(ceed, "MassApply")
+    report(
+        "BP1",
+        time_qf(bp1_c, Q, [u, qdata], [v]; nrep=nrep),
+        time_qf(bp1_jl, Q, [u, qdata], [v]; nrep=nrep),
+    )
+
+    # BP3: dv = (w det(J) J^{-T} J^{-1}) du, with the symmetric matrix stored in
+    # Voigt notation
+    du = CeedVector(ceed, rand(CeedScalar, Q*dim))
+    qdata = CeedVector(ceed, rand(CeedScalar, Q*nqd))
+    dv = CeedVector(ceed, Q*dim)
+    @interior_qf bp3_jl = (
+        ceed,
+        dim=dim,
+        (du, :in, EVAL_GRAD, dim),
+        (qdata, :in, EVAL_NONE, dim*(dim + 1)÷2),
+        (dv, :out, EVAL_GRAD, dim),
+        dv .= getvoigt(qdata)*du,
+    )
+    bp3_c = create_interior_qfunction(ceed, "Poisson3DApply")
+    report(
+        "BP3",
+        time_qf(bp3_c, Q, [du, qdata], [dv]; nrep=nrep),
+        time_qf(bp3_jl, Q, [du, qdata], [dv]; nrep=nrep),
+    )
+end
+
+run_qfunction_benchmark(ceed_spec="/cpu/self", Q=64*1024, nrep=100)
@@ -51,8 +51,14 @@ function generate_user_qfunction(
             if ndims == 0
                 array_views[i] = :($arr_name = $slice)
             else
+                # Unroll the loads of all components, with statically known sizes, so that
+                # no view is created and the loads vectorize over the quadrature points
                 S = Tuple{dims...}
-                array_views[i] = :($arr_name = LibCEED.SArray{$S}(@view $slice))
+                loads = [
+                    Expr(:ref, arr_name_gen, idx, Tuple(I)...) for
+                    I ∈ CartesianIndices(Tuple(dims))
+                ]
+                array_views[i] = :($arr_name = LibCEED.SArray{$S}(($(loads...),)))
             end
         else
             array_views[i] = :($arr_name = @view $slice)
@@ -18,6 +18,19 @@ mutable struct CtxData
     x::Vector{Float64}
 end
 
+# Call the generated kernel of a user Q-function directly, bypassing libCEED
+function call_user_qf(qf, Q, in_ptrs, out_ptrs)
+    ccall(
+        qf.user_qf.fptr,
+        CeedInt,
+        (Ptr{Cvoid}, CeedInt, Ptr{Ptr{CeedScalar}}, Ptr{Ptr{CeedScalar}}),
+        C_NULL,
+        Q,
+        in_ptrs,
+        out_ptrs,
+    )
+end
+
 const run_dev_tests = !isrelease() || ("--run-dev-tests" in ARGS)
 
 if run_dev_tests
@@ -271,6 +284,29 @@ else
             @test String(take!(ctxdata.io)) == showstr(ctxdata.x)
             @test @witharray_read(v3 = cv3, v3[1] == v2[1]*sum(v1))
 
+            # Generated kernels do not allocate
+            @interior_qf poi_qf = (
+                c,
+                dim=dim,
+                (du, :in, EVAL_GRAD, dim),
+                (qdata, :in, EVAL_NONE, dim*(dim + 1)÷2),
+                (dv, :out, EVAL_GRAD, dim),
+                dv .= getvoigt(qdata)*du,
+            )
+            Q = 64
+            du = rand(CeedScalar, Q, dim)
+            qd = rand(CeedScalar, Q, dim*(dim + 1)÷2)
+            dv = zeros(CeedScalar, Q, dim)
+            GC.@preserve du qd dv begin
+                in_ptrs = [pointer(du), pointer(qd)]
+                out_ptrs = [pointer(dv)]
+                call_user_qf(poi_qf, Q, in_ptrs, out_ptrs)
+                @test (@allocated call_user_qf(poi_qf, Q, in_ptrs, out_ptrs)) == 0
+                @test all(
+                    dv[i, :] ≈ getvoigt(qd[i, :], CeedDim(dim))*du[i, :] for i = 1:Q
+                )
+            end
+
             @test QFunctionNone()[] == LibCEED.C.CEED_QFUNCTION_NONE[]
         end
 
@@ -57,6 +57,9 @@ with open(os.path.abspath("include/ceed/ceed.h")) as f:
     header = re.sub("va_list", "const char *", header)
 ffibuilder.cdef(header)
 
+# Note: cffi releases the GIL around every libCEED call, so operator
+#   application, assembly, basis, and restriction calls from different
+#   Python threads run concurrently
 ffibuilder.set_source("_ceed_cffi",
                       """
   #define va_list const char *
@@ -74,10 +74,15 @@ class QFunctionContext():
            data if applicable.
 
            Args:
-             *data: Numpy or Numba array to be used
+             *data: Numpy, Numba, or DLPack array to be used
              **memtype: memory type of the array being passed, default CEED_MEM_HOST
              **cmode: copy mode for the array, default CEED_COPY_VALUES"""
 
+        # Zero-copy view of a DLPack host buffer
+        if memtype == MEM_HOST and not hasattr(data, '__array_interface__') \
+                and hasattr(data, '__dlpack__'):
+            data = np.from_dlpack(data)
+
         # Store array reference if needed
         if cmode == USE_POINTER:
             self._array_reference = data
@@ -91,7 +96,7 @@ class QFunctionContext():
                 "void *",
                 data.__array_interface__['data'][0])
         else:
-            array_pointer = ffi.cast(
+            data_pointer = ffi.cast(
                 "void *",
                 data.__cuda_array_interface__['data'][0])
 
@@ -72,20 +72,21 @@ class Vector():
         """Set the array used by a Vector, freeing any previously allocated
            array if applicable.
 
+           Host arrays may be Numpy arrays or any object exposing
+           __array_interface__ or DLPack (__dlpack__), and device arrays may
+           be any object exposing __cuda_array_interface__. With
+           CEED_USE_POINTER the array is used without a copy, and the Vector
+           keeps a reference to it until it is replaced, taken with
+           take_array(), or the Vector is destroyed.
+
            Args:
-             *array: Numpy or Numba array to be used
+             *array: Numpy, Numba, or other foreign array to be used
              **memtype: memory type of the array being passed, default CEED_MEM_HOST
              **cmode: copy mode for the array, default CEED_COPY_VALUES"""
 
-        # Store array reference if needed
-        if cmode == USE_POINTER:
-            self._array_reference = array
-        else:
-            self._array_reference = None
-
-        # Setup the numpy array for the libCEED call
-        array_pointer = ffi.new("CeedScalar *")
+        # Setup the array for the libCEED call
         if memtype == MEM_HOST:
+            array = self._host_array(array, cmode)
             array_pointer = ffi.cast(
                 "CeedScalar *",
                 array.__array_interface__['data'][0])
@@ -99,6 +100,68 @@ class Vector():
             self._pointer[0], memtype, cmode, array_pointer)
         self._ceed._check_error(err_code)
 
+        # Store array reference if needed
+        if cmode == USE_POINTER:
+            self._array_reference = array
+        else:
+            self._array_reference = None
+
+    # Convert a foreign host array to a Numpy array usable by the Vector
+    def _host_array(self, array, cmode):
+        """Return a contiguous Numpy view of a host array, sharing memory with
+           the foreign array whenever the data type and layout allow it."""
+
+        # Zero-copy view of the foreign buffer
+        if not hasattr(array, '__array_interface__') and \
+                hasattr(array, '__dlpack__'):
+            array = np.from_dlpack(array)
+        array = np.asarray(array)
+        dtype = np.dtype(scalar_types[lib.CEED_SCALAR_TYPE])
+
+        # Borrowed arrays must match the Vector exactly
+        usable = array.dtype == dtype and array.flags['C_CONTIGUOUS']
+        if cmode == USE_POINTER:
+            if not usable:
+                raise ValueError("Array must be a contiguous " + dtype.name +
+                                 " array to be used with CEED_USE_POINTER")
+            if not array.flags['WRITEABLE']:
+                raise ValueError("Array must be writeable to be used with "
+                                 "CEED_USE_POINTER")
+        elif not usable:
+            array = np.ascontiguousarray(array, dtype=dtype)
+        if array.size < len(self):
+            raise ValueError("Array of size " + str(array.size) +
+                             " is too small for Vector of length " +
+                             str(len(self)))
+
+        return array
+
+    # Take Vector's data array
+    def take_array(self, memtype=MEM_HOST):
+        """Take back an array set with CEED_USE_POINTER, after which the
+           Vector no longer has an array and keeps no reference to it.
+
+           Args:
+             **memtype: memory type of the array to take, default CEED_MEM_HOST
+
+           Returns:
+             *array: the array passed to set_array()"""
+
+        if getattr(self, '_array_reference', None) is None:
+            raise ValueError("Vector has no array set with CEED_USE_POINTER")
+
+        # libCEED call
+        array_pointer = ffi.new("CeedScalar **")
+        err_code = lib.CeedVectorTakeArray(
+            self._pointer[0], memtype, array_pointer)
+        self._ceed._check_error(err_code)
+
+        # Release the reference
+        array = self._array_reference
+        self._array_reference = None
+
+        return array
+
     # Get Vector's data array
     def get_array(self, memtype=MEM_HOST):
         """Get read/write access to a Vector via the specified memory type.
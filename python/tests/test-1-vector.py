@@ -311,6 +311,89 @@ def test_123(ceed_resource, capsys):
     with x.array() as b:
         assert np.allclose(-.5 * a, b)
 
+# -------------------------------------------------------------------------------
+# Test zero-copy use of foreign host arrays
+# -------------------------------------------------------------------------------
+
+
+class DLPackArray:
+    """Host array exposing only the DLPack protocol"""
+
+    def __init__(self, array):
+        self._array = array
+
+    def __dlpack__(self, **kwargs):
+        return self._array.__dlpack__(**kwargs)
+
+    def __dlpack_device__(self):
+        return self._array.__dlpack_device__()
+
+
+class InterfaceArray:
+    """Host array exposing only the array interface"""
+
+    def __init__(self, array):
+        self.__array_interface__ = array.__array_interface__
+        self._array = array
+
+
+def test_130(ceed_resource):
+    ceed = libceed.Ceed(ceed_resource)
+
+    n = 10
+    x = ceed.Vector(n)
+
+    for wrap in [DLPackArray, InterfaceArray]:
+        a = np.arange(10, 10 + n, dtype=ceed.scalar_type())
+        x.set_array(wrap(a), cmode=libceed.USE_POINTER)
+        x.scale(2.0)
+        with x.array_read() as b:
+            assert np.shares_memory(a, b)
+        assert np.allclose(a, 2 * np.arange(10, 10 + n))
+
+    # Arrays that cannot be borrowed are copied or rejected
+    a = np.arange(2 * n, dtype="int32")[::2]
+    x.set_array(a, cmode=libceed.COPY_VALUES)
+    with x.array_read() as b:
+        assert np.allclose(a, b)
+    exception_raised = False
+    try:
+        x.set_array(a, cmode=libceed.USE_POINTER)
+    except ValueError:
+        exception_raised = True
+
+    assert exception_raised
+
+# -------------------------------------------------------------------------------
+# Test lifetime of borrowed arrays
+# -------------------------------------------------------------------------------
+
+
+def test_131(ceed_resource):
+    import gc
+    import weakref
+
+    ceed = libceed.Ceed(ceed_resource)
+
+    n = 10
+    x = ceed.Vector(n)
+
+    a = np.arange(10, 10 + n, dtype=ceed.scalar_type())
+    a_ref = weakref.ref(a)
+    x.set_array(a, cmode=libceed.USE_POINTER)
+    del a
+    gc.collect()
+    assert a_ref() is not None
+
+    with x.array_read() as b:
+        assert np.allclose(b, np.arange(10, 10 + n))
+
+    a = x.take_array()
+    assert a is a_ref()
+    del a
+    gc.collect()
+    assert a_ref() is None
+
 # -------------------------------------------------------------------------------
 # Test modification of reshaped array
 # -------------------------------------------------------------------------------
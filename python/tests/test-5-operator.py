@@ -1964,3 +1964,81 @@ def test_553(ceed_resource):
         assert abs(total - 1.0) < TOL
 
 # -------------------------------------------------------------------------------
+# Test concurrent application of operators from Python threads
+# -------------------------------------------------------------------------------
+
+
+def test_560(ceed_resource):
+    from concurrent.futures import ThreadPoolExecutor
+
+    nelem = 15
+    p = 5
+    q = 8
+    nx = nelem + 1
+    nu = nelem * (p - 1) + 1
+    napply = 20
+
+    ceed = libceed.Ceed(ceed_resource)
+
+    # Vectors
+    x = ceed.Vector(nx)
+    x.set_array(np.linspace(0, 1, nx, dtype=ceed.scalar_type()))
+    qdata = ceed.Vector(nelem * q)
+
+    # Restrictions
+    indx = np.zeros(nx * 2, dtype="int32")
+    for i in range(nx):
+        indx[2 * i + 0] = i
+        indx[2 * i + 1] = i + 1
+    rx = ceed.ElemRestriction(nelem, 2, 1, 1, nx, indx)
+    indu = np.zeros(nelem * p, dtype="int32")
+    for i in range(nelem):
+        for j in range(p):
+            indu[p * i + j] = i * (p - 1) + j
+    ru = ceed.ElemRestriction(nelem, p, 1, 1, nu, indu)
+    strides = np.array([1, q, q], dtype="int32")
+    rui = ceed.StridedElemRestriction(nelem, q, 1, q * nelem, strides)
+
+    # Bases
+    bx = ceed.BasisTensorH1Lagrange(1, 1, 2, q, libceed.GAUSS)
+    bu = ceed.BasisTensorH1Lagrange(1, 1, p, q, libceed.GAUSS)
+
+    # QFunctions
+    qf_setup = ceed.QFunctionByName("Mass1DBuild")
+    qf_mass = ceed.QFunctionByName("MassApply")
+
+    # Setup
+    op_setup = ceed.Operator(qf_setup)
+    op_setup.set_field("dx", rx, bx, libceed.VECTOR_ACTIVE)
+    op_setup.set_field("weights", libceed.ELEMRESTRICTION_NONE, bx,
+                       libceed.VECTOR_NONE)
+    op_setup.set_field("qdata", rui, libceed.BASIS_COLLOCATED,
+                       libceed.VECTOR_ACTIVE)
+    op_setup.apply(x, qdata)
+
+    # One mass operator per thread, sharing all other objects
+    op_mass = []
+    for thread in range(4):
+        op = ceed.Operator(qf_mass)
+        op.set_field("u", ru, bu, libceed.VECTOR_ACTIVE)
+        op.set_field("qdata", rui, libceed.BASIS_COLLOCATED, qdata)
+        op.set_field("v", ru, bu, libceed.VECTOR_ACTIVE)
+        op_mass.append(op)
+
+    # Each thread applies its own operator; libCEED calls release the GIL
+    def apply_mass(thread):
+        u = ceed.Vector(nu)
+        v = ceed.Vector(nu)
+        u.set_value(1.0 + thread)
+        for i in range(napply):
+            op_mass[thread].apply(u, v)
+        with v.array_read() as v_array:
+            return np.sum(v_array)
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        totals = list(executor.map(apply_mass, range(4)))
+
+    for thread in range(4):
+        assert abs(totals[thread] - (1.0 + thread)) < TOL
+
+# -------------------------------------------------------------------------------
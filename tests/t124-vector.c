@@ -0,0 +1,91 @@
+/// @file
+/// Test uniform vectors set with CeedVectorSetValue
+/// \test Test uniform vectors set with CeedVectorSetValue
+#include <ceed.h>
+#include <math.h>
+
+static void CheckValues(const char *name, CeedVector x, CeedScalar value) {
+  CeedInt n;
+  const CeedScalar *b;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(b[i] - value) > 1e-14)
+      // LCOV_EXCL_START
+      printf("%s [%d] computed: %f actual: %f\n", name, i, b[i], value);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &b);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, u, v;
+  CeedElemRestriction r;
+  CeedBasis basis;
+  CeedInt n = 10, num_elem = 3, P = 4, Q = 5;
+  CeedInt ind[num_elem*P];
+  CeedScalar a[10], norm;
+
+  CeedInit(argv[1], &ceed);
+
+  // Vector operations
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+  CeedVectorSetValue(x, 2.0);
+  CeedVectorSetValue(y, 1.0);
+  CeedVectorScale(x, -0.5);
+  CeedVectorAXPY(y, 3.0, x);
+  CeedVectorNorm(y, CEED_NORM_1, &norm);
+  if (fabs(norm - 20.0) > 1e-14)
+    // LCOV_EXCL_START
+    printf("Error in 1-norm, computed: %f actual: %f\n", norm, 20.0);
+  // LCOV_EXCL_STOP
+  CeedVectorNorm(y, CEED_NORM_2, &norm);
+  if (fabs(norm - 2.0*sqrt(10.0)) > 1e-14)
+    // LCOV_EXCL_START
+    printf("Error in 2-norm, computed: %f actual: %f\n", norm, 2.0*sqrt(10.0));
+  // LCOV_EXCL_STOP
+  CeedVectorReciprocal(y);
+  CheckValues("Uniform vector", y, -0.5);
+
+  // Borrowed arrays are written immediately
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, a);
+  CeedVectorSetValue(x, 4.0);
+  for (CeedInt i=0; i<n; i++)
+    if (a[i] != 4.0)
+      // LCOV_EXCL_START
+      printf("Borrowed array [%d] computed: %f actual: %f\n", i, a[i], 4.0);
+  // LCOV_EXCL_STOP
+  CeedVectorTakeArray(x, CEED_MEM_HOST, NULL);
+  CeedVectorDestroy(&x);
+
+  // Restriction and interpolation
+  for (CeedInt i=0; i<num_elem; i++)
+    for (CeedInt j=0; j<P; j++)
+      ind[P*i+j] = i*(P-1) + j;
+  CeedElemRestrictionCreate(ceed, num_elem, P, 1, 1, num_elem*(P-1)+1,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind, &r);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis);
+  CeedElemRestrictionCreateVector(r, &x, &u);
+  CeedVectorCreate(ceed, num_elem*Q, &v);
+
+  CeedVectorSetValue(x, 3.0);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, u, CEED_REQUEST_IMMEDIATE);
+  CheckValues("Restriction", u, 3.0);
+  CeedVectorSetValue(u, 3.0);
+  CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, v);
+  CheckValues("Interpolation", v, 3.0);
+  CeedVectorSetValue(u, 3.0);
+  CeedBasisApply(basis, num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u, v);
+  CheckValues("Gradient", v, 0.0);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&r);
+  CeedBasisDestroy(&basis);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,58 @@
+/// @file
+/// Test dot product and norms of vectors spanning several reduction blocks
+/// \test Test dot product and norms of vectors spanning several reduction blocks
+#include <ceed.h>
+#include <math.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y;
+  const CeedInt n = 10007;
+  CeedScalar a[n], b[n], dot, norm;
+  CeedScalar dot_true = 0., norm_1_true = 0., norm_2_true = 0.,
+             norm_max_true = 0.;
+
+  CeedInit(argv[1], &ceed);
+
+  // Integer values keep all sums exact
+  for (CeedInt i=0; i<n; i++) {
+    a[i] = i % 17 - 8;
+    b[i] = 1 + i % 3;
+    dot_true += a[i]*b[i];
+    norm_1_true += fabs(a[i]);
+    norm_2_true += a[i]*a[i];
+    norm_max_true = norm_max_true > fabs(a[i]) ? norm_max_true : fabs(a[i]);
+  }
+  norm_2_true = sqrt(norm_2_true);
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, a);
+  CeedVectorSetArray(y, CEED_MEM_HOST, CEED_USE_POINTER, b);
+
+  CeedVectorDot(x, y, &dot);
+  if (dot != dot_true)
+    // LCOV_EXCL_START
+    printf("Error in dot product, computed: %f actual: %f\n", dot, dot_true);
+  // LCOV_EXCL_STOP
+
+  CeedVectorNorm(x, CEED_NORM_1, &norm);
+  if (norm != norm_1_true)
+    // LCOV_EXCL_START
+    printf("Error in 1-norm, computed: %f actual: %f\n", norm, norm_1_true);
+  // LCOV_EXCL_STOP
+  CeedVectorNorm(x, CEED_NORM_2, &norm);
+  if (fabs(norm - norm_2_true) > 1e-12*norm_2_true)
+    // LCOV_EXCL_START
+    printf("Error in 2-norm, computed: %f actual: %f\n", norm, norm_2_true);
+  // LCOV_EXCL_STOP
+  CeedVectorNorm(x, CEED_NORM_MAX, &norm);
+  if (norm != norm_max_true)
+    // LCOV_EXCL_START
+    printf("Error in max-norm, computed: %f actual: %f\n", norm, norm_max_true);
+  // LCOV_EXCL_STOP
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedDestroy(&ceed);
+  return 0;
+}
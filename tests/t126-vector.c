@@ -0,0 +1,71 @@
+/// @file
+/// Test concurrent read access to a uniform vector
+/// \test Test concurrent read access to a uniform vector
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#define NUM_THREADS 8
+
+typedef struct {
+  pthread_barrier_t *barrier;
+  CeedVector x;
+  CeedScalar value;
+  int ierr, num_errors;
+} ThreadData;
+
+// Each thread reads the shared vector, materializing it on first access
+static void *ReadValues(void *arg) {
+  ThreadData *data = (ThreadData *)arg;
+  CeedInt n;
+  const CeedScalar *a;
+
+  pthread_barrier_wait(data->barrier);
+  data->ierr = CeedVectorGetLength(data->x, &n);
+  data->ierr |= CeedVectorGetArrayRead(data->x, CEED_MEM_HOST, &a);
+  data->num_errors = 0;
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[i] - data->value) > 1e-14)
+      data->num_errors++;
+  data->ierr |= CeedVectorRestoreArrayRead(data->x, &a);
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x;
+  CeedInt n = 100000;
+  pthread_t threads[NUM_THREADS];
+  pthread_barrier_t barrier;
+  ThreadData data[NUM_THREADS];
+
+  CeedInit(argv[1], &ceed);
+  pthread_barrier_init(&barrier, NULL, NUM_THREADS);
+  CeedVectorCreate(ceed, n, &x);
+
+  for (CeedInt round=0; round<20; round++) {
+    CeedScalar value = round + 1;
+    CeedVectorSetValue(x, value);
+    for (CeedInt t=0; t<NUM_THREADS; t++) {
+      data[t].barrier = &barrier;
+      data[t].x = x;
+      data[t].value = value;
+      pthread_create(&threads[t], NULL, ReadValues, &data[t]);
+    }
+    for (CeedInt t=0; t<NUM_THREADS; t++)
+      pthread_join(threads[t], NULL);
+    for (CeedInt t=0; t<NUM_THREADS; t++)
+      if (data[t].ierr || data[t].num_errors)
+        // LCOV_EXCL_START
+        printf("Round %d thread %d: error %d, %d incorrect values\n", round, t,
+               data[t].ierr, data[t].num_errors);
+    // LCOV_EXCL_STOP
+  }
+
+  pthread_barrier_destroy(&barrier);
+  CeedVectorDestroy(&x);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,134 @@
+/// @file
+/// Test creation, use, and destruction of a structured element restriction
+/// \test Test creation, use, and destruction of a structured element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, y_ref, z, z_ref, y_blk, y_blk_ref;
+  const CeedInt dim = 2, P = 3, num_comp = 2;
+  CeedInt num_elem_1d[2] = {3, 2}, num_nodes_1d[2];
+  bool is_periodic[2] = {true, false};
+  CeedInt num_elem = num_elem_1d[0]*num_elem_1d[1], elem_size = P*P;
+  CeedInt ind[num_elem*elem_size];
+  CeedScalar a[2*num_comp*(num_elem_1d[0]*(P-1)+1)*(num_elem_1d[1]*(P-1)+1)];
+  const CeedScalar *yy, *yy_ref, *zz, *zz_ref;
+  const CeedInt *offsets;
+  const CeedInt blk_size = 4;
+  CeedElemRestriction r, r_ref, r_blk, r_blk_ref;
+
+  CeedInit(argv[1], &ceed);
+
+  // Explicit offsets for reference restriction
+  num_nodes_1d[0] = num_elem_1d[0]*(P-1);
+  num_nodes_1d[1] = num_elem_1d[1]*(P-1) + 1;
+  CeedInt num_nodes = num_nodes_1d[0]*num_nodes_1d[1];
+  for (CeedInt e_y=0; e_y<num_elem_1d[1]; e_y++)
+    for (CeedInt e_x=0; e_x<num_elem_1d[0]; e_x++)
+      for (CeedInt i_y=0; i_y<P; i_y++)
+        for (CeedInt i_x=0; i_x<P; i_x++) {
+          CeedInt e = e_x + e_y*num_elem_1d[0], n = i_x + i_y*P;
+          CeedInt node_x = (e_x*(P-1) + i_x) % num_nodes_1d[0];
+          CeedInt node_y = e_y*(P-1) + i_y;
+          ind[e*elem_size + n] = node_x + node_y*num_nodes_1d[0];
+        }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes,
+                            num_comp*num_nodes, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind, &r_ref);
+  CeedElemRestrictionCreateStructured(ceed, dim, num_elem_1d, P, is_periodic,
+                                      num_comp, num_nodes, num_comp*num_nodes,
+                                      &r);
+
+  // Restrict
+  CeedVectorCreate(ceed, num_comp*num_nodes, &x);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, a);
+  CeedElemRestrictionCreateVector(r, NULL, &y);
+  CeedElemRestrictionCreateVector(r_ref, NULL, &y_ref);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r_ref, CEED_NOTRANSPOSE, x, y_ref,
+                           CEED_REQUEST_IMMEDIATE);
+
+  // Transpose
+  CeedElemRestrictionCreateVector(r, &z, NULL);
+  CeedElemRestrictionCreateVector(r_ref, &z_ref, NULL);
+  CeedVectorSetValue(z, 0.0);
+  CeedVectorSetValue(z_ref, 0.0);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, y, z, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r_ref, CEED_TRANSPOSE, y_ref, z_ref,
+                           CEED_REQUEST_IMMEDIATE);
+
+  // Blocked
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size,
+                                   num_comp, num_nodes, num_comp*num_nodes,
+                                   CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                                   &r_blk_ref);
+  CeedElemRestrictionCreateBlockedStructured(ceed, dim, num_elem_1d, P,
+      is_periodic, blk_size, num_comp, num_nodes, num_comp*num_nodes, &r_blk);
+  CeedElemRestrictionCreateVector(r_blk, NULL, &y_blk);
+  CeedElemRestrictionCreateVector(r_blk_ref, NULL, &y_blk_ref);
+  CeedElemRestrictionApply(r_blk, CEED_NOTRANSPOSE, x, y_blk,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r_blk_ref, CEED_NOTRANSPOSE, x, y_blk_ref,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(y_blk, CEED_MEM_HOST, &yy);
+  CeedVectorGetArrayRead(y_blk_ref, CEED_MEM_HOST, &yy_ref);
+  for (CeedInt i=0;
+       i<num_comp*((num_elem+blk_size-1)/blk_size)*blk_size*elem_size; i++)
+    if (yy[i] != yy_ref[i])
+      // LCOV_EXCL_START
+      printf("Error in blocked restricted array y[%d] = %f != %f\n",
+             i, (CeedScalar)yy[i], (CeedScalar)yy_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y_blk, &yy);
+  CeedVectorRestoreArrayRead(y_blk_ref, &yy_ref);
+
+  // Check
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  CeedVectorGetArrayRead(y_ref, CEED_MEM_HOST, &yy_ref);
+  for (CeedInt i=0; i<num_comp*num_elem*elem_size; i++)
+    if (yy[i] != yy_ref[i])
+      // LCOV_EXCL_START
+      printf("Error in restricted array y[%d] = %f != %f\n",
+             i, (CeedScalar)yy[i], (CeedScalar)yy_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &yy);
+  CeedVectorRestoreArrayRead(y_ref, &yy_ref);
+
+  CeedVectorGetArrayRead(z, CEED_MEM_HOST, &zz);
+  CeedVectorGetArrayRead(z_ref, CEED_MEM_HOST, &zz_ref);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    if (fabs(zz[i] - zz_ref[i]) > 1e-12)
+      // LCOV_EXCL_START
+      printf("Error in transpose restricted array z[%d] = %f != %f\n",
+             i, (CeedScalar)zz[i], (CeedScalar)zz_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(z, &zz);
+  CeedVectorRestoreArrayRead(z_ref, &zz_ref);
+
+  // Offsets decoded from the structured restriction
+  CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+  for (CeedInt i=0; i<num_elem*elem_size; i++)
+    if (offsets[i] != ind[i])
+      // LCOV_EXCL_START
+      printf("Error in offsets[%d] = %d != %d\n", i, offsets[i], ind[i]);
+  // LCOV_EXCL_STOP
+  CeedElemRestrictionRestoreOffsets(r, &offsets);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_ref);
+  CeedVectorDestroy(&z);
+  CeedVectorDestroy(&z_ref);
+  CeedVectorDestroy(&y_blk);
+  CeedVectorDestroy(&y_blk_ref);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&r_blk);
+  CeedElemRestrictionDestroy(&r_blk_ref);
+  CeedElemRestrictionDestroy(&r_ref);
+  CeedDestroy(&ceed);
+  return 0;
+}
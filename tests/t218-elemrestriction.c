@@ -0,0 +1,138 @@
+/// @file
+/// Test creation, use, and destruction of an element restriction with compressed offsets
+/// \test Test creation, use, and destruction of an element restriction with compressed offsets
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, y_ref, z, z_ref, y_blk, y_blk_ref, z_blk, z_blk_ref;
+  const CeedInt num_elem = 7, elem_size = 4, num_comp = 2, blk_size = 4;
+  const CeedInt num_nodes = num_elem*(elem_size-1) + 1;
+  CeedInt ind[num_elem*elem_size];
+  CeedScalar a[num_comp*num_nodes];
+  const CeedScalar *yy, *yy_ref, *zz, *zz_ref;
+  const CeedInt *offsets;
+  CeedElemRestriction r, r_ref, r_blk, r_blk_ref;
+
+  CeedInit(argv[1], &ceed);
+
+  // Elements in reverse order with a permuted node ordering
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt n=0; n<elem_size; n++)
+      ind[e*elem_size + n] = (num_elem-1-e)*(elem_size-1) +
+                             (n + e) % elem_size;
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes,
+                            num_comp*num_nodes, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind, &r_ref);
+  CeedElemRestrictionCreateCompressed(ceed, num_elem, elem_size, num_comp,
+                                      num_nodes, num_comp*num_nodes,
+                                      CEED_MEM_HOST, CEED_COPY_VALUES, ind, &r);
+
+  // Restrict
+  CeedVectorCreate(ceed, num_comp*num_nodes, &x);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, a);
+  CeedElemRestrictionCreateVector(r, NULL, &y);
+  CeedElemRestrictionCreateVector(r_ref, NULL, &y_ref);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r_ref, CEED_NOTRANSPOSE, x, y_ref,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  CeedVectorGetArrayRead(y_ref, CEED_MEM_HOST, &yy_ref);
+  for (CeedInt i=0; i<num_comp*num_elem*elem_size; i++)
+    if (yy[i] != yy_ref[i])
+      // LCOV_EXCL_START
+      printf("Error in restricted array y[%d] = %f != %f\n",
+             i, (CeedScalar)yy[i], (CeedScalar)yy_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &yy);
+  CeedVectorRestoreArrayRead(y_ref, &yy_ref);
+
+  // Transpose
+  CeedVectorCreate(ceed, num_comp*num_nodes, &z);
+  CeedVectorCreate(ceed, num_comp*num_nodes, &z_ref);
+  CeedVectorSetValue(z, 0.0);
+  CeedVectorSetValue(z_ref, 0.0);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, y, z, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r_ref, CEED_TRANSPOSE, y_ref, z_ref,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(z, CEED_MEM_HOST, &zz);
+  CeedVectorGetArrayRead(z_ref, CEED_MEM_HOST, &zz_ref);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    if (fabs(zz[i] - zz_ref[i]) > 1e-12)
+      // LCOV_EXCL_START
+      printf("Error in transpose restricted array z[%d] = %f != %f\n",
+             i, (CeedScalar)zz[i], (CeedScalar)zz_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(z, &zz);
+  CeedVectorRestoreArrayRead(z_ref, &zz_ref);
+
+  // Blocked, sharing compressed offsets
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size,
+                                   num_comp, num_nodes, num_comp*num_nodes,
+                                   CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                                   &r_blk_ref);
+  CeedElemRestrictionCreateBlockedShared(r, blk_size, &r_blk);
+  CeedElemRestrictionCreateVector(r_blk, &z_blk, &y_blk);
+  CeedElemRestrictionCreateVector(r_blk_ref, &z_blk_ref, &y_blk_ref);
+  CeedElemRestrictionApply(r_blk, CEED_NOTRANSPOSE, x, y_blk,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r_blk_ref, CEED_NOTRANSPOSE, x, y_blk_ref,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(y_blk, CEED_MEM_HOST, &yy);
+  CeedVectorGetArrayRead(y_blk_ref, CEED_MEM_HOST, &yy_ref);
+  for (CeedInt i=0;
+       i<num_comp*((num_elem+blk_size-1)/blk_size)*blk_size*elem_size; i++)
+    if (yy[i] != yy_ref[i])
+      // LCOV_EXCL_START
+      printf("Error in blocked restricted array y[%d] = %f != %f\n",
+             i, (CeedScalar)yy[i], (CeedScalar)yy_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y_blk, &yy);
+  CeedVectorRestoreArrayRead(y_blk_ref, &yy_ref);
+
+  CeedVectorSetValue(z_blk, 0.0);
+  CeedVectorSetValue(z_blk_ref, 0.0);
+  CeedElemRestrictionApply(r_blk, CEED_TRANSPOSE, y_blk, z_blk,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r_blk_ref, CEED_TRANSPOSE, y_blk_ref, z_blk_ref,
+                           CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(z_blk, CEED_MEM_HOST, &zz);
+  CeedVectorGetArrayRead(z_blk_ref, CEED_MEM_HOST, &zz_ref);
+  for (CeedInt i=0; i<num_comp*num_nodes; i++)
+    if (fabs(zz[i] - zz_ref[i]) > 1e-12)
+      // LCOV_EXCL_START
+      printf("Error in blocked transpose restricted array z[%d] = %f != %f\n",
+             i, (CeedScalar)zz[i], (CeedScalar)zz_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(z_blk, &zz);
+  CeedVectorRestoreArrayRead(z_blk_ref, &zz_ref);
+
+  // Offsets decoded from the compressed restriction
+  CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+  for (CeedInt i=0; i<num_elem*elem_size; i++)
+    if (offsets[i] != ind[i])
+      // LCOV_EXCL_START
+      printf("Error in offsets[%d] = %d != %d\n", i, offsets[i], ind[i]);
+  // LCOV_EXCL_STOP
+  CeedElemRestrictionRestoreOffsets(r, &offsets);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_ref);
+  CeedVectorDestroy(&z);
+  CeedVectorDestroy(&z_ref);
+  CeedVectorDestroy(&y_blk);
+  CeedVectorDestroy(&y_blk_ref);
+  CeedVectorDestroy(&z_blk);
+  CeedVectorDestroy(&z_blk_ref);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&r_blk);
+  CeedElemRestrictionDestroy(&r_blk_ref);
+  CeedElemRestrictionDestroy(&r_ref);
+  CeedDestroy(&ceed);
+  return 0;
+}
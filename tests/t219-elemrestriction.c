@@ -0,0 +1,104 @@
+/// @file
+/// Test coloring of element restrictions for concurrent transpose application
+/// \test Test coloring of element restrictions for concurrent transpose application
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+
+// Check that every block has exactly one color and blocks of one color do not
+//   share nodes
+static void CheckColoring(const char *name, CeedInt num_blk, CeedInt blk_size,
+                          CeedInt elem_size, CeedInt num_elem,
+                          const CeedInt *ind, CeedInt num_nodes,
+                          CeedInt num_colors, const CeedInt *color_offsets,
+                          const CeedInt *color_blks) {
+  CeedInt seen[num_blk], owner[num_nodes];
+
+  for (CeedInt b=0; b<num_blk; b++)
+    seen[b] = 0;
+  for (CeedInt c=0; c<num_colors; c++) {
+    for (CeedInt i=0; i<num_nodes; i++)
+      owner[i] = -1;
+    for (CeedInt k=color_offsets[c]; k<color_offsets[c+1]; k++) {
+      const CeedInt b = color_blks[k];
+      seen[b]++;
+      for (CeedInt e=b*blk_size; e<(b+1)*blk_size && e<num_elem; e++)
+        for (CeedInt n=0; n<elem_size; n++) {
+          const CeedInt node = ind[e*elem_size + n];
+          if (owner[node] >= 0 && owner[node] != b)
+            // LCOV_EXCL_START
+            printf("%s: blocks %d and %d of color %d share node %d\n", name,
+                   owner[node], b, c, node);
+          // LCOV_EXCL_STOP
+          owner[node] = b;
+        }
+    }
+  }
+  if (color_offsets[num_colors] != num_blk)
+    // LCOV_EXCL_START
+    printf("%s: %d blocks colored != %d blocks\n", name,
+           color_offsets[num_colors], num_blk);
+  // LCOV_EXCL_STOP
+  for (CeedInt b=0; b<num_blk; b++)
+    if (seen[b] != 1)
+      // LCOV_EXCL_START
+      printf("%s: block %d colored %d times\n", name, b, seen[b]);
+  // LCOV_EXCL_STOP
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt num_elem = 10, elem_size = 3, blk_size = 4;
+  const CeedInt num_nodes = num_elem*(elem_size-1) + 1;
+  CeedInt ind[num_elem*elem_size], num_colors;
+  const CeedInt *color_offsets, *color_blks;
+  CeedElemRestriction r, r_blk, r_strided;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt n=0; n<elem_size; n++)
+      ind[e*elem_size + n] = e*(elem_size-1) + n;
+
+  // Neighboring elements share an end node
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, 1, 1, num_nodes,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind, &r);
+  CeedElemRestrictionGetColoring(r, &num_colors, &color_offsets, &color_blks);
+  if (num_colors != 2)
+    // LCOV_EXCL_START
+    printf("Element coloring uses %d colors != 2\n", num_colors);
+  // LCOV_EXCL_STOP
+  CheckColoring("Element coloring", num_elem, 1, elem_size, num_elem, ind,
+                num_nodes, num_colors, color_offsets, color_blks);
+
+  // Neighboring blocks share an end node; last block is padded
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, 1, 1,
+                                   num_nodes, CEED_MEM_HOST, CEED_USE_POINTER,
+                                   ind, &r_blk);
+  CeedElemRestrictionGetColoring(r_blk, &num_colors, &color_offsets,
+                                 &color_blks);
+  if (num_colors != 2)
+    // LCOV_EXCL_START
+    printf("Block coloring uses %d colors != 2\n", num_colors);
+  // LCOV_EXCL_STOP
+  CheckColoring("Block coloring", (num_elem+blk_size-1)/blk_size, blk_size,
+                elem_size, num_elem, ind, num_nodes, num_colors, color_offsets,
+                color_blks);
+
+  // Strided elements share no nodes
+  CeedInt strides[3] = {1, elem_size, elem_size};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, elem_size, 1,
+                                   num_elem*elem_size, strides, &r_strided);
+  CeedElemRestrictionGetColoring(r_strided, &num_colors, &color_offsets,
+                                 &color_blks);
+  if (num_colors != 1 || color_offsets[1] != num_elem)
+    // LCOV_EXCL_START
+    printf("Strided coloring uses %d colors != 1\n", num_colors);
+  // LCOV_EXCL_STOP
+
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&r_blk);
+  CeedElemRestrictionDestroy(&r_strided);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,82 @@
+/// @file
+/// Test transpose of element restrictions overwriting the output vector
+/// \test Test transpose of element restrictions overwriting the output vector
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+// Compare overwrite transpose against zeroed transpose sum
+static void CheckTranspose(const char *name, Ceed ceed,
+                           CeedElemRestriction r) {
+  CeedVector x, y, y_ref;
+  CeedInt e_size, l_size;
+  const CeedScalar *yy, *yy_ref;
+  CeedScalar *xx;
+
+  CeedElemRestrictionCreateVector(r, &y, &x);
+  CeedElemRestrictionCreateVector(r, &y_ref, NULL);
+  CeedVectorGetLength(x, &e_size);
+  CeedVectorGetLength(y, &l_size);
+  CeedVectorGetArray(x, CEED_MEM_HOST, &xx);
+  for (CeedInt i=0; i<e_size; i++)
+    xx[i] = 1 + i % 7;
+  CeedVectorRestoreArray(x, &xx);
+
+  // Stale output values must not survive
+  CeedVectorSetValue(y, 100.0);
+  CeedVectorSetValue(y_ref, 0.0);
+  CeedElemRestrictionApplyTransposeOverwrite(r, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, x, y_ref, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  CeedVectorGetArrayRead(y_ref, CEED_MEM_HOST, &yy_ref);
+  for (CeedInt i=0; i<l_size; i++)
+    if (fabs(yy[i] - yy_ref[i]) > 1e-14)
+      // LCOV_EXCL_START
+      printf("%s [%d] computed: %f actual: %f\n", name, i, yy[i], yy_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &yy);
+  CeedVectorRestoreArrayRead(y_ref, &yy_ref);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&y_ref);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt num_elem = 10, elem_size = 3, blk_size = 4, num_comp = 2;
+  // Last L-vector node is not referenced by any element
+  const CeedInt num_nodes = num_elem*(elem_size-1) + 2;
+  CeedInt ind[num_elem*elem_size];
+  CeedElemRestriction r, r_blk, r_strided;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt e=0; e<num_elem; e++)
+    for (CeedInt n=0; n<elem_size; n++)
+      ind[e*elem_size + n] = e*(elem_size-1) + n;
+
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes,
+                            num_comp*num_nodes, CEED_MEM_HOST, CEED_USE_POINTER,
+                            ind, &r);
+  CheckTranspose("Standard", ceed, r);
+
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp,
+                                   1, num_comp*num_nodes, CEED_MEM_HOST,
+                                   CEED_USE_POINTER, ind, &r_blk);
+  CheckTranspose("Blocked", ceed, r_blk);
+
+  CeedInt strides[3] = {1, elem_size*num_elem, elem_size};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, elem_size, num_comp,
+                                   num_elem*elem_size*num_comp, strides,
+                                   &r_strided);
+  CheckTranspose("Strided", ceed, r_strided);
+
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&r_blk);
+  CeedElemRestrictionDestroy(&r_strided);
+  CeedDestroy(&ceed);
+  return 0;
+}
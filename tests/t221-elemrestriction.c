@@ -0,0 +1,106 @@
+/// @file
+/// Test element restrictions of fields with interlaced components
+/// \test Test element restrictions of fields with interlaced components
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+// Compare restriction and transpose against the definition
+static void CheckRestriction(const char *name, CeedElemRestriction r,
+                             CeedInt num_elem, CeedInt elem_size,
+                             CeedInt blk_size, CeedInt num_comp,
+                             const CeedInt *ind) {
+  CeedVector x, y;
+  CeedInt e_size, l_size;
+  const CeedScalar *yy, *xx;
+  CeedScalar *ww;
+
+  CeedElemRestrictionCreateVector(r, &x, &y);
+  CeedVectorGetLength(x, &l_size);
+  CeedVectorGetLength(y, &e_size);
+  CeedScalar u[l_size], v[l_size];
+  for (CeedInt i=0; i<l_size; i++) {
+    u[i] = 10 + i;
+    v[i] = 0;
+  }
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+
+  // E-vector has shape [num_blk, num_comp, elem_size, blk_size]
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  for (CeedInt b=0; b<e_size/(blk_size*num_comp*elem_size); b++)
+    for (CeedInt k=0; k<num_comp; k++)
+      for (CeedInt n=0; n<elem_size; n++)
+        for (CeedInt j=0; j<blk_size; j++) {
+          const CeedInt e = b*blk_size + j < num_elem ? b*blk_size + j : num_elem-1;
+          const CeedInt i = ((b*num_comp + k)*elem_size + n)*blk_size + j;
+          const CeedScalar expected = u[ind[e*elem_size + n] + k];
+          if (yy[i] != expected)
+            // LCOV_EXCL_START
+            printf("%s [%d] computed: %f actual: %f\n", name, i, yy[i], expected);
+          // LCOV_EXCL_STOP
+          // Accumulate transpose of non-padding elements
+          if (b*blk_size + j < num_elem)
+            v[ind[e*elem_size + n] + k] += 1 + i % 5;
+        }
+  CeedVectorRestoreArrayRead(y, &yy);
+
+  CeedVectorGetArray(y, CEED_MEM_HOST, &ww);
+  for (CeedInt i=0; i<e_size; i++)
+    ww[i] = 1 + i % 5;
+  CeedVectorRestoreArray(y, &ww);
+  CeedVectorSetValue(x, 0.0);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &xx);
+  for (CeedInt i=0; i<l_size; i++)
+    if (xx[i] != v[i])
+      // LCOV_EXCL_START
+      printf("%s transpose [%d] computed: %f actual: %f\n", name, i, xx[i], v[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &xx);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt num_elem = 7, elem_size = 3;
+  const CeedInt num_nodes = num_elem*(elem_size-1) + 1;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt num_comp=2; num_comp<=3; num_comp++) {
+    CeedInt ind[num_elem*elem_size];
+    CeedElemRestriction r;
+
+    // Components of each node are contiguous in the L-vector
+    for (CeedInt e=0; e<num_elem; e++)
+      for (CeedInt n=0; n<elem_size; n++)
+        ind[e*elem_size + n] = num_comp*(e*(elem_size-1) + n);
+
+    CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, 1,
+                              num_comp*num_nodes, CEED_MEM_HOST,
+                              CEED_USE_POINTER, ind, &r);
+    CheckRestriction("Standard", r, num_elem, elem_size, 1, num_comp, ind);
+    CeedElemRestrictionDestroy(&r);
+
+    CeedElemRestrictionCreateCompressed(ceed, num_elem, elem_size, num_comp, 1,
+                                        num_comp*num_nodes, CEED_MEM_HOST,
+                                        CEED_USE_POINTER, ind, &r);
+    CheckRestriction("Compressed", r, num_elem, elem_size, 1, num_comp, ind);
+    CeedElemRestrictionDestroy(&r);
+
+    for (CeedInt blk_size=4; blk_size<=8; blk_size+=4) {
+      CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size,
+                                       num_comp, 1, num_comp*num_nodes,
+                                       CEED_MEM_HOST, CEED_USE_POINTER, ind, &r);
+      CheckRestriction("Blocked", r, num_elem, elem_size, blk_size, num_comp,
+                       ind);
+      CeedElemRestrictionDestroy(&r);
+    }
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,135 @@
+/// @file
+/// Test interpolation and gradient at arbitrary points and their transposes
+/// \test Test interpolation and gradient at arbitrary points and their transposes
+#include <ceed.h>
+#include <math.h>
+
+// Polynomial of degree P - 1 = 3 in each coordinate, scaled by s
+static CeedScalar Eval(CeedInt dim, CeedScalar s, const CeedScalar *x) {
+  CeedScalar result = 1, prod = 1;
+  for (CeedInt d=0; d<dim; d++) {
+    result += s*(d+1)*x[d]*x[d]*x[d];
+    prod *= x[d];
+  }
+  return result + s*prod;
+}
+
+static CeedScalar EvalGrad(CeedInt dim, CeedScalar s, const CeedScalar *x,
+                           CeedInt i) {
+  CeedScalar prod = 1;
+  for (CeedInt d=0; d<dim; d++)
+    if (d != i) prod *= x[d];
+  return s*(3*(i+1)*x[i]*x[i] + prod);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim=1; dim<=3; dim++) {
+    CeedVector X, X_nodes, X_ref, U, V, U_t;
+    CeedBasis basis_x, basis_u;
+    const CeedInt P = 4, Q = 5, num_comp = 2, num_elem = 3, num_points = 7;
+    const CeedInt num_nodes = CeedIntPow(P, dim), num_corners = 1 << dim;
+    const CeedEvalMode eval_modes[2] = {CEED_EVAL_INTERP, CEED_EVAL_GRAD};
+    CeedScalar x[dim*num_corners], x_ref[dim*num_points*num_elem];
+    CeedScalar u[num_comp*num_nodes*num_elem];
+    const CeedScalar *x_nodes, *v, *u_t;
+
+    // Lobatto nodes of the reference element
+    for (CeedInt d=0; d<dim; d++)
+      for (CeedInt i=0; i<num_corners; i++)
+        x[d*num_corners + i] = ((i >> d) & 1) ? 1 : -1;
+    CeedVectorCreate(ceed, dim*num_corners, &X);
+    CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+    CeedVectorCreate(ceed, dim*num_nodes, &X_nodes);
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, P, CEED_GAUSS_LOBATTO,
+                                    &basis_x);
+    CeedBasisApply(basis_x, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, X, X_nodes);
+
+    // Nodal values, different for each element and component
+    CeedVectorGetArrayRead(X_nodes, CEED_MEM_HOST, &x_nodes);
+    for (CeedInt e=0; e<num_elem; e++)
+      for (CeedInt c=0; c<num_comp; c++)
+        for (CeedInt n=0; n<num_nodes; n++) {
+          CeedScalar xx[dim];
+          for (CeedInt d=0; d<dim; d++)
+            xx[d] = x_nodes[d*num_nodes + n];
+          u[(c*num_nodes + n)*num_elem + e] = Eval(dim, 1 + e + 2*c, xx);
+        }
+    CeedVectorRestoreArrayRead(X_nodes, &x_nodes);
+
+    // Points, different for each element
+    for (CeedInt e=0; e<num_elem; e++)
+      for (CeedInt p=0; p<num_points; p++)
+        for (CeedInt d=0; d<dim; d++)
+          x_ref[(d*num_points + p)*num_elem + e] = 0.95*sin(1 + p + 3*d + 7*e);
+    CeedVectorCreate(ceed, dim*num_points*num_elem, &X_ref);
+    CeedVectorSetArray(X_ref, CEED_MEM_HOST, CEED_USE_POINTER, x_ref);
+
+    CeedVectorCreate(ceed, num_comp*num_nodes*num_elem, &U);
+    CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+    CeedVectorCreate(ceed, num_comp*num_nodes*num_elem, &U_t);
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, P, Q, CEED_GAUSS,
+                                    &basis_u);
+
+    for (CeedInt m=0; m<2; m++) {
+      const CeedInt num_eval = m == 0 ? 1 : dim;
+      const CeedInt v_length = num_eval*num_comp*num_points*num_elem;
+      CeedScalar w[v_length], vw = 0, uu_t = 0;
+
+      // Evaluate at points
+      CeedVectorCreate(ceed, v_length, &V);
+      CeedBasisApplyAtPoints(basis_u, num_elem, num_points, CEED_NOTRANSPOSE,
+                             eval_modes[m], X_ref, U, V);
+      CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+      for (CeedInt i=0; i<num_eval; i++)
+        for (CeedInt c=0; c<num_comp; c++)
+          for (CeedInt p=0; p<num_points; p++)
+            for (CeedInt e=0; e<num_elem; e++) {
+              CeedScalar xx[dim];
+              for (CeedInt d=0; d<dim; d++)
+                xx[d] = x_ref[(d*num_points + p)*num_elem + e];
+              const CeedScalar s = 1 + e + 2*c;
+              const CeedScalar exact = m == 0 ? Eval(dim, s, xx) :
+                                       EvalGrad(dim, s, xx, i);
+              const CeedInt k = ((i*num_comp + c)*num_points + p)*num_elem + e;
+              if (fabs(v[k] - exact) > 1e-12)
+                // LCOV_EXCL_START
+                printf("dim %d, mode %d [%d] computed: %f actual: %f\n", dim, m,
+                       k, v[k], exact);
+              // LCOV_EXCL_STOP
+              w[k] = cos(k);
+              vw += v[k]*w[k];
+            }
+      CeedVectorRestoreArrayRead(V, &v);
+
+      // Transpose satisfies (A u, w) = (u, A^T w)
+      CeedVectorSetArray(V, CEED_MEM_HOST, CEED_USE_POINTER, w);
+      CeedBasisApplyAtPoints(basis_u, num_elem, num_points, CEED_TRANSPOSE,
+                             eval_modes[m], X_ref, V, U_t);
+      CeedVectorGetArrayRead(U_t, CEED_MEM_HOST, &u_t);
+      for (CeedInt i=0; i<num_comp*num_nodes*num_elem; i++)
+        uu_t += u[i]*u_t[i];
+      CeedVectorRestoreArrayRead(U_t, &u_t);
+      if (fabs(vw - uu_t) > 1e-10*fabs(vw))
+        // LCOV_EXCL_START
+        printf("dim %d, mode %d transpose: (A u, w) %f != (u, A^T w) %f\n", dim,
+               m, vw, uu_t);
+      // LCOV_EXCL_STOP
+      CeedVectorDestroy(&V);
+    }
+
+    CeedVectorDestroy(&X);
+    CeedVectorDestroy(&X_nodes);
+    CeedVectorDestroy(&X_ref);
+    CeedVectorDestroy(&U);
+    CeedVectorDestroy(&U_t);
+    CeedBasisDestroy(&basis_x);
+    CeedBasisDestroy(&basis_u);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,128 @@
+/// @file
+/// Test registered QFunctionContext fields and dirty range tracking
+/// \test Test registered QFunctionContext fields and dirty range tracking
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "t406-qfunction.h"
+
+static void CheckDirtyRange(const char *name, CeedQFunctionContext ctx,
+                            size_t begin_true, size_t end_true) {
+  size_t begin, end;
+
+  CeedQFunctionContextGetDirtyRange(ctx, &begin, &end);
+  if (begin != begin_true || end != end_true)
+    // LCOV_EXCL_START
+    printf("%s dirty range computed: [%zu, %zu) actual: [%zu, %zu)\n", name,
+           begin, end, begin_true, end_true);
+  // LCOV_EXCL_STOP
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector in[16], out[16];
+  CeedVector U, V;
+  CeedQFunction qf;
+  CeedQFunctionContext ctx;
+  CeedContextFieldLabel time_label, count_label, scale_label, missing_label;
+  CeedInt Q = 8;
+  const CeedScalar *vv;
+  CeedScalar u[Q];
+  struct TimeContext time_ctx = {0., 0, {1., 0.}};
+
+  CeedInit(argv[1], &ceed);
+
+  CeedQFunctionCreateInterior(ceed, 1, scale_time, scale_time_loc, &qf);
+  CeedQFunctionAddInput(qf, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf, "v", 1, CEED_EVAL_INTERP);
+
+  // Setting the data marks the whole context modified
+  CeedQFunctionContextCreate(ceed, &ctx);
+  CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_COPY_VALUES,
+                              sizeof(time_ctx), &time_ctx);
+  CheckDirtyRange("SetData", ctx, 0, sizeof(time_ctx));
+  CeedQFunctionContextClearDirtyRange(ctx);
+  CheckDirtyRange("Clear", ctx, 0, 0);
+  CeedQFunctionSetContext(qf, ctx);
+
+  CeedQFunctionContextRegisterDouble(ctx, "time",
+                                     offsetof(struct TimeContext, time), 1,
+                                     "current time");
+  CeedQFunctionContextRegisterInt32(ctx, "count",
+                                    offsetof(struct TimeContext, count), 1,
+                                    "step count");
+  CeedQFunctionContextRegisterDouble(ctx, "scale",
+                                     offsetof(struct TimeContext, scale), 2,
+                                     NULL);
+  CeedQFunctionContextGetFieldLabel(ctx, "time", &time_label);
+  CeedQFunctionContextGetFieldLabel(ctx, "count", &count_label);
+  CeedQFunctionContextGetFieldLabel(ctx, "scale", &scale_label);
+  CeedQFunctionContextGetFieldLabel(ctx, "missing", &missing_label);
+  if (!time_label || !count_label || !scale_label || missing_label)
+    // LCOV_EXCL_START
+    printf("Incorrect field label lookup\n");
+  // LCOV_EXCL_STOP
+  {
+    const char *field_name, *field_description;
+    size_t num_values;
+    CeedContextFieldType field_type;
+
+    CeedContextFieldLabelGetDescription(scale_label, &field_name,
+                                        &field_description, &num_values,
+                                        &field_type);
+    if (strcmp(field_name, "scale") || strcmp(field_description, "") ||
+        num_values != 2 || field_type != CEED_CONTEXT_FIELD_DOUBLE)
+      // LCOV_EXCL_START
+      printf("Incorrect description of field \"%s\"\n", field_name);
+    // LCOV_EXCL_STOP
+  }
+
+  // Setting fields only marks their bytes modified
+  {
+    const double time = 0.5, scale[2] = {2., 3.};
+    const int count = 4;
+
+    CeedQFunctionContextSetDouble(ctx, time_label, &time);
+    CheckDirtyRange("SetDouble", ctx, offsetof(struct TimeContext, time),
+                    offsetof(struct TimeContext, time) + sizeof(double));
+    CeedQFunctionContextSetInt32(ctx, count_label, &count);
+    CheckDirtyRange("SetInt32", ctx, offsetof(struct TimeContext, time),
+                    offsetof(struct TimeContext, count) + sizeof(int));
+    CeedQFunctionContextClearDirtyRange(ctx);
+    CeedQFunctionContextSetDouble(ctx, scale_label, scale);
+    CheckDirtyRange("SetDouble array", ctx,
+                    offsetof(struct TimeContext, scale),
+                    offsetof(struct TimeContext, scale) + 2*sizeof(double));
+  }
+
+  // QFunction sees the updated values
+  for (CeedInt i=0; i<Q; i++)
+    u[i] = i;
+  CeedVectorCreate(ceed, Q, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Q, &V);
+  CeedVectorSetValue(V, 0);
+  {
+    in[0] = U;
+    out[0] = V;
+    CeedQFunctionApply(qf, Q, in, out);
+  }
+
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &vv);
+  for (CeedInt i=0; i<Q; i++)
+    if (fabs(vv[i] - (2.*0.5 + 3.*4)*u[i]) > 1e-14)
+      // LCOV_EXCL_START
+      printf("[%d] v %f != %f\n", i, vv[i], (2.*0.5 + 3.*4)*u[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &vv);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedQFunctionDestroy(&qf);
+  CeedQFunctionContextDestroy(&ctx);
+  CeedDestroy(&ceed);
+  return 0;
+}
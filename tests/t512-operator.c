@@ -0,0 +1,172 @@
+/// @file
+/// Test application of mass matrix operator to multiple vectors
+/// \test Test application of mass matrix operator to multiple vectors
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector q_data, X, U[3], V[3], V_single, X_multi[2], q_data_multi[2];
+  const CeedScalar *hv, *hv_single, *hq, *hq_single;
+  CeedInt num_elem = 15, P = 5, Q = 8, num_vecs = 3;
+  CeedInt num_nodes_x = num_elem+1, num_nodes_u = num_elem*(P-1)+1;
+  CeedInt ind_x[num_elem*2], ind_u[num_elem*P];
+  CeedScalar x[num_nodes_x], u[num_nodes_u], hv_sum[num_vecs];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<num_nodes_x; i++)
+    x[i] = (CeedScalar) i / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind_x[2*i+0] = i;
+    ind_x[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_x, &elem_restr_x);
+
+  for (CeedInt i=0; i<num_elem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      ind_u[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, P, 1, 1, num_nodes_u, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_u, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q, 1, Q*num_elem, strides_qd,
+                                   &elem_restr_qd_i);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, num_elem*Q, &q_data);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Input vectors u_k = k + 1 + (-1)^i k
+  for (CeedInt k=0; k<num_vecs; k++) {
+    CeedVectorCreate(ceed, num_nodes_u, &U[k]);
+    for (CeedInt i=0; i<num_nodes_u; i++)
+      u[i] = k + 1 + (i%2 ? -k : k);
+    CeedVectorSetArray(U[k], CEED_MEM_HOST, CEED_COPY_VALUES, u);
+    CeedVectorCreate(ceed, num_nodes_u, &V[k]);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &V_single);
+
+  CeedOperatorApplyMulti(op_mass, num_vecs, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Check against single vector apply
+  for (CeedInt k=0; k<num_vecs; k++) {
+    CeedOperatorApply(op_mass, U[k], V_single, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(V[k], CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(V_single, CEED_MEM_HOST, &hv_single);
+    for (CeedInt i=0; i<num_nodes_u; i++)
+      if (fabs(hv[i] - hv_single[i]) > 100.*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("[%d, %d] Multi apply %f != Single apply %f\n", k, i, hv[i],
+               hv_single[i]);
+    // LCOV_EXCL_STOP
+    hv_sum[k] = 0.;
+    for (CeedInt i=0; i<num_nodes_u; i++)
+      hv_sum[k] += hv[i];
+    CeedVectorRestoreArrayRead(V[k], &hv);
+    CeedVectorRestoreArrayRead(V_single, &hv_single);
+  }
+
+  // Check sum added to outputs with constant inputs
+  for (CeedInt k=0; k<num_vecs; k++)
+    CeedVectorSetValue(U[k], k + 1);
+  CeedOperatorApplyAddMulti(op_mass, num_vecs, U, V, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt k=0; k<num_vecs; k++) {
+    CeedScalar sum = 0.;
+    CeedVectorGetArrayRead(V[k], CEED_MEM_HOST, &hv);
+    for (CeedInt i=0; i<num_nodes_u; i++)
+      sum += hv[i];
+    CeedVectorRestoreArrayRead(V[k], &hv);
+    CeedScalar true_sum = k + 1 + hv_sum[k];
+    if (fabs(sum - true_sum) > 1000.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] Computed Sum: %f != True Sum: %f\n", k, sum, true_sum);
+    // LCOV_EXCL_STOP
+  }
+
+  // Check weight and gradient inputs with a strided output, x_k = (k + 1) x
+  for (CeedInt k=0; k<2; k++) {
+    CeedScalar x_k[num_nodes_x];
+    for (CeedInt i=0; i<num_nodes_x; i++)
+      x_k[i] = (k + 1)*x[i];
+    CeedVectorCreate(ceed, num_nodes_x, &X_multi[k]);
+    CeedVectorSetArray(X_multi[k], CEED_MEM_HOST, CEED_COPY_VALUES, x_k);
+    CeedVectorCreate(ceed, num_elem*Q, &q_data_multi[k]);
+  }
+  CeedOperatorApplyMulti(op_setup, 2, X_multi, q_data_multi,
+                         CEED_REQUEST_IMMEDIATE);
+  for (CeedInt k=0; k<2; k++) {
+    CeedOperatorApply(op_setup, X_multi[k], q_data, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(q_data_multi[k], CEED_MEM_HOST, &hq);
+    CeedVectorGetArrayRead(q_data, CEED_MEM_HOST, &hq_single);
+    for (CeedInt i=0; i<num_elem*Q; i++)
+      if (fabs(hq[i] - hq_single[i]) > 100.*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("[%d, %d] Multi setup %f != Single setup %f\n", k, i, hq[i],
+               hq_single[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(q_data_multi[k], &hq);
+    CeedVectorRestoreArrayRead(q_data, &hq_single);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  for (CeedInt k=0; k<num_vecs; k++) {
+    CeedVectorDestroy(&U[k]);
+    CeedVectorDestroy(&V[k]);
+  }
+  CeedVectorDestroy(&V_single);
+  for (CeedInt k=0; k<2; k++) {
+    CeedVectorDestroy(&X_multi[k]);
+    CeedVectorDestroy(&q_data_multi[k]);
+  }
+  CeedVectorDestroy(&q_data);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,193 @@
+/// @file
+/// Test mass matrix operator with quadrature data stored per element on affine elements
+/// \test Test mass matrix operator with quadrature data stored per element on affine elements
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t513-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass, qf_setup_w, qf_mass_w;
+  CeedOperator op_setup, op_mass, op_mass_ref, op_setup_w, op_mass_w,
+               op_mass_w_ref;
+  CeedOperatorField *input_fields;
+  CeedVector q_data, q_data_w, q_data_compressed, X, U, V, V_ref;
+  const CeedScalar *hv, *hv_ref;
+  CeedInt num_elem = 10, P_x = 3, P = 5, Q = 8;
+  CeedInt num_nodes_x = num_elem*(P_x-1)+1, num_nodes_u = num_elem*(P-1)+1;
+  CeedInt ind_x[num_elem*P_x], ind_u[num_elem*P];
+  CeedScalar x[num_nodes_x], u[num_nodes_u];
+
+  CeedInit(argv[1], &ceed);
+
+  // Quadratic coordinates, curved every third element
+  for (CeedInt i=0; i<num_nodes_x; i++)
+    x[i] = (CeedScalar) i / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i+=3)
+    x[i*(P_x-1)+1] += 0.1 / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i++)
+    for (CeedInt j=0; j<P_x; j++)
+      ind_x[P_x*i+j] = i*(P_x-1) + j;
+  CeedElemRestrictionCreate(ceed, num_elem, P_x, 1, 1, num_nodes_x,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind_x,
+                            &elem_restr_x);
+
+  for (CeedInt i=0; i<num_elem; i++)
+    for (CeedInt j=0; j<P; j++)
+      ind_u[P*i+j] = i*(P-1) + j;
+  CeedElemRestrictionCreate(ceed, num_elem, P, 1, 1, num_nodes_u, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_u, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q, 1, Q*num_elem, strides_qd,
+                                   &elem_restr_qd_i);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P_x, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions, with quadrature weights applied in the mass QFunction
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Setup
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, num_elem*Q, &q_data);
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Mass operators, with and without compressed quadrature data
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       q_data);
+  CeedOperatorSetField(op_mass, "_weight", CEED_ELEMRESTRICTION_NONE, basis_u,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_mass, "u", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorCompressElementQData(op_mass, "rho", 1e-12);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass_ref);
+  CeedOperatorSetField(op_mass_ref, "rho", elem_restr_qd_i,
+                       CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_mass_ref, "_weight", CEED_ELEMRESTRICTION_NONE,
+                       basis_u, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_mass_ref, "u", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_ref, "v", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+
+  // Check that the quadrature data is no longer stored in a CeedVector
+  CeedOperatorGetFields(op_mass, NULL, &input_fields, NULL, NULL);
+  CeedOperatorFieldGetVector(input_fields[0], &q_data_compressed);
+  if (q_data_compressed != CEED_VECTOR_NONE)
+    // LCOV_EXCL_START
+    printf("Error: compressed quadrature data stored in a CeedVector\n");
+  // LCOV_EXCL_STOP
+
+  // Apply
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    u[i] = 1 + sin(i);
+  CeedVectorCreate(ceed, num_nodes_u, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, num_nodes_u, &V);
+  CeedVectorCreate(ceed, num_nodes_u, &V_ref);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass_ref, U, V_ref, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(V_ref, CEED_MEM_HOST, &hv_ref);
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    if (fabs(hv[i] - hv_ref[i]) > 100.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] v %g != v_ref %g\n", i, hv[i], hv_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &hv);
+  CeedVectorRestoreArrayRead(V_ref, &hv_ref);
+
+  // Quadrature data with quadrature weights applied by the setup QFunction
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup_w);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass_w);
+  CeedOperatorCreate(ceed, qf_setup_w, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup_w);
+  CeedOperatorSetField(op_setup_w, "dx", elem_restr_x, basis_x,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_w, "weights", CEED_ELEMRESTRICTION_NONE,
+                       basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_w, "qdata", elem_restr_qd_i,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedVectorCreate(ceed, num_elem*Q, &q_data_w);
+  CeedOperatorApply(op_setup_w, X, q_data_w, CEED_REQUEST_IMMEDIATE);
+
+  CeedOperatorCreate(ceed, qf_mass_w, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass_w);
+  CeedOperatorSetField(op_mass_w, "u", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_w, "qdata", elem_restr_qd_i,
+                       CEED_BASIS_COLLOCATED, q_data_w);
+  CeedOperatorSetField(op_mass_w, "v", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorCompressElementQData(op_mass_w, "qdata", 1e-12);
+
+  CeedOperatorCreate(ceed, qf_mass_w, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass_w_ref);
+  CeedOperatorSetField(op_mass_w_ref, "u", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_w_ref, "qdata", elem_restr_qd_i,
+                       CEED_BASIS_COLLOCATED, q_data_w);
+  CeedOperatorSetField(op_mass_w_ref, "v", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_mass_w, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass_w_ref, U, V_ref, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(V_ref, CEED_MEM_HOST, &hv_ref);
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    if (fabs(hv[i] - hv_ref[i]) > 100.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] weighted v %g != v_ref %g\n", i, hv[i], hv_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &hv);
+  CeedVectorRestoreArrayRead(V_ref, &hv_ref);
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_setup_w);
+  CeedQFunctionDestroy(&qf_mass_w);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_ref);
+  CeedOperatorDestroy(&op_setup_w);
+  CeedOperatorDestroy(&op_mass_w);
+  CeedOperatorDestroy(&op_mass_w_ref);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&V_ref);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&q_data_w);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,174 @@
+/// @file
+/// Test Poisson operator with compressed and symmetric packed quadrature data
+/// \test Test Poisson operator with compressed and symmetric packed quadrature data
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t514-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_diff;
+  CeedOperator op_setup, op_diff_ref, op_diff[3];
+  CeedVector q_data, X, U, V, V_ref, D, D_ref;
+  const CeedScalar *hv, *hv_ref;
+  CeedInt num_elem = 6, P = 3, Q = 4, dim = 2;
+  CeedInt nx = 3, ny = 2;
+  CeedInt num_dofs = (nx*2+1)*(ny*2+1), num_qpts = num_elem*Q*Q;
+  CeedInt ind_x[num_elem*P*P];
+  CeedScalar x[dim*num_dofs], u[num_dofs], v_max = 0.0;
+  const CeedQDataStorage storages[3] = {CEED_QDATA_SCALAR, CEED_QDATA_FP32,
+                                        CEED_QDATA_BF16
+                                       };
+  const CeedScalar tols[3] = {100.*CEED_EPSILON, 1e-6, 1e-2};
+
+  CeedInit(argv[1], &ceed);
+
+  // DoF Coordinates, perturbed so quadrature data varies within elements
+  for (CeedInt i=0; i<nx*2+1; i++)
+    for (CeedInt j=0; j<ny*2+1; j++) {
+      x[i+j*(nx*2+1)+0*num_dofs] = (CeedScalar) i / (2*nx) +
+                                   0.02*sin(3.*i*j);
+      x[i+j*(nx*2+1)+1*num_dofs] = (CeedScalar) j / (2*ny) +
+                                   0.02*cos(5.*i*j);
+    }
+  CeedVectorCreate(ceed, dim*num_dofs, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Element Setup
+  for (CeedInt i=0; i<num_elem; i++) {
+    CeedInt col, row, offset;
+    col = i % nx;
+    row = i / nx;
+    offset = col*(P-1) + row*(nx*2+1)*(P-1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        ind_x[P*(P*i+k)+j] = offset + k*(nx*2+1) + j;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, num_elem, P*P, dim, num_dofs, dim*num_dofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restr_x);
+  CeedElemRestrictionCreate(ceed, num_elem, P*P, 1, 1, num_dofs, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_x, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q*Q, Q *Q *dim *dim};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q*Q, dim*dim,
+                                   dim*dim*num_qpts, strides_qd,
+                                   &elem_restr_qd_i);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, P, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "qdata", dim*dim, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, diff, diff_loc, &qf_diff);
+  CeedQFunctionAddInput(qf_diff, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_diff, "qdata", dim*dim, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_diff, "dv", dim, CEED_EVAL_GRAD);
+  CeedQFunctionSetFieldSymmetric(qf_diff, "qdata");
+
+  // Setup
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedVectorCreate(ceed, num_qpts*dim*dim, &q_data);
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Poisson operators, with and without compressed quadrature data
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff_ref);
+  CeedOperatorSetField(op_diff_ref, "du", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff_ref, "qdata", elem_restr_qd_i,
+                       CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_diff_ref, "dv", elem_restr_u, basis_u,
+                       CEED_VECTOR_ACTIVE);
+  for (CeedInt s=0; s<3; s++) {
+    CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_diff[s]);
+    CeedOperatorSetField(op_diff[s], "du", elem_restr_u, basis_u,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_diff[s], "qdata", elem_restr_qd_i,
+                         CEED_BASIS_COLLOCATED, q_data);
+    CeedOperatorSetField(op_diff[s], "dv", elem_restr_u, basis_u,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorCompressQData(op_diff[s], "qdata", storages[s]);
+  }
+
+  // Reference result
+  for (CeedInt i=0; i<num_dofs; i++)
+    u[i] = 1 + sin(i);
+  CeedVectorCreate(ceed, num_dofs, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, num_dofs, &V);
+  CeedVectorCreate(ceed, num_dofs, &V_ref);
+  CeedVectorCreate(ceed, num_dofs, &D);
+  CeedVectorCreate(ceed, num_dofs, &D_ref);
+  CeedOperatorApply(op_diff_ref, U, V_ref, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorLinearAssembleDiagonal(op_diff_ref, D_ref,
+                                     CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(V_ref, CEED_NORM_MAX, &v_max);
+
+  // Compressed operators no longer reference the full quadrature data
+  CeedOperatorDestroy(&op_diff_ref);
+  CeedVectorDestroy(&q_data);
+
+  for (CeedInt s=0; s<3; s++) {
+    // Apply
+    CeedOperatorApply(op_diff[s], U, V, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(V_ref, CEED_MEM_HOST, &hv_ref);
+    for (CeedInt i=0; i<num_dofs; i++)
+      if (fabs(hv[i] - hv_ref[i]) > tols[s]*v_max)
+        // LCOV_EXCL_START
+        printf("%s [%d] v %g != v_ref %g\n", CeedQDataStorages[storages[s]], i,
+               hv[i], hv_ref[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &hv);
+    CeedVectorRestoreArrayRead(V_ref, &hv_ref);
+
+    // Assemble diagonal
+    CeedOperatorLinearAssembleDiagonal(op_diff[s], D, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(D, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(D_ref, CEED_MEM_HOST, &hv_ref);
+    for (CeedInt i=0; i<num_dofs; i++)
+      if (fabs(hv[i] - hv_ref[i]) > tols[s]*fabs(hv_ref[i]) + 100.*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("%s [%d] diagonal %g != %g\n", CeedQDataStorages[storages[s]], i,
+               hv[i], hv_ref[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(D, &hv);
+    CeedVectorRestoreArrayRead(D_ref, &hv_ref);
+  }
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt s=0; s<3; s++)
+    CeedOperatorDestroy(&op_diff[s]);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&V_ref);
+  CeedVectorDestroy(&D);
+  CeedVectorDestroy(&D_ref);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,149 @@
+/// @file
+/// Test applying and updating a nonlinear operator on subsets of elements
+/// \test Test applying and updating a nonlinear operator on subsets of elements
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t515-operator.h"
+
+static void CheckVectors(const char *name, CeedVector v, CeedVector v_ref) {
+  CeedInt n;
+  const CeedScalar *hv, *hv_ref;
+
+  CeedVectorGetLength(v, &n);
+  CeedVectorGetArrayRead(v, CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(v_ref, CEED_MEM_HOST, &hv_ref);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(hv[i] - hv_ref[i]) > 100.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("%s [%d] computed: %f actual: %f\n", name, i, hv[i], hv_ref[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(v, &hv);
+  CeedVectorRestoreArrayRead(v_ref, &hv_ref);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector q_data, X, U, U_new, V, V_ref;
+  CeedInt num_elem = 15, P = 5, Q = 8;
+  CeedInt num_nodes_x = num_elem+1, num_nodes_u = num_elem*(P-1)+1;
+  CeedInt ind_x[num_elem*2], ind_u[num_elem*P];
+  CeedInt num_even = (num_elem+1)/2, num_odd = num_elem/2;
+  CeedInt even[num_even], odd[num_odd], dirty[2] = {4, 3};
+  CeedScalar x[num_nodes_x], u[num_nodes_u], u_new[num_nodes_u];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<num_nodes_x; i++)
+    x[i] = (CeedScalar) i / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind_x[2*i+0] = i;
+    ind_x[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_x, &elem_restr_x);
+
+  for (CeedInt i=0; i<num_elem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      ind_u[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, P, 1, 1, num_nodes_u, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_u, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q, 1, Q*num_elem, strides_qd,
+                                   &elem_restr_qd_i);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass_cubic, mass_cubic_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, num_elem*Q, &q_data);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    u[i] = 1 + 0.5*sin(i);
+  CeedVectorCreate(ceed, num_nodes_u, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, num_nodes_u, &V);
+  CeedVectorCreate(ceed, num_nodes_u, &V_ref);
+
+  // Even and odd elements together give the full operator
+  for (CeedInt i=0; i<num_even; i++)
+    even[i] = 2*i;
+  for (CeedInt i=0; i<num_odd; i++)
+    odd[i] = 2*i + 1;
+  CeedOperatorApply(op_mass, U, V_ref, CEED_REQUEST_IMMEDIATE);
+  CeedVectorSetValue(V, 0.0);
+  CeedOperatorApplyAddElements(op_mass, num_even, even, U, V,
+                               CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAddElements(op_mass, num_odd, odd, U, V,
+                               CEED_REQUEST_IMMEDIATE);
+  CheckVectors("Subsets", V, V_ref);
+
+  // Change the input on nodes of elements 3 and 4 only
+  for (CeedInt i=0; i<num_nodes_u; i++)
+    u_new[i] = u[i];
+  for (CeedInt i=3*(P-1)+1; i<5*(P-1); i++)
+    u_new[i] = 2 - cos(i);
+  CeedVectorCreate(ceed, num_nodes_u, &U_new);
+  CeedVectorSetArray(U_new, CEED_MEM_HOST, CEED_USE_POINTER, u_new);
+
+  // Update the previous output in place
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorUpdateElements(op_mass, 2, dirty, U, U_new, V,
+                             CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, U_new, V_ref, CEED_REQUEST_IMMEDIATE);
+  CheckVectors("Update", V, V_ref);
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&U_new);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&V_ref);
+  CeedVectorDestroy(&q_data);
+  CeedDestroy(&ceed);
+  return 0;
+}
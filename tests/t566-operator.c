@@ -0,0 +1,171 @@
+/// @file
+/// Test low-order-refined assembly of Poisson operator
+/// \test Test low-order-refined assembly of Poisson operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t522-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_diff;
+  CeedOperator op_setup, op_diff;
+  CeedVector q_data, X, values;
+  CeedInt P = 4, Q = 5, dim = 2;
+  CeedInt n_x = 3, n_y = 2, num_elem = n_x*n_y;
+  CeedInt num_nodes_x = (n_x+1)*(n_y+1);
+  CeedInt num_dofs_x = n_x*(P-1)+1, num_dofs = num_dofs_x*(n_y*(P-1)+1);
+  CeedInt num_qpts = num_elem*Q*Q;
+  CeedInt ind_x[num_elem*2*2], ind_u[num_elem*P*P];
+  CeedInt num_rows, *row_ptr, *col_ind;
+  CeedScalar x[dim*num_nodes_x], gll[P], u_x[num_dofs], u_y[num_dofs];
+  const CeedScalar *a;
+
+  CeedInit(argv[1], &ceed);
+
+  // Mesh coordinates
+  for (CeedInt i=0; i<n_x+1; i++)
+    for (CeedInt j=0; j<n_y+1; j++) {
+      x[i+j*(n_x+1)+0*num_nodes_x] = (CeedScalar) i / n_x;
+      x[i+j*(n_x+1)+1*num_nodes_x] = (CeedScalar) j / n_y;
+    }
+  CeedVectorCreate(ceed, dim*num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Coordinates of the Gauss-Lobatto nodes
+  CeedLobattoQuadrature(P, gll, NULL);
+  for (CeedInt i=0; i<num_dofs_x; i++)
+    for (CeedInt j=0; j<num_dofs/num_dofs_x; j++) {
+      u_x[i+j*num_dofs_x] = (i/(P-1) + (1+gll[i%(P-1)])/2) / n_x;
+      u_y[i+j*num_dofs_x] = (j/(P-1) + (1+gll[j%(P-1)])/2) / n_y;
+    }
+
+  // Element Setup
+  for (CeedInt e=0; e<num_elem; e++) {
+    CeedInt col = e % n_x, row = e / n_x;
+    for (CeedInt j=0; j<2; j++)
+      for (CeedInt k=0; k<2; k++)
+        ind_x[4*e+2*k+j] = col + j + (row + k)*(n_x+1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        ind_u[P*(P*e+k)+j] = col*(P-1) + j + (row*(P-1) + k)*num_dofs_x;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, num_elem, 2*2, dim, num_nodes_x,
+                            dim*num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER,
+                            ind_x, &elem_restr_x);
+  CeedElemRestrictionCreate(ceed, num_elem, P*P, 1, 1, num_dofs, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_u, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q*Q, Q *Q *dim *(dim+1)/2};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q*Q, dim*(dim+1)/2,
+                                   dim*(dim+1)/2*num_qpts,
+                                   strides_qd, &elem_restr_qd_i);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunction - setup
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
+
+  // Operator - setup
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedVectorCreate(ceed, num_qpts*dim*(dim+1)/2, &q_data);
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // QFunction - apply
+  CeedQFunctionCreateInterior(ceed, 1, diff, diff_loc, &qf_diff);
+  CeedQFunctionAddInput(qf_diff, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_diff, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_diff, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operator - apply
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff);
+  CeedOperatorSetField(op_diff, "qdata", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       q_data);
+  CeedOperatorSetField(op_diff, "du", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "dv", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Assemble LOR matrix
+  CeedOperatorLinearAssembleLORSymbolic(op_diff, &num_rows, &row_ptr, &col_ind);
+  if (num_rows != num_dofs)
+    // LCOV_EXCL_START
+    printf("Incorrect number of rows: %d != %d\n", num_rows, num_dofs);
+  // LCOV_EXCL_STOP
+  // -- Each interior node couples to its 3x3 neighborhood on the sub-mesh
+  CeedInt num_dofs_y = num_dofs/num_dofs_x;
+  CeedInt nnz_true = (3*num_dofs_x-2)*(3*num_dofs_y-2);
+  if (row_ptr[num_rows] != nnz_true)
+    // LCOV_EXCL_START
+    printf("Incorrect number of nonzeros: %d != %d\n", row_ptr[num_rows],
+           nnz_true);
+  // LCOV_EXCL_STOP
+  CeedVectorCreate(ceed, row_ptr[num_rows], &values);
+  CeedOperatorLinearAssembleLOR(op_diff, row_ptr, col_ind, values);
+
+  // Check output
+  CeedVectorGetArrayRead(values, CEED_MEM_HOST, &a);
+  CeedScalar energy_x = 0., energy_y = 0.;
+  for (CeedInt i=0; i<num_rows; i++) {
+    CeedScalar row_sum = 0.;
+    for (CeedInt k=row_ptr[i]; k<row_ptr[i+1]; k++) {
+      CeedInt j = col_ind[k];
+      row_sum += a[k];
+      energy_x += u_x[i]*a[k]*u_x[j];
+      energy_y += u_y[i]*a[k]*u_y[j];
+      // -- Symmetry
+      for (CeedInt kk=row_ptr[j]; kk<row_ptr[j+1]; kk++)
+        if (col_ind[kk] == i && fabs(a[kk] - a[k]) > 100.*CEED_EPSILON)
+          // LCOV_EXCL_START
+          printf("[%d, %d] Error in symmetry: %f != %f\n", i, j, a[k], a[kk]);
+      // LCOV_EXCL_STOP
+    }
+    if (fabs(row_sum) > 100.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] Error in row sum: %f != 0.0\n", i, row_sum);
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(values, &a);
+  // -- Energy of linear functions is exact on an affine mesh
+  if (fabs(energy_x - 1.) > 1000.*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in energy of x: %f != 1.0\n", energy_x);
+  // LCOV_EXCL_STOP
+  if (fabs(energy_y - 1.) > 1000.*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in energy of y: %f != 1.0\n", energy_y);
+  // LCOV_EXCL_STOP
+
+  // Cleanup
+  free(row_ptr);
+  free(col_ind);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_diff);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&values);
+  CeedVectorDestroy(&q_data);
+  CeedDestroy(&ceed);
+  return 0;
+}
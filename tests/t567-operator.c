@@ -0,0 +1,216 @@
+/// @file
+/// Test chunked full assembly of mass matrix operator
+/// \test Test chunked full assembly of mass matrix operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t510-operator.h"
+
+typedef struct {
+  CeedInt num_dofs, num_chunks, num_entries, max_chunk_entries;
+  CeedScalar *assembled, *values;
+} AssemblyCtx;
+
+// Accumulate chunk with indices into dense matrix
+static int add_dense(void *ctx, CeedInt num_entries, const CeedInt *rows,
+                     const CeedInt *cols, const CeedScalar *values) {
+  AssemblyCtx *data = ctx;
+  for (CeedInt k=0; k<num_entries; k++)
+    data->assembled[rows[k]*data->num_dofs + cols[k]] += values[k];
+  data->num_chunks++;
+  if (num_entries > data->max_chunk_entries)
+    data->max_chunk_entries = num_entries;
+  return 0;
+}
+
+// Concatenate chunk values
+static int append_values(void *ctx, CeedInt num_entries, const CeedInt *rows,
+                         const CeedInt *cols, const CeedScalar *values) {
+  AssemblyCtx *data = ctx;
+  if (rows || cols)
+    // LCOV_EXCL_START
+    printf("Indices passed to callback without request\n");
+  // LCOV_EXCL_STOP
+  for (CeedInt k=0; k<num_entries; k++)
+    data->values[data->num_entries + k] = values[k];
+  data->num_entries += num_entries;
+  return 0;
+}
+
+// Abort assembly after the first chunk
+static int abort_assembly(void *ctx, CeedInt num_entries, const CeedInt *rows,
+                          const CeedInt *cols, const CeedScalar *values) {
+  AssemblyCtx *data = ctx;
+  data->num_chunks++;
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u,
+                      elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector q_data, X;
+  CeedInt P = 3, Q = 4, dim = 2;
+  CeedInt n_x = 3, n_y = 2;
+  CeedInt num_elem = n_x * n_y;
+  CeedInt num_dofs = (n_x*2+1)*(n_y*2+1), num_qpts = num_elem*Q*Q;
+  CeedInt ind_x[num_elem*P*P];
+  CeedScalar assembled[num_dofs*num_dofs];
+  CeedScalar x[dim*num_dofs], assembled_true[num_dofs*num_dofs];
+
+  CeedInit(argv[1], &ceed);
+
+  // DoF Coordinates
+  for (CeedInt i=0; i<n_x*2+1; i++)
+    for (CeedInt j=0; j<n_y*2+1; j++) {
+      x[i+j*(n_x*2+1)+0*num_dofs] = (CeedScalar) i / (2*n_x);
+      x[i+j*(n_x*2+1)+1*num_dofs] = (CeedScalar) j / (2*n_y);
+    }
+  CeedVectorCreate(ceed, dim*num_dofs, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Qdata Vector
+  CeedVectorCreate(ceed, num_qpts, &q_data);
+
+  // Element Setup
+  for (CeedInt i=0; i<num_elem; i++) {
+    CeedInt col, row, offset;
+    col = i % n_x;
+    row = i / n_x;
+    offset = col*(P-1) + row*(n_x*2+1)*(P-1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        ind_x[P*(P*i+k)+j] = offset + k*(n_x*2+1) + j;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, num_elem, P*P, dim, num_dofs, dim*num_dofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restr_x);
+
+  CeedElemRestrictionCreate(ceed, num_elem, P*P, 1, 1, num_dofs, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_x, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q*Q, Q*Q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q*Q, 1, num_qpts, strides_qd,
+                                   &elem_restr_qd_i);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, P, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Fully assemble operator
+  for (int k=0; k<num_dofs*num_dofs; ++k) {
+    assembled[k] = 0.0;
+    assembled_true[k] = 0.0;
+  }
+  CeedInt num_entries;
+  CeedInt *rows;
+  CeedInt *cols;
+  CeedVector values;
+  CeedOperatorLinearAssembleSymbolic(op_mass, &num_entries, &rows, &cols);
+  CeedVectorCreate(ceed, num_entries, &values);
+  CeedOperatorLinearAssemble(op_mass, values);
+  const CeedScalar *vals;
+  CeedVectorGetArrayRead(values, CEED_MEM_HOST, &vals);
+  for (int k=0; k<num_entries; ++k) {
+    assembled_true[rows[k]*num_dofs + cols[k]] += vals[k];
+  }
+
+  // Assemble operator in chunks of elements
+  CeedInt chunk_size = 4, elem_entries = P*P*P*P;
+  CeedScalar chunk_values[num_entries];
+  AssemblyCtx ctx = {num_dofs, 0, 0, 0, assembled, chunk_values};
+  CeedOperatorLinearAssembleChunked(op_mass, chunk_size, true, add_dense, &ctx);
+  if (ctx.num_chunks != (num_elem + chunk_size - 1) / chunk_size)
+    // LCOV_EXCL_START
+    printf("Incorrect number of chunks: %d\n", ctx.num_chunks);
+  // LCOV_EXCL_STOP
+  if (ctx.max_chunk_entries != chunk_size*elem_entries)
+    // LCOV_EXCL_START
+    printf("Incorrect chunk size: %d != %d\n", ctx.max_chunk_entries,
+           chunk_size*elem_entries);
+  // LCOV_EXCL_STOP
+  // Callback errors abort assembly and release all data of the operator
+  ctx.num_chunks = 0;
+  int ierr = CeedOperatorLinearAssembleChunked(op_mass, chunk_size, true,
+             abort_assembly, &ctx);
+  if (ierr != 1 || ctx.num_chunks != 1)
+    // LCOV_EXCL_START
+    printf("Callback error not returned: %d after %d chunks\n", ierr,
+           ctx.num_chunks);
+  // LCOV_EXCL_STOP
+  CeedOperatorLinearAssembleChunked(op_mass, chunk_size, false, append_values,
+                                    &ctx);
+  if (ctx.num_entries != num_entries)
+    // LCOV_EXCL_START
+    printf("Incorrect number of entries: %d != %d\n", ctx.num_entries,
+           num_entries);
+  // LCOV_EXCL_STOP
+
+  // Check output
+  for (int k=0; k<num_entries; k++)
+    if (fabs(chunk_values[k] - vals[k]) > 100.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] Error in chunk values: %f != %f\n", k, chunk_values[k],
+             vals[k]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(values, &vals);
+  for (int i=0; i<num_dofs; i++)
+    for (int j=0; j<num_dofs; j++)
+      if (fabs(assembled[j*num_dofs+i] - assembled_true[j*num_dofs+i]) >
+          100.*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("[%d,%d] Error in assembly: %f != %f\n", i, j,
+               assembled[j*num_dofs+i], assembled_true[j*num_dofs+i]);
+  // LCOV_EXCL_STOP
+
+  // Cleanup
+  free(rows);
+  free(cols);
+  CeedVectorDestroy(&values);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&q_data);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,209 @@
+/// @file
+/// Test overlapping vertex patch FDM smoother for Poisson operator
+/// \test Test overlapping vertex patch FDM smoother for Poisson operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t522-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_diff;
+  CeedOperator op_setup, op_diff;
+  CeedOperator op_inv;
+  CeedVector q_data, X;
+  CeedInt P = 4, Q = 5, dim = 2;
+  CeedInt n_x = 3, n_y = 3, num_elem = n_x*n_y;
+  CeedInt num_nodes_x = (n_x+1)*(n_y+1);
+  CeedInt num_dofs_x = n_x*(P-1)+1, num_dofs = num_dofs_x*(n_y*(P-1)+1);
+  CeedInt num_qpts = num_elem*Q*Q;
+  CeedInt ind_x[num_elem*2*2], ind_u[num_elem*P*P];
+  CeedScalar x[dim*num_nodes_x];
+  const CeedScalar *a;
+
+  CeedInit(argv[1], &ceed);
+
+  // Mesh coordinates
+  for (CeedInt i=0; i<n_x+1; i++)
+    for (CeedInt j=0; j<n_y+1; j++) {
+      x[i+j*(n_x+1)+0*num_nodes_x] = (CeedScalar) i / n_x;
+      x[i+j*(n_x+1)+1*num_nodes_x] = (CeedScalar) j / n_y;
+    }
+  CeedVectorCreate(ceed, dim*num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Element Setup
+  for (CeedInt e=0; e<num_elem; e++) {
+    CeedInt col = e % n_x, row = e / n_x;
+    for (CeedInt j=0; j<2; j++)
+      for (CeedInt k=0; k<2; k++)
+        ind_x[4*e+2*k+j] = col + j + (row + k)*(n_x+1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        ind_u[P*(P*e+k)+j] = col*(P-1) + j + (row*(P-1) + k)*num_dofs_x;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, num_elem, 2*2, dim, num_nodes_x,
+                            dim*num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER,
+                            ind_x, &elem_restr_x);
+  CeedElemRestrictionCreate(ceed, num_elem, P*P, 1, 1, num_dofs, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_u, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q*Q, Q *Q *dim *(dim+1)/2};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q*Q, dim*(dim+1)/2,
+                                   dim*(dim+1)/2*num_qpts,
+                                   strides_qd, &elem_restr_qd_i);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunction - setup
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
+
+  // Operator - setup
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedVectorCreate(ceed, num_qpts*dim*(dim+1)/2, &q_data);
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // QFunction - apply
+  CeedQFunctionCreateInterior(ceed, 1, diff, diff_loc, &qf_diff);
+  CeedQFunctionAddInput(qf_diff, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_diff, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_diff, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operator - apply
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff);
+  CeedOperatorSetField(op_diff, "qdata", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       q_data);
+  CeedOperatorSetField(op_diff, "du", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "dv", elem_restr_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Create overlapping Schwarz smoother
+  CeedOperatorCreateFDMPatchInverse(op_diff, &op_inv, CEED_REQUEST_IMMEDIATE);
+
+  // Dense smoother and operator matrices
+  CeedVector E, S_e, A_e;
+  CeedScalar s_mat[num_dofs*num_dofs], a_mat[num_dofs*num_dofs];
+  CeedVectorCreate(ceed, num_dofs, &E);
+  CeedVectorCreate(ceed, num_dofs, &S_e);
+  CeedVectorCreate(ceed, num_dofs, &A_e);
+  for (CeedInt j=0; j<num_dofs; j++) {
+    CeedScalar *e;
+    CeedVectorSetValue(E, 0.0);
+    CeedVectorGetArray(E, CEED_MEM_HOST, &e);
+    e[j] = 1.0;
+    CeedVectorRestoreArray(E, &e);
+    CeedOperatorApply(op_inv, E, S_e, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_diff, E, A_e, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(S_e, CEED_MEM_HOST, &a);
+    for (CeedInt i=0; i<num_dofs; i++)
+      s_mat[i*num_dofs+j] = a[i];
+    CeedVectorRestoreArrayRead(S_e, &a);
+    CeedVectorGetArrayRead(A_e, CEED_MEM_HOST, &a);
+    for (CeedInt i=0; i<num_dofs; i++)
+      a_mat[i*num_dofs+j] = a[i];
+    CeedVectorRestoreArrayRead(A_e, &a);
+  }
+
+  // Check symmetry and positive diagonal
+  for (CeedInt i=0; i<num_dofs; i++) {
+    if (s_mat[i*num_dofs+i] <= 0.)
+      // LCOV_EXCL_START
+      printf("[%d] Error in diagonal: %f <= 0.0\n", i, s_mat[i*num_dofs+i]);
+    // LCOV_EXCL_STOP
+    for (CeedInt j=0; j<i; j++)
+      if (fabs(s_mat[i*num_dofs+j] - s_mat[j*num_dofs+i]) > 100.*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("[%d, %d] Error in symmetry: %f != %f\n", i, j,
+               s_mat[i*num_dofs+j], s_mat[j*num_dofs+i]);
+    // LCOV_EXCL_STOP
+  }
+
+  // Largest eigenvalue of S A by power iteration
+  CeedScalar v[num_dofs], w[num_dofs], t[num_dofs], lambda_max = 0.;
+  for (CeedInt i=0; i<num_dofs; i++)
+    v[i] = sin(3.1*i) + 0.3;
+  for (CeedInt it=0; it<200; it++) {
+    CeedScalar norm = 0.;
+    for (CeedInt i=0; i<num_dofs; i++) {
+      t[i] = 0.;
+      for (CeedInt j=0; j<num_dofs; j++)
+        t[i] += a_mat[i*num_dofs+j]*v[j];
+    }
+    for (CeedInt i=0; i<num_dofs; i++) {
+      w[i] = 0.;
+      for (CeedInt j=0; j<num_dofs; j++)
+        w[i] += s_mat[i*num_dofs+j]*t[j];
+      norm += w[i]*w[i];
+    }
+    lambda_max = sqrt(norm);
+    for (CeedInt i=0; i<num_dofs; i++)
+      v[i] = w[i] / lambda_max;
+  }
+  // -- Partition of unity weights keep the undamped smoother convergent
+  if (lambda_max >= 2.)
+    // LCOV_EXCL_START
+    printf("Error in largest eigenvalue of smoothed operator: %f >= 2.0\n",
+           lambda_max);
+  // LCOV_EXCL_STOP
+
+  // Smoothing of an oscillatory error, e_1 = (I - S A) e_0
+  CeedScalar energy_0 = 0., energy_1 = 0.;
+  for (CeedInt i=0; i<num_dofs; i++)
+    v[i] = ((i % num_dofs_x) % 2 ? 1. : -1.)*((i / num_dofs_x) % 2 ? 1. : -1.);
+  for (CeedInt i=0; i<num_dofs; i++) {
+    t[i] = 0.;
+    for (CeedInt j=0; j<num_dofs; j++)
+      t[i] += a_mat[i*num_dofs+j]*v[j];
+    energy_0 += v[i]*t[i];
+  }
+  for (CeedInt i=0; i<num_dofs; i++) {
+    w[i] = v[i];
+    for (CeedInt j=0; j<num_dofs; j++)
+      w[i] -= s_mat[i*num_dofs+j]*t[j];
+  }
+  for (CeedInt i=0; i<num_dofs; i++) {
+    t[i] = 0.;
+    for (CeedInt j=0; j<num_dofs; j++)
+      t[i] += a_mat[i*num_dofs+j]*w[j];
+    energy_1 += w[i]*t[i];
+  }
+  if (energy_1 > 0.1*energy_0)
+    // LCOV_EXCL_START
+    printf("Error in smoothing: energy %f -> %f\n", energy_0, energy_1);
+  // LCOV_EXCL_STOP
+
+  // Cleanup
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&E);
+  CeedVectorDestroy(&S_e);
+  CeedVectorDestroy(&A_e);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_diff);
+  CeedOperatorDestroy(&op_inv);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,164 @@
+/// @file
+/// Test concurrent application of distinct mass operators sharing one Ceed
+/// \test Test concurrent application of distinct mass operators sharing one Ceed
+#include <ceed.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include "t570-operator.h"
+
+#define NUM_THREADS 4
+
+typedef struct {
+  Ceed ceed;
+  CeedOperator op;
+  CeedInt thread, num_nodes;
+  CeedScalar sum;
+  int ierr;
+} ThreadData;
+
+// Each thread owns its operator and vectors; all other objects are shared
+static void *ApplyMass(void *arg) {
+  ThreadData *data = (ThreadData *)arg;
+  CeedVector U, V;
+  const CeedScalar *hv;
+
+  data->ierr = CeedVectorCreate(data->ceed, data->num_nodes, &U);
+  data->ierr |= CeedVectorCreate(data->ceed, data->num_nodes, &V);
+  data->ierr |= CeedVectorSetValue(U, data->thread + 1);
+  for (CeedInt i=0; i<20; i++)
+    data->ierr |= CeedOperatorApply(data->op, U, V, CEED_REQUEST_IMMEDIATE);
+
+  data->ierr |= CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  data->sum = 0.;
+  for (CeedInt i=0; i<data->num_nodes; i++)
+    data->sum += hv[i];
+  data->ierr |= CeedVectorRestoreArrayRead(V, &hv);
+
+  data->ierr |= CeedVectorDestroy(&U);
+  data->ierr |= CeedVectorDestroy(&V);
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction elem_restr_x, elem_restr_u, elem_restr_qd_i;
+  CeedBasis basis_x, basis_u;
+  CeedQFunction qf_setup, qf_mass;
+  CeedQFunctionContext ctx;
+  CeedOperator op_setup, op_mass[NUM_THREADS];
+  CeedVector q_data, X;
+  CeedInt num_elem = 15, P = 5, Q = 8;
+  CeedInt num_nodes_x = num_elem+1, num_nodes_u = num_elem*(P-1)+1;
+  CeedInt ind_x[num_elem*2], ind_u[num_elem*P];
+  CeedScalar x[num_nodes_x], scale = 2.0;
+  pthread_t threads[NUM_THREADS];
+  ThreadData data[NUM_THREADS];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<num_nodes_x; i++)
+    x[i] = (CeedScalar) i / (num_nodes_x - 1);
+  for (CeedInt i=0; i<num_elem; i++) {
+    ind_x[2*i+0] = i;
+    ind_x[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_x, &elem_restr_x);
+
+  for (CeedInt i=0; i<num_elem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      ind_u[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, P, 1, 1, num_nodes_u, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind_u, &elem_restr_u);
+  CeedInt strides_qd[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, Q, 1, Q*num_elem, strides_qd,
+                                   &elem_restr_qd_i);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionContextCreate(ceed, &ctx);
+  CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_USE_POINTER,
+                              sizeof(scale), &scale);
+  CeedQFunctionSetContext(qf_mass, ctx);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+
+  CeedVectorCreate(ceed, num_nodes_x, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, num_elem*Q, &q_data);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, basis_x,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restr_qd_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, q_data, CEED_REQUEST_IMMEDIATE);
+
+  for (CeedInt t=0; t<NUM_THREADS; t++) {
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass[t]);
+    CeedOperatorSetField(op_mass[t], "rho", elem_restr_qd_i,
+                         CEED_BASIS_COLLOCATED, q_data);
+    CeedOperatorSetField(op_mass[t], "u", elem_restr_u, basis_u,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[t], "v", elem_restr_u, basis_u,
+                         CEED_VECTOR_ACTIVE);
+  }
+
+  // Apply operators concurrently
+  for (CeedInt t=0; t<NUM_THREADS; t++) {
+    data[t].ceed = ceed;
+    data[t].op = op_mass[t];
+    data[t].thread = t;
+    data[t].num_nodes = num_nodes_u;
+    pthread_create(&threads[t], NULL, ApplyMass, &data[t]);
+  }
+  for (CeedInt t=0; t<NUM_THREADS; t++) {
+    pthread_join(threads[t], NULL);
+    if (data[t].ierr)
+      // LCOV_EXCL_START
+      printf("Error applying operator on thread %d\n", t);
+    // LCOV_EXCL_STOP
+    if (fabs(data[t].sum - scale*(t + 1)) > 1000.*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Computed area on thread %d: %f != True area: %f\n", t,
+             data[t].sum, scale*(t + 1));
+    // LCOV_EXCL_STOP
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionContextDestroy(&ctx);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt t=0; t<NUM_THREADS; t++)
+    CeedOperatorDestroy(&op_mass[t]);
+  CeedElemRestrictionDestroy(&elem_restr_u);
+  CeedElemRestrictionDestroy(&elem_restr_x);
+  CeedElemRestrictionDestroy(&elem_restr_qd_i);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&q_data);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -107,6 +107,16 @@ for ((i=0;i<${#backends[@]};++i)); do
         continue;
     fi
 
+    # Concurrent operator application is only supported by the CPU backends
+    if [[ "$1" = t570* && "$backend" != /cpu/self/ref* && \
+            "$backend" != /cpu/self/opt* && "$backend" != /cpu/self/avx* && \
+            "$backend" != /cpu/self/xsmm* ]]; then
+        printf "ok $i0 # SKIP - no support for concurrent apply with $backend\n"
+        printf "ok $i1 # SKIP - no support for concurrent apply with $backend stdout\n"
+        printf "ok $i2 # SKIP - no support for concurrent apply with $backend stderr\n"
+        continue;
+    fi
+
     # Run in subshell
     (build/$1 ${args/\{ceed_resource\}/$backend} || false) > ${output}.out 2> ${output}.err
     status=$?